@@ -0,0 +1,13 @@
+#pragma once
+#include "Eule/Vector3.h"
+
+namespace Leonetienne::Eule
+{
+	/** Trivial data structure representing an axis-aligned bounding box
+	*/
+	struct AABB
+	{
+		Vector3d min;
+		Vector3d max;
+	};
+}
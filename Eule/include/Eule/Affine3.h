@@ -0,0 +1,69 @@
+#pragma once
+#include "Eule/Matrix4x4.h"
+#include "Eule/Vector3.h"
+#include <array>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** The upper three rows of a Matrix4x4: a 3x3 component containing scaling and rotation information,
+	* and a vector (d,h,l) representing the translation. The implicit last row is (0, 0, 0, 1).
+	*
+	* Stores 12 doubles in 32-byte aligned rows, and no shorthand references, so it takes 96 bytes instead of the 256 a Matrix4x4 takes.
+	* operator* and Inverse3x3() behave exactly like those of Matrix4x4, so both types can be used interchangeably.
+	*/
+	class Affine3
+	{
+	public:
+		//! Constructs the identity
+		Affine3();
+
+		//! Constructs from the upper three rows of a matrix. Lossless, if its last row is (0, 0, 0, 1)
+		explicit Affine3(const Matrix4x4& matrix);
+
+		Affine3(const Affine3& other) = default;
+		Affine3(Affine3&& other) noexcept = default;
+		void operator=(const Affine3& other);
+		void operator=(Affine3&& other) noexcept;
+
+		//! Rows a-d, e-h and i-l, like Matrix4x4::v
+		alignas(32) std::array<std::array<double, 4>, 3> v;
+
+		//! Will return the equivalent Matrix4x4, with the last row being (0, 0, 0, 1)
+		Matrix4x4 ToMatrix4x4() const;
+
+		//! Like Matrix4x4::operator*: multiplies the 3x3 components, and adds the translations
+		Affine3 operator*(const Affine3& other) const;
+		void operator*=(const Affine3& other);
+
+		//! Like Matrix4x4::Inverse3x3(): the 3x3 component will be inverted, and the translation component will be negated.
+		//! Throws std::runtime_error if the 3x3 component is not inversible.
+		Affine3 Inverse3x3() const;
+
+		//! Will check if the 3x3 component is inversible
+		bool IsInversible3x3() const;
+
+		//! Will return the determinant of the 3x3 component
+		double Determinant3x3() const;
+
+		//! Will transform a point, like `point * matrix` does for a Matrix4x4
+		Vector3d TransformPoint(const Vector3d& point) const;
+
+		//! Will transform many points. `out` gets resized to `points.size()`. Processes four points at a time with intrinsics enabled
+		void TransformPoints(const std::vector<Vector3d>& points, std::vector<Vector3d>& out) const;
+
+		//! Will return d,h,l as a Vector3d(x,y,z)
+		Vector3d GetTranslationComponent() const;
+		//! Will set d,h,l from a Vector3d(x,y,z)
+		void SetTranslationComponent(const Vector3d& trans);
+
+		std::array<double, 4>& operator[](std::size_t y);
+		const std::array<double, 4>& operator[](std::size_t y) const;
+
+		bool operator==(const Affine3& other) const;
+		bool operator!=(const Affine3& other) const;
+
+		//! Will compare if two transformations are similar to a certain epsilon value
+		bool Similar(const Affine3& other, double epsilon = 0.00001) const;
+	};
+}
@@ -12,5 +12,18 @@ namespace Leonetienne::Eule
 	public:
 		//! Tests, if this Collider contains a point
 		virtual bool Contains(const Vector3d& point) const = 0;
+
+		//! Will return the point of this shape that lies furthest along a direction (its support point).
+		//! Only convex shapes can provide one. It is required by Overlap::GJK() and Overlap::EPA().
+		//! Unless overridden, this will throw std::logic_error.
+		virtual Vector3d SupportPoint(const Vector3d& direction) const;
+
+		//! Will return the distance of a point to the surface of this shape. It is negative for points inside.
+		//! Unless overridden, this will throw std::logic_error.
+		virtual double SignedDistance(const Vector3d& point) const;
+
+		//! Will return the point of this shape closest to a given point. Points inside are their own closest point.
+		//! Unless overridden, this will throw std::logic_error.
+		virtual Vector3d ClosestPoint(const Vector3d& point) const;
 	};
 }
@@ -0,0 +1,97 @@
+#pragma once
+#include "Eule/Collider.h"
+#include "Eule/TrapazoidalPrismCollider.h"
+#include "Eule/Frustum.h"
+#include "Eule/Vector3.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** A set of colliders, grouped by their concrete type.
+	* Queries run one type-specialized batch loop per group (no virtual dispatch per collider),
+	* instead of calling Collider::Contains() through a pointer for each one.
+	* Colliders of other types can still be added by pointer, and will be queried virtually.
+	*
+	* TrapazoidalPrismColliders are not stored as-is. Only their six plane equations are kept,
+	* as structure-of-arrays in cache-line-aligned blocks of PRISM_BLOCK_WIDTH prisms.
+	* This way, one point gets tested against a whole block of prisms per instruction.
+	*
+	* Every added collider gets a handle, which is simply the count of colliders added before it.
+	*/
+	class ColliderSet
+	{
+	public:
+		ColliderSet() = default;
+		ColliderSet(const ColliderSet& other) = default;
+		ColliderSet(ColliderSet&& other) noexcept = default;
+		ColliderSet& operator=(const ColliderSet& other) = default;
+		ColliderSet& operator=(ColliderSet&& other) noexcept = default;
+
+		//! Will add a copy of a collider, and return its handle
+		std::size_t Add(const TrapazoidalPrismCollider& collider);
+
+		//! Will add a copy of a collider, and return its handle
+		std::size_t Add(const Frustum& collider);
+
+		//! Will add a collider of any other type, and return its handle.
+		//! The set does not take ownership. The collider has to outlive the set.
+		//! These colliders will be queried via virtual calls.
+		std::size_t Add(const Collider* collider);
+
+		//! Will return the amount of colliders in this set
+		std::size_t Size() const;
+
+		//! Will remove all colliders. Handles start at 0 again
+		void Clear();
+
+		//! Will append the handles of all colliders containing a point to `out`, in no particular order
+		void FindContaining(const Vector3d& point, std::vector<std::size_t>& out) const;
+
+		//! Will return the handles of all colliders containing a point, in no particular order
+		std::vector<std::size_t> FindContaining(const Vector3d& point) const;
+
+		//! Will set bit `handle` of `bits` for each collider containing a point.
+		//! `bits` gets resized to hold Size() bits, and cleared.
+		void FindContainingMask(const Vector3d& point, std::vector<std::uint64_t>& bits) const;
+
+		//! Tests, if any collider in this set contains a point
+		bool AnyContains(const Vector3d& point) const;
+
+		//! Amount of prisms stored per block
+		static constexpr std::size_t PRISM_BLOCK_WIDTH = 4;
+
+	private:
+		//! The plane equations of PRISM_BLOCK_WIDTH prisms. A point p is inside a prism, if for each plane:
+		//! `nx*p.x + ny*p.y + nz*p.z + d >= 0`
+		struct alignas(64) PrismBlock
+		{
+			// Indexed [face][prism]
+			std::array<std::array<double, PRISM_BLOCK_WIDTH>, 6> nx;
+			std::array<std::array<double, PRISM_BLOCK_WIDTH>, 6> ny;
+			std::array<std::array<double, PRISM_BLOCK_WIDTH>, 6> nz;
+			std::array<std::array<double, PRISM_BLOCK_WIDTH>, 6> d;
+		};
+
+		//! Will call `onContained(handle)` for each prism containing a point. Stops early, if it returns true
+		template <typename Callback>
+		bool ForEachContainingPrism(const Vector3d& point, Callback onContained) const;
+
+		//! Colliders of one concrete type, and their handles
+		template <typename T>
+		struct Group
+		{
+			std::vector<T> colliders;
+			std::vector<std::size_t> handles;
+		};
+
+		std::vector<PrismBlock> prismBlocks;
+		std::vector<std::size_t> prismHandles;
+
+		Group<Frustum> frustums;
+		Group<const Collider*> others;
+
+		std::size_t size = 0;
+	};
+}
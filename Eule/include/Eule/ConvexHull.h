@@ -0,0 +1,54 @@
+#pragma once
+#include "Eule/Vector3.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** The convex hull of a point cloud, as a closed triangle mesh.
+	* Gets computed by quickhull: starting from a tetrahedron, the point furthest outside any face gets added,
+	* replacing all faces it can see, until no point is left outside.
+	*
+	* Faces and edges live in a half-edge structure, allocated from arenas that recycle the slots of removed faces.
+	*
+	* Only finding the initial tetrahedron, and assigning points to the faces they are outside of, get split across threads,
+	* and only for sets of at least MIN_POINTS_PER_THREAD points. Adding points to the hull happens one at a time, on the calling thread.
+	* So threads mostly speed up the first pass, which discards the points inside the tetrahedron. Once the hull has a few faces,
+	* their outside sets are too small to be split, and the build is effectively sequential.
+	* The result does not depend on the amount of threads.
+	*
+	* Coplanar faces do not get merged, so flat parts of the hull may consist of many triangles, and points lying on them may become vertices.
+	* Points closer to a face than GetTolerance() count as lying on it, so input points may lie up to that far outside of the faces.
+	*/
+	class ConvexHull
+	{
+	public:
+		//! Will compute the hull of a point cloud, using up to `threadCount` threads for large point sets (0 means one per hardware thread).
+		//! Throws std::invalid_argument if the points don't span a volume (all of them lying in one plane, or there being less than four).
+		explicit ConvexHull(const std::vector<Vector3d>& points, std::size_t threadCount = 1);
+
+		//! Will return the vertices of the hull. Each is one of the input points
+		const std::vector<Vector3d>& GetVertices() const;
+
+		//! Will return the triangles of the hull, indexing GetVertices().
+		//! Their vertices are ordered counter-clockwise, seen from outside.
+		const std::vector<std::array<std::size_t, 3>>& GetTriangles() const;
+
+		//! Will return, for each vertex, the index of the input point it is
+		const std::vector<std::size_t>& GetSourceIndices() const;
+
+		//! Will return the distance below which points count as lying on a face, instead of outside of it.
+		//! It scales with the magnitude of the coordinates, as it only has to absorb rounding errors
+		double GetTolerance() const;
+
+		//! Points a thread has to get at least, for searching or assigning points to spawn it
+		static constexpr std::size_t MIN_POINTS_PER_THREAD = 16384;
+
+	private:
+		std::vector<Vector3d> vertices;
+		std::vector<std::array<std::size_t, 3>> triangles;
+		std::vector<std::size_t> sourceIndices;
+		double tolerance;
+	};
+}
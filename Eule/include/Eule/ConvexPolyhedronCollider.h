@@ -0,0 +1,89 @@
+#pragma once
+#include "Eule/Collider.h"
+#include "Eule/ConvexHull.h"
+#include "Eule/TrapazoidalPrismCollider.h"
+#include "Eule/OBB.h"
+#include "Eule/Frustum.h"
+#include "Eule/Vector3.h"
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** A collider describing any convex polyhedron, by the planes of its faces and its vertices.
+	* Unlike TrapazoidalPrismCollider, it is not limited to eight vertices and six quads.
+	* The planes are stored as structure-of-arrays, padded to a multiple of PLANE_BLOCK_WIDTH with planes every point is inside of,
+	* so that they can be evaluated a block at a time, without a scalar tail.
+	*/
+	class ConvexPolyhedronCollider : public Collider
+	{
+	public:
+		//! Constructs the cube [-1, 1]^3
+		ConvexPolyhedronCollider();
+
+		//! Constructs the polyhedron of a convex hull. Each triangle becomes a plane.
+		//! Takes on the hull's tolerance, so every point the hull was built from is contained
+		explicit ConvexPolyhedronCollider(const ConvexHull& hull);
+
+		//! Constructs the convex hull of points. See ConvexHull for how it uses `threadCount` (0 means one per hardware thread).
+		//! Throws std::invalid_argument if the points don't span a volume.
+		explicit ConvexPolyhedronCollider(const std::vector<Vector3d>& points, std::size_t threadCount = 1);
+
+		//! Constructs the polyhedron of a prism's six faces and eight vertices. Its faces must not be degenerate
+		explicit ConvexPolyhedronCollider(const TrapazoidalPrismCollider& prism);
+
+		//! Constructs the polyhedron of an oriented box
+		explicit ConvexPolyhedronCollider(const OBB& box);
+
+		//! Constructs the polyhedron of a frustum
+		explicit ConvexPolyhedronCollider(const Frustum& frustum);
+
+		ConvexPolyhedronCollider(const ConvexPolyhedronCollider& other) = default;
+		ConvexPolyhedronCollider(ConvexPolyhedronCollider&& other) noexcept = default;
+		void operator=(const ConvexPolyhedronCollider& other);
+		void operator=(ConvexPolyhedronCollider&& other) noexcept;
+
+		//! Will return the amount of face planes
+		std::size_t GetPlaneCount() const;
+
+		//! Will return the (inwards-facing, normalized) normal of a plane
+		Vector3d GetPlaneNormal(std::size_t plane) const;
+
+		//! Will return the offset of a plane. A point p is on the inner side if `normal.DotProduct(p) + offset >= 0`
+		double GetPlaneOffset(std::size_t plane) const;
+
+		//! Will return the vertices
+		const std::vector<Vector3d>& GetVertices() const;
+
+		//! Will return how far outside of a plane a point may lie, and still count as contained.
+		//! It is that of the hull for polyhedra built from one (see ConvexHull::GetTolerance()), and zero otherwise
+		double GetTolerance() const;
+
+		//! Tests, if this Collider contains a point. Points within GetTolerance() of the surface count as contained.
+		//! With intrinsics enabled, evaluates a block of planes at a time, stopping at the first block the point is outside of.
+		bool Contains(const Vector3d& point) const override;
+
+		//! Will return the vertex that lies furthest along a direction
+		Vector3d SupportPoint(const Vector3d& direction) const override;
+
+		//! The amount of planes that get evaluated at once
+		static constexpr std::size_t PLANE_BLOCK_WIDTH = 4;
+
+	private:
+		//! Will append a plane, given its inwards-facing normal and its offset. Normalizes both
+		void AddPlane(const Vector3d& normal, double offset);
+
+		//! Will pad the plane equations to a multiple of PLANE_BLOCK_WIDTH. Has to be called once all planes are added
+		void PadPlanes();
+
+		std::size_t planeCount = 0;
+
+		// Plane equations, as structure-of-arrays, padded
+		std::vector<double> nx;
+		std::vector<double> ny;
+		std::vector<double> nz;
+		std::vector<double> d;
+
+		std::vector<Vector3d> vertices;
+		double tolerance = 0;
+	};
+}
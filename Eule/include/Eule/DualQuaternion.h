@@ -0,0 +1,128 @@
+#pragma once
+#include "Eule/Quaternion.h"
+#include "Eule/Vector3.h"
+#include "Eule/Vector4.h"
+#include "Eule/Matrix4x4.h"
+#include <array>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+    /** Rigid transformation (rotation + translation) representation.
+    * Consists of a real part (the rotation, same layout as a Quaternion's raw values),
+    * and a dual part (encoding the translation).
+    * At 8 doubles, it is a lot lighter than a Matrix4x4, and blending multiple DualQuaternions
+    * does not result in the volume loss ("candy-wrapper" artifacts) of linear matrix blending.
+    *
+    * Transformations are applied in the same order as Quaternions: `(a * b) * p` applies `a` first, then `b`.
+    */
+    class DualQuaternion
+    {
+    public:
+        //! Constructs an identity transformation
+        DualQuaternion();
+
+        //! Constructs by these raw values
+        DualQuaternion(const Vector4d real, const Vector4d dual);
+
+        //! Constructs from a rotation, and a translation applied after the rotation
+        DualQuaternion(const Quaternion& rotation, const Vector3d& translation);
+
+        //! Constructs from the rotation- and translation components of a rigid Matrix4x4.
+        //! Scaling and shearing in the 3x3 component are not representable, and will result in undefined behaviour.
+        explicit DualQuaternion(const Matrix4x4& mat);
+
+        DualQuaternion(const DualQuaternion& other) = default;
+        DualQuaternion(DualQuaternion&& other) noexcept = default;
+
+        void operator=(const DualQuaternion& other);
+        void operator=(DualQuaternion&& other) noexcept;
+
+        //! Concatenates two transformations. Will apply this one first, then `other`
+        DualQuaternion operator* (const DualQuaternion& other) const;
+
+        //! Concatenates two transformations. Will apply this one first, then `other`
+        void operator*= (const DualQuaternion& other);
+
+        //! Will transform a 3d point
+        Vector3d operator* (const Vector3d& p) const;
+
+        bool operator== (const DualQuaternion& other) const;
+        bool operator!= (const DualQuaternion& other) const;
+
+        //! Will transform a 3d point (rotation, then translation)
+        Vector3d TransformPoint(const Vector3d& p) const;
+
+        //! Will transform a 3d direction (rotation only)
+        Vector3d TransformDirection(const Vector3d& dir) const;
+
+        //! Will return the inverse transformation. Assumes this DualQuaternion to be normalized
+        DualQuaternion Inverse() const;
+
+        //! Will return the (quaternion-)conjugate of both parts
+        DualQuaternion Conjugate() const;
+
+        //! Will return this DualQuaternion with a real part of unit length
+        DualQuaternion Normalize() const;
+
+        //! Will normalize this DualQuaternion
+        void NormalizeSelf();
+
+        //! Will return the rotation component
+        Quaternion GetRotation() const;
+
+        //! Will return the translation component
+        Vector3d GetTranslation() const;
+
+        //! Will return a Matrix4x4 representing the same rigid transformation
+        Matrix4x4 ToMatrix() const;
+
+        //! Will return the raw real part
+        const Vector4d& GetReal() const;
+
+        //! Will return the raw dual part
+        const Vector4d& GetDual() const;
+
+        //! Will set the raw values of both parts
+        void SetRawValues(const Vector4d real, const Vector4d dual);
+
+        //! Will return the normalized linear blend between two DualQuaternions (DLB).
+        //! Takes the shortest path.
+        DualQuaternion Lerp(const DualQuaternion& other, double t) const;
+
+        //! Will compare if two DualQuaternions describe a similar transformation, to a certain epsilon value
+        bool Similar(const DualQuaternion& other, double epsilon = 0.00001) const;
+
+        /** Up to four weighted bone influences of a single vertex, for DualQuaternion skinning.
+        * Unused slots should have a weight of 0. Their bone index still has to be valid.
+        * A vertex whose weights are all 0 (or blend to a zero rotation) is left unchanged by Skin().
+        */
+        struct BoneInfluence
+        {
+            std::array<std::size_t, 4> bones = { 0, 0, 0, 0 };
+            std::array<double, 4> weights = { 0, 0, 0, 0 };
+        };
+
+        //! Will skin a batch of vertices by dual quaternion linear blending (DLB).
+        //! Every vertex `i` gets transformed by the normalized, weighted blend of `palette[influences[i].bones[k]]`.
+        //! Processes four vertices at a time with intrinsics enabled.
+        //! Vertices without any weight get passed through unchanged.
+        //! `out` gets resized to `vertices.size()`. Throws std::invalid_argument if `influences` differs in size.
+        static void Skin(
+            const std::vector<Vector3d>& vertices,
+            const std::vector<BoneInfluence>& influences,
+            const std::vector<DualQuaternion>& palette,
+            std::vector<Vector3d>& out
+        );
+
+        friend std::ostream& operator<< (std::ostream& os, const DualQuaternion& dq);
+        friend std::wostream& operator<< (std::wostream& os, const DualQuaternion& dq);
+
+    private:
+        //! Real part. Represents the rotation
+        Vector4d real;
+
+        //! Dual part. Represents the translation
+        Vector4d dual;
+    };
+}
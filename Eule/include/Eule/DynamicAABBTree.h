@@ -0,0 +1,115 @@
+#pragma once
+#include "Eule/Collider.h"
+#include "Eule/Vector3.h"
+#include "Eule/AABB.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** A bounding volume hierarchy of axis-aligned bounding boxes, that can be updated incrementally.
+	* Each leaf stores a fat box (its bounds, enlarged by a margin) and an optional collider.
+	* Moving a leaf only touches the tree if its new bounds leave its fat box.
+	* Insertion, removal and moves take O(log n), as the tree gets kept balanced by rotations.
+	*
+	* Every inserted leaf gets a handle, which stays valid until it gets removed. Handles of removed leaves get reused.
+	* Nodes live in a pool, so no allocations happen once the pool has grown large enough.
+	*/
+	class DynamicAABBTree
+	{
+	public:
+		//! Constructs an empty tree. Inserted bounds get enlarged by `margin` on each side
+		explicit DynamicAABBTree(double margin = 0.1);
+
+		//! Will insert a leaf, and return its handle. `collider` may be nullptr.
+		//! The tree does not take ownership. The collider has to outlive the leaf.
+		std::size_t Insert(const AABB& bounds, const Collider* collider = nullptr);
+
+		//! Will remove a leaf
+		void Remove(std::size_t handle);
+
+		//! Will update the bounds of a leaf. Returns true, if it had to be re-inserted, because it left its fat box.
+		//! A re-inserted fat box also gets stretched by `displacement`, to anticipate further movement.
+		bool Move(std::size_t handle, const AABB& bounds, const Vector3d& displacement = Vector3d::zero);
+
+		//! Will return the fat box of a leaf
+		const AABB& GetFatBounds(std::size_t handle) const;
+
+		//! Will return the collider of a leaf
+		const Collider* GetCollider(std::size_t handle) const;
+
+		//! Will return the amount of leaves
+		std::size_t Size() const;
+
+		//! Will return the height of the tree. A single leaf has height 0
+		std::size_t GetHeight() const;
+
+		//! Will remove all leaves. Handles start at 0 again
+		void Clear();
+
+		//! Will append the handles of all leaves whose fat boxes overlap a box to `out`
+		void Query(const AABB& box, std::vector<std::size_t>& out) const;
+
+		//! Will append the handles of all leaves containing a point to `out`.
+		//! Leaves with a collider have to contain the point exactly. Leaves without one only by their fat box.
+		void FindContaining(const Vector3d& point, std::vector<std::size_t>& out) const;
+
+		//! Will append the handles of all leaves whose fat boxes get hit by a ray, within `0 <= t <= maxT`, to `out`
+		void Raycast(const Vector3d& origin, const Vector3d& direction, double maxT, std::vector<std::size_t>& out) const;
+
+		//! Will append each pair of leaves whose fat boxes overlap to `out`, once. The smaller handle comes first
+		void FindOverlappingPairs(std::vector<std::pair<std::size_t, std::size_t>>& out) const;
+
+		//! Marks the absence of a node
+		static constexpr std::size_t NULL_NODE = SIZE_MAX;
+
+	private:
+		struct Node
+		{
+			AABB bounds;
+			const Collider* collider = nullptr;
+
+			// Doubles as the next free node, while in the free list
+			std::size_t parent = NULL_NODE;
+			std::size_t left = NULL_NODE;
+			std::size_t right = NULL_NODE;
+
+			// Leaves have height 0. Free nodes have height -1
+			int height = -1;
+
+			bool IsLeaf() const
+			{
+				return left == NULL_NODE;
+			}
+		};
+
+		//! Will take a node from the pool, growing it if necessary
+		std::size_t AllocateNode();
+
+		//! Will return a node to the pool
+		void FreeNode(std::size_t node);
+
+		//! Will hook a leaf into the tree, next to the sibling that enlarges the least surface area
+		void InsertLeaf(std::size_t leaf);
+
+		//! Will unhook a leaf from the tree, without freeing it
+		void RemoveLeaf(std::size_t leaf);
+
+		//! Will walk from a node up to the root, refitting bounds and heights, and rotating unbalanced nodes
+		void Refit(std::size_t node);
+
+		//! Will rotate a node's taller child up, if its children differ in height by more than one. Returns the node now at its place
+		std::size_t Balance(std::size_t node);
+
+		//! Will call `visit(leaf)` for each leaf whose box passes `test(box)`
+		template <typename Test, typename Visit>
+		void Traverse(Test test, Visit visit) const;
+
+		std::vector<Node> nodes;
+		std::size_t root = NULL_NODE;
+		std::size_t freeList = NULL_NODE;
+		std::size_t leafCount = 0;
+		double margin;
+	};
+}
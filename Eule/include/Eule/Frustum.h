@@ -0,0 +1,133 @@
+#pragma once
+#include "Eule/Collider.h"
+#include "Eule/Vector3.h"
+#include "Eule/Matrix4x4.h"
+#include "Eule/AABB.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** A view frustum, described by six normalized planes.
+	* The planes get extracted from a view-projection Matrix4x4, assuming OpenGL-style clip space
+	* (everything in [-w, w] on all three axes is visible). Their normals point inwards.
+	* The planes are stored as structure-of-arrays, so that many objects can be culled at once.
+	*/
+	class Frustum : public Collider
+	{
+	public:
+		//! Constructs the frustum of an identity matrix (the cube [-1, 1]^3)
+		Frustum();
+
+		//! Constructs by extracting the planes of a view-projection matrix
+		explicit Frustum(const Matrix4x4& viewProjection);
+
+		Frustum(const Frustum& other) = default;
+		Frustum(Frustum&& other) noexcept = default;
+		void operator=(const Frustum& other);
+		void operator=(Frustum&& other) noexcept;
+
+		//! Will (re-)extract the planes of a view-projection matrix
+		void SetFromMatrix(const Matrix4x4& viewProjection);
+
+		//! Will return the (inwards-facing, normalized) normal of a plane
+		Vector3d GetPlaneNormal(std::size_t plane) const;
+
+		//! Will return the offset of a plane. A point p is on the inner side if `normal.DotProduct(p) + offset >= 0`
+		double GetPlaneOffset(std::size_t plane) const;
+
+		//! Will return one of the eight corners, where the planes meet.
+		//! Indexed like TrapazoidalPrismCollider vertices: `(near ? 4 : 0) | (right ? 2 : 0) | (top ? 1 : 0)`
+		const Vector3d& GetCorner(std::size_t index) const;
+
+		//! Tests, if this Frustum contains a point
+		bool Contains(const Vector3d& point) const override;
+
+		//! Will return the corner that lies furthest along a direction
+		Vector3d SupportPoint(const Vector3d& direction) const override;
+
+		//! Will append the indices of all frustums that contain a point to `out`. Does not dispatch virtually
+		static void Contains(
+			const std::vector<Frustum>& frustums,
+			const Vector3d& point,
+			std::vector<std::size_t>& out
+		);
+
+		//! Result of classifying a volume against this Frustum
+		enum class CLASSIFICATION : std::uint8_t
+		{
+			OUTSIDE = 0,
+			INTERSECTING = 1,
+			INSIDE = 2
+		};
+
+		//! Will classify a sphere against this Frustum
+		CLASSIFICATION ClassifySphere(const Vector3d& center, double radius) const;
+
+		//! Will classify an axis-aligned bounding box against this Frustum
+		CLASSIFICATION ClassifyAABB(const AABB& box) const;
+
+		//! Will classify a batch of spheres. Processes four spheres at a time with intrinsics enabled.
+		//! `out` gets resized to `centers.size()`. Throws std::invalid_argument if `radii` differs in size.
+		void ClassifySpheres(
+			const std::vector<Vector3d>& centers,
+			const std::vector<double>& radii,
+			std::vector<CLASSIFICATION>& out
+		) const;
+
+		//! Like ClassifySpheres(), but exploits temporal coherence:
+		//! `lastRejectingPlane[i]` remembers the plane that culled sphere `i` the last time, and gets tested first.
+		//! Objects that move little between frames will usually get culled by a single plane test.
+		//! `lastRejectingPlane` gets resized to `centers.size()`, if it does not match. New entries will be 0.
+		//! Existing entries have to be plane identifiers (< 6).
+		void ClassifySpheres(
+			const std::vector<Vector3d>& centers,
+			const std::vector<double>& radii,
+			std::vector<CLASSIFICATION>& out,
+			std::vector<std::uint8_t>& lastRejectingPlane
+		) const;
+
+		//! Will classify a batch of axis-aligned bounding boxes. Processes four boxes at a time with intrinsics enabled.
+		//! `out` gets resized to `boxes.size()`.
+		void ClassifyAABBs(
+			const std::vector<AABB>& boxes,
+			std::vector<CLASSIFICATION>& out
+		) const;
+
+		//! Like ClassifyAABBs(), but exploits temporal coherence. See ClassifySpheres()
+		void ClassifyAABBs(
+			const std::vector<AABB>& boxes,
+			std::vector<CLASSIFICATION>& out,
+			std::vector<std::uint8_t>& lastRejectingPlane
+		) const;
+
+		/* Plane identifiers */
+		static constexpr std::size_t LEFT = 0;
+		static constexpr std::size_t RIGHT = 1;
+		static constexpr std::size_t BOTTOM = 2;
+		static constexpr std::size_t TOP = 3;
+		static constexpr std::size_t FRONT = 4; // Near plane
+		static constexpr std::size_t BACK = 5; // Far plane
+
+	private:
+		//! Shared implementation of all batched classifications
+		template <bool isBox, bool isCoherent>
+		void Classify(
+			const Vector3d* centers,
+			const double* radii,
+			const AABB* boxes,
+			std::size_t count,
+			CLASSIFICATION* out,
+			std::uint8_t* lastRejectingPlane
+		) const;
+
+		// Plane equations, as structure-of-arrays
+		alignas(32) std::array<double, 6> nx;
+		alignas(32) std::array<double, 6> ny;
+		alignas(32) std::array<double, 6> nz;
+		alignas(32) std::array<double, 6> d;
+
+		std::array<Vector3d, 8> corners;
+	};
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "Eule/Vector3.h"
+#include <cstdint>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** A static kd-tree over a set of points, for nearest neighbour and radius searches.
+	* The tree is implicit: the points get reordered so that each range of the array is a subtree,
+	* whose middle element splits it along one axis. No nodes or pointers get stored, only one split axis per point.
+	* Each range gets split along the axis its points spread the most.
+	*
+	* Building takes O(n log n), with the upper levels split across threads.
+	* Queries are read-only, so any amount of threads may query the same tree at once.
+	* Results refer to points by their index in the vector the tree was built from.
+	*/
+	class KDTree
+	{
+	public:
+		//! Constructs an empty tree
+		KDTree() = default;
+
+		//! Will build a tree over a copy of `points`, on `threadCount` threads (0 means one per hardware thread)
+		explicit KDTree(const std::vector<Vector3d>& points, std::size_t threadCount = 1);
+
+		//! Will return the index of the point closest to `point`.
+		//! Throws std::logic_error if the tree is empty.
+		std::size_t Nearest(const Vector3d& point) const;
+
+		//! Will append the indices of the `k` points closest to `point` to `out`, nearest first.
+		//! If the tree holds fewer than `k` points, all of them get appended.
+		void KNearest(const Vector3d& point, std::size_t k, std::vector<std::size_t>& out) const;
+
+		//! Will append the indices of all points within `radius` of `center` to `out`, in no particular order
+		void Radius(const Vector3d& center, double radius, std::vector<std::size_t>& out) const;
+
+		//! Will find the nearest point for each query point, on `threadCount` threads (0 means one per hardware thread).
+		//! `out` gets resized to `queries.size()`.
+		//! Throws std::logic_error if the tree is empty.
+		void Nearest(const std::vector<Vector3d>& queries, std::vector<std::size_t>& out, std::size_t threadCount = 1) const;
+
+		//! Will find the `k` nearest points for each query point, on `threadCount` threads (0 means one per hardware thread).
+		//! `out` gets resized to `queries.size() * min(k, Size())`. The neighbours of query `i` start at `i * min(k, Size())`, nearest first.
+		void KNearest(const std::vector<Vector3d>& queries, std::size_t k, std::vector<std::size_t>& out, std::size_t threadCount = 1) const;
+
+		//! Will return the amount of points
+		std::size_t Size() const;
+
+		//! Ranges smaller than this get split by a single thread while building
+		static constexpr std::size_t MIN_POINTS_PER_THREAD = 16384;
+
+		//! Query points a thread has to get at least, for batched queries to spawn it
+		static constexpr std::size_t MIN_QUERIES_PER_THREAD = 256;
+
+	private:
+		//! A candidate neighbour, ordered by distance
+		struct Candidate
+		{
+			double sqrDistance;
+			std::size_t index;
+
+			bool operator<(const Candidate& other) const
+			{
+				return sqrDistance < other.sqrDistance;
+			}
+		};
+
+		//! Will turn the range [begin, end) into a subtree. Splits both halves on separate threads, while `threads > 1`
+		void Build(std::size_t begin, std::size_t end, std::size_t threads);
+
+		//! Will update the max-heap `heap` of the `k` best candidates, with those in the subtree [begin, end)
+		void SearchKNearest(std::size_t begin, std::size_t end, const Vector3d& point, std::size_t k, std::vector<Candidate>& heap) const;
+
+		//! Will append all points in the subtree [begin, end) within the squared radius to `out`
+		void SearchRadius(std::size_t begin, std::size_t end, const Vector3d& center, double sqrRadius, std::vector<std::size_t>& out) const;
+
+		//! The points, in tree order
+		std::vector<Vector3d> points;
+
+		//! The original index of each point, in tree order
+		std::vector<std::size_t> indices;
+
+		//! The axis each subtree gets split along, stored at its middle element
+		std::vector<std::uint8_t> axes;
+	};
+}
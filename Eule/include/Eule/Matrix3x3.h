@@ -0,0 +1,78 @@
+#pragma once
+#include "Eule/Matrix4x4.h"
+#include "Eule/Vector3.h"
+#include <array>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	class Quaternion;
+
+	/** A matrix 3x3 class, for rotation and scaling without translation.
+	* Indexed like the 3x3 component of a Matrix4x4: `myMatrix[y][x]`. Stores just its nine values, and computes
+	* determinant and inverse in closed form, instead of recursing through cofactors.
+	*/
+	class Matrix3x3
+	{
+	public:
+		//! Constructs the identity
+		Matrix3x3();
+
+		//! Constructs from the 3x3 component of a matrix
+		explicit Matrix3x3(const Matrix4x4& matrix);
+
+		//! Constructs the rotation matrix of a quaternion, like Quaternion::ToRotationMatrix()
+		explicit Matrix3x3(const Quaternion& rotation);
+
+		Matrix3x3(const Matrix3x3& other) = default;
+		Matrix3x3(Matrix3x3&& other) noexcept = default;
+		void operator=(const Matrix3x3& other);
+		void operator=(Matrix3x3&& other) noexcept;
+
+		//! Array holding the matrices values
+		std::array<std::array<double, 3>, 3> v;
+
+		//! Will return this matrix as the 3x3 component of a Matrix4x4, without translation
+		Matrix4x4 ToMatrix4x4() const;
+
+		//! Will return the quaternion of a rotation matrix. The inverse of Matrix3x3(const Quaternion&).
+		//! This matrix has to be orthonormal, with a determinant of 1
+		Quaternion ToQuaternion() const;
+
+		Matrix3x3 operator*(const Matrix3x3& other) const;
+		void operator*=(const Matrix3x3& other);
+
+		//! Will transform a vector, like `vector * matrix` does for the 3x3 component of a Matrix4x4
+		Vector3d TransformVector(const Vector3d& vec) const;
+
+		//! Will return the transpose of this matrix
+		Matrix3x3 Transpose() const;
+
+		//! Will return the determinant
+		double Determinant() const;
+
+		//! Will return the inverse of this matrix.
+		//! Throws std::runtime_error if it is not inversible.
+		Matrix3x3 Inverse() const;
+
+		//! Will check if this matrix is inversible
+		bool IsInversible() const;
+
+		//! Will multiply matrices pairwise. `out` gets resized to `a.size()`. Processes four pairs at a time with intrinsics enabled.
+		//! Throws std::invalid_argument if `b` differs in size.
+		static void Multiply(const std::vector<Matrix3x3>& a, const std::vector<Matrix3x3>& b, std::vector<Matrix3x3>& out);
+
+		//! Will invert many matrices. `out` gets resized to `matrices.size()`. Processes four matrices at a time with intrinsics enabled.
+		//! Throws std::runtime_error if any of them is not inversible.
+		static void Inverse(const std::vector<Matrix3x3>& matrices, std::vector<Matrix3x3>& out);
+
+		std::array<double, 3>& operator[](std::size_t y);
+		const std::array<double, 3>& operator[](std::size_t y) const;
+
+		bool operator==(const Matrix3x3& other) const;
+		bool operator!=(const Matrix3x3& other) const;
+
+		//! Will compare if two matrices are similar to a certain epsilon value
+		bool Similar(const Matrix3x3& other, double epsilon = 0.00001) const;
+	};
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include "Eule/Matrix4x4.h"
+#include "Eule/Vector3.h"
+#include <cstdint>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** Decompositions of the 3x3 component of Matrix4x4's.
+	* Eigenvectors come from a fixed amount of cyclic Jacobi sweeps, and the SVD follows McAdams et al.,
+	* "Computing the Singular Value Decomposition of 3x3 matrices with minimal branching":
+	* the eigenvectors of A^T A give V, and a Givens QR decomposition of A*V gives U and the singular values.
+	* Neither loops until convergence, nor branches on the input, so batches run four matrices at once with intrinsics enabled.
+	*
+	* All returned matrices only use their 3x3 component. The rest is that of the identity.
+	*/
+	class MatrixDecomposition
+	{
+	public:
+		//! Will decompose a symmetric matrix into `symmetric = eigenvectors * diag(eigenvalues) * eigenvectors^T`.
+		//! `eigenvectors` holds one eigenvector per column, and is a rotation. Eigenvalues get sorted in descending order.
+		//! Only the upper triangle of `symmetric` gets read.
+		static void SymmetricEigen(const Matrix4x4& symmetric, Vector3d& eigenvalues, Matrix4x4& eigenvectors);
+
+		//! Like SymmetricEigen(), but for many matrices, on `threadCount` threads (0 means one per hardware thread).
+		//! The output vectors get resized to the amount of matrices.
+		static void SymmetricEigen(
+			const std::vector<Matrix4x4>& symmetric,
+			std::vector<Vector3d>& eigenvalues,
+			std::vector<Matrix4x4>& eigenvectors,
+			std::size_t threadCount = 1
+		);
+
+		//! Will decompose a matrix into `matrix = u * diag(sigma) * v^T`, with `u` and `v` being rotations.
+		//! Singular values are sorted by magnitude, in descending order. To keep `u` and `v` rotations,
+		//! sigma.z carries the sign of the determinant. The others are never negative.
+		static void SVD(const Matrix4x4& matrix, Matrix4x4& u, Vector3d& sigma, Matrix4x4& v);
+
+		//! Like SVD(), but for many matrices, on `threadCount` threads (0 means one per hardware thread).
+		//! The output vectors get resized to the amount of matrices.
+		static void SVD(
+			const std::vector<Matrix4x4>& matrices,
+			std::vector<Matrix4x4>& u,
+			std::vector<Vector3d>& sigma,
+			std::vector<Matrix4x4>& v,
+			std::size_t threadCount = 1
+		);
+
+		//! Will decompose a matrix into `matrix = rotation * stretch`, with `stretch` being symmetric.
+		//! `rotation` is always a rotation. For matrices with a negative determinant, `stretch` takes up the reflection.
+		static void Polar(const Matrix4x4& matrix, Matrix4x4& rotation, Matrix4x4& stretch);
+
+		//! Sweeps over all three off-diagonal elements. Jacobi converges quadratically, so these are plenty for doubles
+		static constexpr std::size_t JACOBI_SWEEPS = 6;
+
+		//! Matrices a thread has to get at least, for batches to spawn it
+		static constexpr std::size_t MIN_MATRICES_PER_THREAD = 4096;
+
+	private:
+		// No instanciation! >:(
+		MatrixDecomposition();
+	};
+}
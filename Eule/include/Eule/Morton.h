@@ -0,0 +1,97 @@
+#pragma once
+#include "Eule/Vector2.h"
+#include "Eule/Vector3.h"
+#include "Eule/AABB.h"
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** Morton (Z-order) codes, which interleave the bits of coordinates.
+	* Sorting points by their code keeps points that are close in space mostly close in memory.
+	*
+	* 2d codes hold 32 bits per component, 3d codes 21 bits. Signed components get biased, so that the order along each axis is kept.
+	* Doubles get quantized onto a grid of 2^21 cells per axis, spanning a bounding box.
+	*
+	* With intrinsics enabled, interleaving uses BMI2 (pdep/pext) where available, and batches get quantized and interleaved four at a time.
+	*/
+	class Morton
+	{
+	public:
+		//! Will return the code of a 2d cell. Covers all of int
+		static std::uint64_t Encode(const Vector2i& cell);
+
+		//! Will return the code of a 3d cell. Each component has to lie within [-2^20, 2^20). Other bits get cut off
+		static std::uint64_t Encode(const Vector3i& cell);
+
+		//! Will return the code of the grid cell a point lies in. The grid spans `bounds`. Points outside get clamped onto it
+		static std::uint64_t Encode(const Vector3d& point, const AABB& bounds);
+
+		//! Will compute the code of each point. `out` gets resized to `points.size()`. See Encode()
+		static void Encode(const std::vector<Vector3d>& points, const AABB& bounds, std::vector<std::uint64_t>& out);
+
+		//! Will return the 2d cell of a code
+		static Vector2i Decode2(std::uint64_t code);
+
+		//! Will return the 3d cell of a code
+		static Vector3i Decode3(std::uint64_t code);
+
+		//! Will return the center of the grid cell a code refers to. The grid spans `bounds`
+		static Vector3d Decode(std::uint64_t code, const AABB& bounds);
+
+		//! Will sort codes ascending, by a least-significant-digit radix sort, on `threadCount` threads (0 means one per hardware thread).
+		//! `permutation` gets resized to `codes.size()`. Afterwards, `permutation[i]` is where the i-th sorted code was before.
+		//! The sort is stable, and its result does not depend on the amount of threads.
+		static void Sort(std::vector<std::uint64_t>& codes, std::vector<std::size_t>& permutation, std::size_t threadCount = 1);
+
+		//! Will reorder values, such that `values[i]` becomes what was `values[permutation[i]]`.
+		//! Throws std::invalid_argument if the sizes differ.
+		template <typename T>
+		static void Permute(std::vector<T>& values, const std::vector<std::size_t>& permutation)
+		{
+			if (values.size() != permutation.size())
+				throw std::invalid_argument("The permutation has to be as long as the values!");
+
+			std::vector<T> permuted;
+			permuted.reserve(values.size());
+			for (std::size_t i : permutation)
+				permuted.push_back(std::move(values[i]));
+
+			values = std::move(permuted);
+
+			return;
+		}
+
+		//! Will reorder points by their code within their own bounds, and a payload along with them.
+		//! Throws std::invalid_argument if the payload differs in size.
+		template <typename Payload>
+		static void Sort(std::vector<Vector3d>& points, std::vector<Payload>& payload, std::size_t threadCount = 1)
+		{
+			if (payload.size() != points.size())
+				throw std::invalid_argument("The payload has to be as long as the points!");
+
+			std::vector<std::size_t> permutation;
+			SortPoints(points, permutation, threadCount);
+			Permute(payload, permutation);
+
+			return;
+		}
+
+		//! Will reorder points by their code within their own bounds
+		static void Sort(std::vector<Vector3d>& points, std::size_t threadCount = 1);
+
+		//! Cells per axis of 3d codes
+		static constexpr std::uint64_t CELLS_3D = 1ull << 21;
+
+		//! Codes a thread has to get at least, for Sort() to spawn it
+		static constexpr std::size_t MIN_CODES_PER_THREAD = 65536;
+
+	private:
+		//! Will reorder points by their code within their own bounds, and return the permutation applied
+		static void SortPoints(std::vector<Vector3d>& points, std::vector<std::size_t>& permutation, std::size_t threadCount);
+
+		// No instanciation! >:(
+		Morton();
+	};
+}
@@ -0,0 +1,105 @@
+#pragma once
+#include "Eule/Collider.h"
+#include "Eule/TrapazoidalPrismCollider.h"
+#include "Eule/Vector3.h"
+#include "Eule/Matrix4x4.h"
+#include "Eule/AABB.h"
+#include <array>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** An oriented bounding box: a box with a center, half its size along each of its local axes, and a rotation.
+	* Boxes fitted around point sets usually enclose them far tighter than axis-aligned ones, if the points are rotated.
+	*
+	* Local axes are the columns of the rotation's 3x3 component. The rotation has to be orthonormal.
+	*/
+	class OBB : public Collider
+	{
+	public:
+		//! Constructs the cube [-1, 1]^3
+		OBB();
+
+		//! Constructs a box from its center, half its size along each local axis, and its rotation.
+		//! Throws std::invalid_argument if any component of `halfSize` is negative.
+		OBB(const Vector3d& center, const Vector3d& halfSize, const Matrix4x4& rotation = Matrix4x4());
+
+		//! Constructs a box covering the same space as an axis-aligned one
+		explicit OBB(const AABB& box);
+
+		OBB(const OBB& other) = default;
+		OBB(OBB&& other) noexcept = default;
+		void operator=(const OBB& other);
+		void operator=(OBB&& other) noexcept;
+
+		//! Will fit a box around points, on `threadCount` threads (0 means one per hardware thread).
+		//! Starts out with the principal axes of the points. Then, keeping one of those axes at a time, the other two get rotated
+		//! to enclose the points' projection onto their plane in the smallest rectangle (rotating calipers). The smallest box wins.
+		//! Throws std::invalid_argument if `points` is empty.
+		static OBB Fit(const std::vector<Vector3d>& points, std::size_t threadCount = 1);
+
+		//! Will return the center
+		const Vector3d& GetCenter() const;
+
+		//! Will set the center
+		void SetCenter(const Vector3d& center);
+
+		//! Will return half the size along each local axis
+		const Vector3d& GetHalfSize() const;
+
+		//! Will set half the size along each local axis.
+		//! Throws std::invalid_argument if any component is negative.
+		void SetHalfSize(const Vector3d& halfSize);
+
+		//! Will return the rotation. Its 3x3 component holds the local axes as columns
+		Matrix4x4 GetRotation() const;
+
+		//! Will set the rotation, taking the local axes from the columns of its 3x3 component
+		void SetRotation(const Matrix4x4& rotation);
+
+		//! Will return a local axis (0 = x, 1 = y, 2 = z)
+		const Vector3d& GetAxis(std::size_t axis) const;
+
+		//! Will return one of the eight corners.
+		//! Indexed like TrapazoidalPrismCollider vertices: `(front ? 4 : 0) | (right ? 2 : 0) | (top ? 1 : 0)`, along the local z, x and y axes
+		Vector3d GetCorner(std::size_t index) const;
+
+		//! Will return the volume
+		double GetVolume() const;
+
+		//! Will return the smallest axis-aligned box enclosing this one
+		AABB GetBounds() const;
+
+		//! Will return a prism with the same eight vertices, so that code dealing with prisms can use this box
+		TrapazoidalPrismCollider ToPrism() const;
+
+		//! Tests, if this box contains a point
+		bool Contains(const Vector3d& point) const override;
+
+		//! Will append the indices of all points contained by this box to `out`. Processes four points at a time with intrinsics enabled.
+		void Contains(const std::vector<Vector3d>& points, std::vector<std::size_t>& out) const;
+
+		//! Will return the corner that lies furthest along a direction
+		Vector3d SupportPoint(const Vector3d& direction) const override;
+
+		//! Will return the exact distance of a point to the surface of this box. It is negative for points inside.
+		double SignedDistance(const Vector3d& point) const override;
+
+		//! Will return the point of this box closest to a given point. Points inside are their own closest point.
+		Vector3d ClosestPoint(const Vector3d& point) const override;
+
+		//! Tests, if two boxes overlap, using the separating axis theorem with 15 candidate axes. Touching counts as overlapping.
+		bool Intersects(const OBB& other) const;
+
+		//! Will append the indices of all boxes overlapping this one to `out`. Tests four boxes at a time with intrinsics enabled.
+		void Intersects(const std::vector<OBB>& others, std::vector<std::size_t>& out) const;
+
+		//! Points a thread has to get at least, for Fit() to spawn it
+		static constexpr std::size_t MIN_POINTS_PER_THREAD = 65536;
+
+	private:
+		Vector3d center;
+		Vector3d halfSize;
+		std::array<Vector3d, 3> axes;
+	};
+}
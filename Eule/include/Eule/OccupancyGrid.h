@@ -0,0 +1,79 @@
+#pragma once
+#include "Eule/TrapazoidalPrismCollider.h"
+#include "Eule/Vector3.h"
+#include "Eule/AABB.h"
+#include <cstdint>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** A voxelization of prisms, for containment tests in constant time.
+	* Each voxel of a regular grid is either fully inside a prism, touched by the surface of one (boundary),
+	* or outside all of them. Both states get stored as one bit per voxel.
+	*
+	* Containment only needs exact tests against the prisms for points in boundary voxels, or outside the grid.
+	* The classification is conservative: a voxel is only inside or outside, if it is so entirely.
+	*
+	* Added prisms get copied.
+	*/
+	class OccupancyGrid
+	{
+	public:
+		/* Voxel states */
+		enum class STATE
+		{
+			OUTSIDE = 0,
+			INSIDE = 1,
+			BOUNDARY = 2
+		};
+
+		//! Constructs an empty grid of cubic voxels with edge length `voxelSize`, covering at least `bounds`.
+		//! Throws std::invalid_argument if `voxelSize` is not positive, or `bounds` is inverted.
+		OccupancyGrid(const AABB& bounds, double voxelSize);
+
+		//! Will rasterize a prism into the grid
+		void Add(const TrapazoidalPrismCollider& prism);
+
+		//! Will rasterize many prisms into the grid
+		void Add(const std::vector<TrapazoidalPrismCollider>& prisms);
+
+		//! Will return the state of a voxel.
+		//! Throws std::out_of_range if the voxel is not part of the grid.
+		STATE GetState(const Vector3i& voxel) const;
+
+		//! Will return the voxel containing a point. It may lie outside the grid
+		Vector3i VoxelOf(const Vector3d& point) const;
+
+		//! Tests, if a voxel is part of the grid
+		bool IsInGrid(const Vector3i& voxel) const;
+
+		//! Tests, if any added prism contains a point
+		bool Contains(const Vector3d& point) const;
+
+		//! Will append the indices of all points contained by any added prism to `out`
+		void Contains(const std::vector<Vector3d>& points, std::vector<std::size_t>& out) const;
+
+		//! Will return the amount of voxels along each axis
+		const Vector3i& GetDimensions() const;
+
+		//! Will return the amount of voxels in a state
+		std::size_t Count(STATE state) const;
+
+	private:
+		//! Will test a point against all prisms exactly
+		bool ContainsExact(const Vector3d& point) const;
+
+		std::size_t IndexOf(const Vector3i& voxel) const;
+
+		AABB bounds;
+		double voxelSize;
+		Vector3i dimensions;
+
+		// One bit per voxel, indexed by x + dimensions.x * (y + dimensions.y * z)
+		std::vector<std::uint64_t> insideBits;
+		std::vector<std::uint64_t> boundaryBits;
+
+		std::vector<TrapazoidalPrismCollider> prisms;
+		std::vector<AABB> prismBounds;
+	};
+}
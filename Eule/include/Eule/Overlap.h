@@ -0,0 +1,54 @@
+#pragma once
+#include "Eule/Collider.h"
+#include "Eule/TrapazoidalPrismCollider.h"
+#include "Eule/Vector3.h"
+#include <utility>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** Overlap tests between pairs of convex colliders
+	*/
+	class Overlap
+	{
+	public:
+		//! Tests, if two prisms overlap, using the separating axis theorem. Touching counts as overlapping.
+		//! The candidate axes are the face normals of both prisms, and the cross products of all their edge pairs.
+		static bool SAT(const TrapazoidalPrismCollider& a, const TrapazoidalPrismCollider& b);
+
+		//! Will append the index of each pair of prisms that overlaps to `out`.
+		//! A pair references two entries of `colliders`. Each prism gets prepared just once, no matter how many pairs it is part of.
+		//! With intrinsics enabled, four candidate axes get tested at a time.
+		//! Throws std::out_of_range if a pair references a collider that does not exist.
+		static void SAT(
+			const std::vector<TrapazoidalPrismCollider>& colliders,
+			const std::vector<std::pair<std::size_t, std::size_t>>& pairs,
+			std::vector<std::size_t>& out
+		);
+
+		//! Tests, if two convex colliders overlap, using the Gilbert-Johnson-Keerthi algorithm.
+		//! Colliders that merely touch may be reported either way.
+		//! Both colliders have to implement Collider::SupportPoint().
+		static bool GJK(const Collider& a, const Collider& b);
+
+		//! Will append the index of each pair of colliders that overlaps to `out`. See GJK()
+		//! Throws std::out_of_range if a pair references a collider that does not exist.
+		static void GJK(
+			const std::vector<const Collider*>& colliders,
+			const std::vector<std::pair<std::size_t, std::size_t>>& pairs,
+			std::vector<std::size_t>& out
+		);
+
+		//! Like GJK(), but if the colliders overlap, it will also find their penetration, using the expanding polytope algorithm.
+		//! Translating `b` by `normal * depth` separates them. `normal` is normalized, and points from `a` towards `b`.
+		//! `normal` and `depth` are only written to, if the colliders overlap.
+		static bool EPA(const Collider& a, const Collider& b, Vector3d& normal, double& depth);
+
+		//! Upper bound of GJK and EPA iterations
+		static constexpr std::size_t MAX_ITERATIONS = 64;
+
+	private:
+		// No instanciation! >:(
+		Overlap();
+	};
+}
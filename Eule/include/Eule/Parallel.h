@@ -0,0 +1,58 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** Helpers for splitting loops across threads.
+	* Work gets split into contiguous chunks, one per thread, so results written by index come out
+	* the same, no matter how many threads ran.
+	*/
+	class Parallel
+	{
+	public:
+		//! Will return the amount of threads to use for `requested` threads, where 0 means one per hardware thread
+		static std::size_t ThreadCount(std::size_t requested)
+		{
+			if (requested == 0)
+				return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+			return requested;
+		}
+
+		//! Will return the amount of chunks to split `count` elements into, for up to `threadCount` threads (0 means one per hardware thread),
+		//! with every chunk getting at least `minPerThread` elements. It is at least 1
+		static std::size_t ChunkCount(std::size_t count, std::size_t threadCount, std::size_t minPerThread)
+		{
+			return std::max<std::size_t>(1, std::min(ThreadCount(threadCount), count / std::max<std::size_t>(minPerThread, 1)));
+		}
+
+		//! Will call `body(begin, end)` for contiguous chunks covering [0, count), on up to `threadCount` threads (0 means one per hardware thread).
+		//! Every thread gets at least `minPerThread` elements, so small loops don't pay for spawning threads.
+		//! The calling thread processes the first chunk itself.
+		template <typename Body>
+		static void For(std::size_t count, std::size_t threadCount, std::size_t minPerThread, Body body)
+		{
+			threadCount = ChunkCount(count, threadCount, minPerThread);
+
+			const std::size_t chunkSize = (count + threadCount - 1) / threadCount;
+
+			std::vector<std::thread> threads;
+			for (std::size_t t = 1; t < threadCount; t++)
+				threads.emplace_back(body, std::min(t * chunkSize, count), std::min((t + 1) * chunkSize, count));
+
+			body(0, std::min(chunkSize, count));
+
+			for (std::thread& thread : threads)
+				thread.join();
+
+			return;
+		}
+
+	private:
+		// No instanciation! >:(
+		Parallel();
+	};
+}
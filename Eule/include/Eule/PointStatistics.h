@@ -0,0 +1,46 @@
+#pragma once
+#include "Eule/Vector3.h"
+#include "Eule/Matrix4x4.h"
+#include "Eule/AABB.h"
+#include <cstdint>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** Reductions over point arrays: bounds, centroid and covariance.
+	* Points get reduced in fixed-size blocks, four at a time with intrinsics enabled. The blocks' results then get combined pairwise,
+	* in a fixed order. Threads only decide who reduces which blocks, so results are bit-identical for any amount of threads.
+	*
+	* Each block accumulates its covariance around its own mean, and blocks get merged like in Welford's algorithm (Chan et al.),
+	* so large offsets of the points from the origin don't cost precision.
+	*/
+	class PointStatistics
+	{
+	public:
+		//! Will return the smallest box containing all points, on `threadCount` threads (0 means one per hardware thread).
+		//! Throws std::invalid_argument if `points` is empty.
+		static AABB Bounds(const std::vector<Vector3d>& points, std::size_t threadCount = 1);
+
+		//! Will return the mean of all points.
+		//! Throws std::invalid_argument if `points` is empty.
+		static Vector3d Centroid(const std::vector<Vector3d>& points, std::size_t threadCount = 1);
+
+		//! Will return the covariance matrix of all points, divided by their amount, in the upper left 3x3 of the matrix.
+		//! The rest of the matrix is that of the identity.
+		//! Throws std::invalid_argument if `points` is empty.
+		static Matrix4x4 Covariance(const std::vector<Vector3d>& points, std::size_t threadCount = 1);
+
+		//! Like Covariance(), but also writes the centroid, which it computes on the way
+		static Matrix4x4 Covariance(const std::vector<Vector3d>& points, Vector3d& centroid, std::size_t threadCount = 1);
+
+		//! Points reduced per block. Fixed, so that results don't depend on the amount of threads
+		static constexpr std::size_t BLOCK_SIZE = 4096;
+
+		//! Blocks a thread has to get at least, to get spawned
+		static constexpr std::size_t MIN_BLOCKS_PER_THREAD = 16;
+
+	private:
+		// No instanciation! >:(
+		PointStatistics();
+	};
+}
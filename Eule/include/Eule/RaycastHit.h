@@ -0,0 +1,22 @@
+#pragma once
+#include "Eule/Vector3.h"
+
+namespace Leonetienne::Eule
+{
+	/** Trivial data structure describing where a ray hit a shape
+	*/
+	struct RaycastHit
+	{
+		//! Distance along the ray, in multiples of its direction vector. Infinity, if nothing was hit
+		double t;
+
+		//! The point that was hit
+		Vector3d point;
+
+		//! Outwards-facing, normalized surface normal at the point that was hit
+		Vector3d normal;
+
+		//! Shape-specific identifier of the face that was hit
+		std::size_t face;
+	};
+}
@@ -0,0 +1,118 @@
+#pragma once
+#include "Eule/Vector3.h"
+#include "Eule/AABB.h"
+#include <cstdint>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** A uniform grid of cubic cells, of which only the occupied ones are stored, in a hash table.
+	* Stores ids of points, or of bounding boxes (like those of colliders), in each cell they cover.
+	*
+	* The table uses open addressing with linear probing, keyed by std::hash<Vector3i>.
+	* The entries of each cell form a linked list through one flat array, so inserting never allocates per entry,
+	* and both arrays only ever grow by doubling.
+	*
+	* Boxes covering multiple cells get reported just once per query.
+	*
+	* Inserted points, divided by the cell size, have to lie within +-MAX_CELL_COORDINATE on each axis.
+	* Queries reaching beyond that range get clamped to it, as nothing can be stored outside of it.
+	*/
+	class SpatialHashGrid
+	{
+	public:
+		//! Constructs an empty grid with cubic cells of edge length `cellSize`.
+		//! Throws std::invalid_argument if `cellSize` is not positive.
+		explicit SpatialHashGrid(double cellSize);
+
+		//! Will insert a point with an id.
+		//! Throws std::invalid_argument if the point is not finite, or outside of the grid's range.
+		void Insert(const Vector3d& point, std::size_t id);
+
+		//! Will insert a box with an id, into every cell it touches.
+		//! Throws std::invalid_argument if the box is not finite, outside of the grid's range, or covers more than MAX_CELLS_PER_BOX cells.
+		void Insert(const AABB& bounds, std::size_t id);
+
+		//! Will insert many points. Point `i` gets id `firstId + i`.
+		//! Reserves space for all of them up front.
+		void Insert(const std::vector<Vector3d>& points, std::size_t firstId = 0);
+
+		//! Will reserve space for `count` items, spread over about as many cells
+		void Reserve(std::size_t count);
+
+		//! Will append the ids of all items in the cells from `minCell` to `maxCell` (inclusive) to `out`
+		void QueryCells(const Vector3i& minCell, const Vector3i& maxCell, std::vector<std::size_t>& out) const;
+
+		//! Will append the ids of all items within `radius` of a point to `out`. Boxes count if any part of them is within `radius`.
+		//! Throws std::invalid_argument if `center` or `radius` is NaN.
+		void QueryRadius(const Vector3d& center, double radius, std::vector<std::size_t>& out) const;
+
+		//! Will return the cell containing a point.
+		//! Throws std::invalid_argument if the point is not finite, or outside of the grid's range.
+		Vector3i CellOf(const Vector3d& point) const;
+
+		//! Will return the edge length of the cells
+		double GetCellSize() const;
+
+		//! Will return the amount of inserted items
+		std::size_t Size() const;
+
+		//! Will return the amount of occupied cells
+		std::size_t CellCount() const;
+
+		//! Will remove all items
+		void Clear();
+
+		//! Marks the end of a cell's list of entries
+		static constexpr std::uint32_t NULL_ENTRY = UINT32_MAX;
+
+		//! The largest absolute cell coordinate. Far enough from INT_MAX for cell loops to never overflow
+		static constexpr int MAX_CELL_COORDINATE = 1 << 30;
+
+		//! The most cells a single box may cover
+		static constexpr std::size_t MAX_CELLS_PER_BOX = 1 << 20;
+
+	private:
+		struct Slot
+		{
+			Vector3i cell;
+			std::uint32_t head = NULL_ENTRY;
+		};
+
+		struct Entry
+		{
+			std::uint32_t item;
+			std::uint32_t next;
+		};
+
+		struct Item
+		{
+			AABB bounds;
+			Vector3i minCell;
+			Vector3i maxCell;
+			std::size_t id;
+		};
+
+		//! Will return the cell containing a point, clamped into the grid's range. Throws std::invalid_argument if the point is NaN
+		Vector3i ClampedCellOf(const Vector3d& point) const;
+
+		//! Will insert an item into all cells it covers
+		void InsertItem(const Item& item);
+
+		//! Will return the slot of a cell, or an empty slot if it is not occupied
+		std::size_t FindSlot(const Vector3i& cell) const;
+
+		//! Will resize the table to `capacity` slots (a power of two), and re-insert all occupied ones
+		void Rehash(std::size_t capacity);
+
+		//! Will call `visit(item)` once for each item in the cells from `minCell` to `maxCell`
+		template <typename Visit>
+		void ForEachItem(const Vector3i& minCell, const Vector3i& maxCell, Visit visit) const;
+
+		std::vector<Slot> slots;
+		std::vector<Entry> entries;
+		std::vector<Item> items;
+		std::size_t occupiedSlots = 0;
+		double cellSize;
+	};
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include "Eule/TrapazoidalPrismCollider.h"
+#include "Eule/AABB.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** A sort-and-sweep broadphase for prisms.
+	* The start- and end points of all bounding boxes along the x axis are kept in one sorted array.
+	* Sweeping along it, only boxes whose x intervals overlap get compared in y and z.
+	*
+	* Between updates, the array gets re-sorted by insertion sort. As long as colliders move little per update,
+	* it is nearly sorted already, so this takes close to linear time.
+	*
+	* Colliders are referenced, not copied. Their bounds get re-read from their vertices by Update().
+	* Every added collider gets a handle, which stays valid until it gets removed. Handles of removed colliders get reused.
+	*/
+	class SweepAndPrune
+	{
+	public:
+		//! Will add a collider, and return its handle.
+		//! The broadphase does not take ownership. The collider has to outlive its entry.
+		std::size_t Add(const TrapazoidalPrismCollider& collider);
+
+		//! Will remove a collider.
+		//! Throws std::out_of_range if the handle is invalid.
+		void Remove(std::size_t handle);
+
+		//! Will re-read the bounds of all colliders, and re-sort the endpoints.
+		//! Returns the amount of swaps the insertion sort needed, which is a measure of how much the order changed.
+		std::size_t Update();
+
+		//! Will return the bounds of a collider, as of the last update.
+		//! Throws std::out_of_range if the handle is invalid.
+		const AABB& GetBounds(std::size_t handle) const;
+
+		//! Will return the amount of colliders
+		std::size_t Size() const;
+
+		//! Will remove all colliders. Handles start at 0 again
+		void Clear();
+
+		//! Will append each pair of colliders whose bounds overlap to `out`, once. The smaller handle comes first.
+		//! Touching bounds count as overlapping.
+		void FindOverlappingPairs(std::vector<std::pair<std::size_t, std::size_t>>& out) const;
+
+		//! Will append each pair of colliders that actually overlaps to `out`, as found by Overlap::SAT(). The smaller handle comes first.
+		//! The pairs get tested on `threadCount` threads, where 0 means one per hardware thread.
+		//! The result does not depend on the amount of threads.
+		void FindCollidingPairs(std::vector<std::pair<std::size_t, std::size_t>>& out, std::size_t threadCount = 1) const;
+
+		//! Pairs a thread has to get at least, for FindCollidingPairs() to spawn it
+		static constexpr std::size_t MIN_PAIRS_PER_THREAD = 64;
+
+	private:
+		struct Proxy
+		{
+			const TrapazoidalPrismCollider* collider = nullptr;
+			AABB bounds;
+		};
+
+		struct Endpoint
+		{
+			double value;
+			std::size_t proxy;
+			bool isMin;
+
+			//! Start points sort before end points of the same value, so touching intervals overlap
+			bool operator<(const Endpoint& other) const
+			{
+				return (value < other.value) || ((value == other.value) && isMin && !other.isMin);
+			}
+		};
+
+		//! Will move the endpoint at `index` towards the front, until it is in order. Returns the amount of swaps
+		std::size_t SiftDown(std::size_t index);
+
+		//! Will throw std::out_of_range if a handle is invalid
+		void CheckHandle(std::size_t handle) const;
+
+		std::vector<Proxy> proxies;
+		std::vector<std::size_t> freeHandles;
+		std::vector<Endpoint> endpoints;
+	};
+}
@@ -1,7 +1,11 @@
 #pragma once
 #include "Eule/Vector3.h"
+#include "Eule/Matrix4x4.h"
 #include "Eule/Collider.h"
+#include "Eule/RaycastHit.h"
+#include "Eule/AABB.h"
 #include <array>
+#include <vector>
 
 namespace Leonetienne::Eule
 {
@@ -9,10 +13,23 @@ namespace Leonetienne::Eule
 	* A trapazoidal prism is basically a box, but each vertex can be manipulated individually, altering
 	* the angles between faces.
 	* Distorting a 2d face into 3d space will result in undefined behaviour. Each face should stay flat, relative to itself. This shape is based on QUADS!
+	*
+	* Face normals get regenerated whenever vertices change, so queries never write, and may run on multiple threads at once.
 	*/
 	class TrapazoidalPrismCollider : public Collider
 	{
 	public:
+		/* Face identifiers */
+		enum class FACE_NORMALS : std::size_t
+		{
+			LEFT = 0,
+			RIGHT = 1,
+			FRONT = 2,
+			BACK = 3,
+			TOP = 4,
+			BOTTOM = 5
+		};
+
 		TrapazoidalPrismCollider();
 		TrapazoidalPrismCollider(const TrapazoidalPrismCollider& other) = default;
 		TrapazoidalPrismCollider(TrapazoidalPrismCollider&& other) noexcept = default;
@@ -22,12 +39,86 @@ namespace Leonetienne::Eule
 		//! Will return a specific vertex
 		const Vector3d& GetVertex(std::size_t index) const;
 
-		//! Will set the value of a specific vertex
+		//! Will return the smallest axis-aligned box enclosing all vertices
+		AABB GetBounds() const;
+
+		//! Will set the value of a specific vertex.
+		//! Regenerates only the normals of the three faces the vertex lies on, so moving all vertices one by one costs about as much as SetVertices()
 		void SetVertex(std::size_t index, const Vector3d value);
 
+		//! Will set all vertices at once, indexed by vertex identifiers. Regenerates the face normals just once
+		void SetVertices(const std::array<Vector3d, 8>& values);
+
+		//! Will transform all vertices by a matrix.
+		//! The face normals get transformed along with them, instead of being regenerated from cross products.
+		void TransformBy(const Matrix4x4& transform);
+
+		//! Will transform many colliders by the same matrix. See TransformBy()
+		static void TransformBy(std::vector<TrapazoidalPrismCollider>& colliders, const Matrix4x4& transform);
+
+		//! Will transform each collider by its own matrix. See TransformBy()
+		//! Throws std::invalid_argument if `transforms` differs in size.
+		static void TransformBy(std::vector<TrapazoidalPrismCollider>& colliders, const std::vector<Matrix4x4>& transforms);
+
+		//! Will return the (inwards-facing, not normalized) normal of a face
+		const Vector3d& GetFaceNormal(FACE_NORMALS face) const;
+
+		//! Will return the offset of a face's plane. A point p is on the inner side if `normal.DotProduct(p) + offset >= 0`
+		double GetFaceOffset(FACE_NORMALS face) const;
+
 		//! Tests, if this Collider contains a point
 		bool Contains(const Vector3d& point) const override;
 
+		//! Will return the vertex that lies furthest along a direction
+		Vector3d SupportPoint(const Vector3d& direction) const override;
+
+		//! Will return the exact distance of a point to the surface of this collider. It is negative for points inside.
+		double SignedDistance(const Vector3d& point) const override;
+
+		//! Will return the point of this collider closest to a given point. Points inside are their own closest point.
+		Vector3d ClosestPoint(const Vector3d& point) const override;
+
+		//! Will compute the signed distance of many points. `out` gets resized to `points.size()`.
+		//! The face planes get normalized just once. With intrinsics enabled, four points get tested against them at a time,
+		//! and only points outside need further (scalar) work, to find their closest point on the surface.
+		void SignedDistance(const std::vector<Vector3d>& points, std::vector<double>& out) const;
+
+		//! Will append the indices of all colliders that contain a point to `out`.
+		//! Does not dispatch virtually. Processes four colliders at a time with intrinsics enabled.
+		static void Contains(
+			const std::vector<TrapazoidalPrismCollider>& colliders,
+			const Vector3d& point,
+			std::vector<std::size_t>& out
+		);
+
+		//! Will cast a ray against this collider, by clipping it against all six face planes.
+		//! Only hits with `0 <= t <= maxT` count. A ray starting inside hits at `t = 0`.
+		//! `hit.face` will be a FACE_NORMALS value.
+		bool Raycast(const Vector3d& origin, const Vector3d& direction, double maxT, RaycastHit& hit) const;
+
+		//! Will test if the line segment between two points intersects this collider. `hit.t` will be within [0, 1]
+		bool Linecast(const Vector3d& from, const Vector3d& to, RaycastHit& hit) const;
+
+		//! Will cast many rays against this collider. Processes four rays at a time with intrinsics enabled.
+		//! `hits` gets resized to `origins.size()`. Rays that miss get `t = infinity`.
+		//! Throws std::invalid_argument if `directions` differs in size.
+		void Raycast(
+			const std::vector<Vector3d>& origins,
+			const std::vector<Vector3d>& directions,
+			double maxT,
+			std::vector<RaycastHit>& hits
+		) const;
+
+		//! Will cast a single ray against many colliders. Processes four colliders at a time with intrinsics enabled.
+		//! `hits` gets resized to `colliders.size()`. Colliders that were missed get `t = infinity`.
+		static void Raycast(
+			const std::vector<TrapazoidalPrismCollider>& colliders,
+			const Vector3d& origin,
+			const Vector3d& direction,
+			double maxT,
+			std::vector<RaycastHit>& hits
+		);
+
 		/* Vertex identifiers */
 		static constexpr std::size_t BACK = 0;
 		static constexpr std::size_t FRONT = 4;
@@ -37,27 +128,54 @@ namespace Leonetienne::Eule
 		static constexpr std::size_t TOP = 1;
 
 	private:
-		enum class FACE_NORMALS : std::size_t;
-
 		//! Will calculate the vertex normals from vertices
 		void GenerateNormalsFromVertices();
 
+		//! Will calculate the normal of a single face from its vertices
+		void GenerateFaceNormal(FACE_NORMALS face);
+
+		//! A transformation matrix, prepared for TransformBy(). Column-major, each column padded to four rows
+		struct PreparedTransform
+		{
+			//! The upper 3x4 part. Transforms vertices
+			alignas(32) std::array<double, 16> affine;
+
+			//! The cofactor matrix of the upper 3x3 part. Transforms face normals, because (Ma) x (Mb) = cof(M) (a x b)
+			alignas(32) std::array<double, 12> cofactor;
+		};
+
+		static PreparedTransform PrepareTransform(const Matrix4x4& transform);
+
+		//! Will transform all vertices and face normals by a prepared transformation
+		void TransformBy(const PreparedTransform& transform);
+
 		//! Returns the dot product of a given point against a specific plane of the bounding box
 		double FaceDot(FACE_NORMALS face, const Vector3d& point) const;
 
-		std::array<Vector3d, 8> vertices;
-
+		//! Will fill in the hit of a ray that entered through a face at a given t
+		void FillRaycastHit(const Vector3d& origin, const Vector3d& direction, double t, std::size_t face, RaycastHit& hit) const;
 
-		// Face normals
-		enum class FACE_NORMALS : std::size_t
-		{
-			LEFT = 0,
-			RIGHT = 1,
-			FRONT = 2,
-			BACK = 3,
-			TOP = 4,
-			BOTTOM = 5
+		//! The vertex that is being used twice to calculate the normal of each face. It lies on that face's plane
+		static constexpr std::array<std::size_t, 6> faceCoreVertices = {
+			FRONT|LEFT|BOTTOM,	// LEFT
+			FRONT|RIGHT|BOTTOM,	// RIGHT
+			FRONT|LEFT|BOTTOM,	// FRONT
+			BACK|LEFT|BOTTOM,	// BACK
+			FRONT|LEFT|TOP,		// TOP
+			FRONT|LEFT|BOTTOM	// BOTTOM
 		};
+
+		//! The two vertices spanning each face's normal, together with its core vertex. The normal is (first - core) x (second - core)
+		static constexpr std::array<std::array<std::size_t, 2>, 6> faceSpanVertices = {{
+			{ BACK|LEFT|BOTTOM,		FRONT|LEFT|TOP },		// LEFT
+			{ FRONT|RIGHT|TOP,		BACK|RIGHT|BOTTOM },	// RIGHT
+			{ FRONT|LEFT|TOP,		FRONT|RIGHT|BOTTOM },	// FRONT
+			{ BACK|RIGHT|BOTTOM,	BACK|LEFT|TOP },		// BACK
+			{ BACK|LEFT|TOP,		FRONT|RIGHT|TOP },		// TOP
+			{ FRONT|RIGHT|BOTTOM,	BACK|LEFT|BOTTOM }		// BOTTOM
+		}};
+
+		std::array<Vector3d, 8> vertices;
 		std::array<Vector3d, 6> faceNormals;
 	};
 }
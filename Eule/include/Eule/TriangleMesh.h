@@ -0,0 +1,97 @@
+#pragma once
+#include "Eule/Vector3.h"
+#include "Eule/AABB.h"
+#include "Eule/RaycastHit.h"
+#include <array>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** An indexed triangle mesh. Each triangle references three vertices, ordered counter-clockwise seen from its front.
+	* Vertices are stored as structure-of-arrays. Each triangle's first vertex and both of its edges get precomputed,
+	* also as structure-of-arrays, padded to a multiple of TRIANGLE_BLOCK_WIDTH with degenerate triangles that never get hit.
+	* That way, rays get tested against a block of triangles at a time.
+	*
+	* To raycast against a large mesh, insert GetTriangleBounds() of each triangle into a DynamicAABBTree,
+	* and test only the triangles whose boxes got hit, via Raycast(origin, direction, maxT, candidates, hit).
+	*/
+	class TriangleMesh
+	{
+	public:
+		//! Constructs an empty mesh
+		TriangleMesh();
+
+		//! Constructs a mesh from vertices and triangles indexing them.
+		//! Throws std::out_of_range if a triangle references a vertex that does not exist.
+		TriangleMesh(const std::vector<Vector3d>& vertices, const std::vector<std::array<std::size_t, 3>>& triangles);
+
+		//! Will return the amount of vertices
+		std::size_t GetVertexCount() const;
+
+		//! Will return a specific vertex
+		Vector3d GetVertex(std::size_t index) const;
+
+		//! Will return the amount of triangles
+		std::size_t GetTriangleCount() const;
+
+		//! Will return the vertex indices of a triangle
+		const std::array<std::size_t, 3>& GetTriangle(std::size_t index) const;
+
+		//! Will return the vertex indices of all triangles
+		const std::vector<std::array<std::size_t, 3>>& GetTriangles() const;
+
+		//! Will return the normalized normal of a triangle's front face
+		Vector3d GetFaceNormal(std::size_t index) const;
+
+		//! Will compute the normalized normals of all triangles' front faces. `out` gets resized to GetTriangleCount().
+		//! Processes four triangles at a time with intrinsics enabled. Degenerate triangles get NaN normals.
+		void GetFaceNormals(std::vector<Vector3d>& out) const;
+
+		//! Will return the smallest axis-aligned box enclosing all vertices.
+		//! Throws std::logic_error if the mesh has no vertices.
+		AABB GetBounds() const;
+
+		//! Will return the smallest axis-aligned box enclosing a triangle
+		AABB GetTriangleBounds(std::size_t index) const;
+
+		//! Will cast a ray against all triangles (Möller-Trumbore), hitting both of their sides.
+		//! Only hits with `0 <= t <= maxT` count. On a hit, `hit.face` is the index of the closest triangle hit,
+		//! and `hit.normal` its front face normal. Tests four triangles at a time with intrinsics enabled.
+		bool Raycast(const Vector3d& origin, const Vector3d& direction, double maxT, RaycastHit& hit) const;
+
+		//! Like Raycast(), but only tests the triangles whose indices are listed, like the leaves of a bounding volume hierarchy.
+		//! If several triangles get hit at the same t, the one listed first wins.
+		bool Raycast(
+			const Vector3d& origin,
+			const Vector3d& direction,
+			double maxT,
+			const std::vector<std::size_t>& candidates,
+			RaycastHit& hit
+		) const;
+
+		//! The amount of triangles that get tested at once
+		static constexpr std::size_t TRIANGLE_BLOCK_WIDTH = 4;
+
+	private:
+		//! Will fill in a hit on a triangle at a given t
+		void FillRaycastHit(const Vector3d& origin, const Vector3d& direction, double t, std::size_t triangle, RaycastHit& hit) const;
+
+		// Vertices, as structure-of-arrays
+		std::vector<double> vx;
+		std::vector<double> vy;
+		std::vector<double> vz;
+
+		std::vector<std::array<std::size_t, 3>> triangles;
+
+		// First vertex (a) and edges (e1 = b - a, e2 = c - a) of each triangle, as structure-of-arrays, padded
+		std::vector<double> ax;
+		std::vector<double> ay;
+		std::vector<double> az;
+		std::vector<double> e1x;
+		std::vector<double> e1y;
+		std::vector<double> e1z;
+		std::vector<double> e2x;
+		std::vector<double> e2y;
+		std::vector<double> e2z;
+	};
+}
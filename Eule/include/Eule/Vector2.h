@@ -1,5 +1,7 @@
 #pragma once
+#include <cstdint>
 #include <cstdlib>
+#include <functional>
 #include <sstream>
 
 namespace Leonetienne::Eule {
@@ -116,3 +118,19 @@ namespace Leonetienne::Eule {
     typedef Vector2<double> Vector2d;
 
 }
+
+namespace std {
+    /** Hashes integer vectors, so they can be used as keys of unordered containers, or as grid cells.
+    * Both components get packed into 64 bits, which then get mixed by the finalizer of splitmix64.
+    */
+    template<>
+    struct hash<Leonetienne::Eule::Vector2i> {
+        std::size_t operator()(const Leonetienne::Eule::Vector2i& v) const noexcept {
+            std::uint64_t h = ((std::uint64_t)(std::uint32_t)v.x << 32) | (std::uint64_t)(std::uint32_t)v.y;
+
+            h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+            h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+            return (std::size_t)(h ^ (h >> 31));
+        }
+    };
+}
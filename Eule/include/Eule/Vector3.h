@@ -1,5 +1,7 @@
 #pragma once
+#include <cstdint>
 #include <cstdlib>
+#include <functional>
 #include <iomanip>
 #include <ostream>
 #include <sstream>
@@ -125,3 +127,23 @@ namespace Leonetienne::Eule {
     typedef Vector3<int> Vector3i;
     typedef Vector3<double> Vector3d;
 }
+
+namespace std {
+    /** Hashes integer vectors, so they can be used as keys of unordered containers, or as grid cells.
+    * The components get mixed by multiplying them with large odd constants, followed by the finalizer of splitmix64.
+    * Neighbouring cells end up far apart, so the low bits can be used directly as a table index.
+    */
+    template<>
+    struct hash<Leonetienne::Eule::Vector3i> {
+        std::size_t operator()(const Leonetienne::Eule::Vector3i& v) const noexcept {
+            std::uint64_t h =
+                ((std::uint64_t)(std::uint32_t)v.x * 0x9E3779B97F4A7C15ull) ^
+                ((std::uint64_t)(std::uint32_t)v.y * 0xC2B2AE3D27D4EB4Full) ^
+                ((std::uint64_t)(std::uint32_t)v.z * 0x165667B19E3779F9ull);
+
+            h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+            h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+            return (std::size_t)(h ^ (h >> 31));
+        }
+    };
+}
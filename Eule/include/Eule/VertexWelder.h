@@ -0,0 +1,40 @@
+#pragma once
+#include "Eule/Vector3.h"
+#include <cstdint>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** Merges points lying within an epsilon of each other (by Vector3::Similar()), like the duplicated vertices of a mesh.
+	* Points get processed in order: each one gets merged into the first earlier welded vertex it is similar to,
+	* or else becomes a welded vertex itself. Welded vertices keep the position of the point that started them.
+	*
+	* Instead of comparing all pairs, points get sorted into a hash grid of cells twice as wide as epsilon,
+	* so that only the (usually eight) cells around a point need to be searched. This takes O(n), as long as cells hold few points.
+	* Finding the first earlier point similar to each point gets split across threads.
+	* The result does not depend on the amount of threads.
+	*/
+	class VertexWelder
+	{
+	public:
+		//! Will weld points, on `threadCount` threads (0 means one per hardware thread).
+		//! `remap` gets resized to `points.size()`, and holds the index of the welded vertex each point got merged into.
+		//! `welded` gets overwritten with the welded vertices, in the order of their first point.
+		//! Points divided by `epsilon` have to fit into a Vector3i.
+		//! Throws std::invalid_argument if `epsilon` is not positive.
+		static void Weld(
+			const std::vector<Vector3d>& points,
+			double epsilon,
+			std::vector<std::size_t>& remap,
+			std::vector<Vector3d>& welded,
+			std::size_t threadCount = 1
+		);
+
+		//! Points a thread has to get at least, for Weld() to spawn it
+		static constexpr std::size_t MIN_POINTS_PER_THREAD = 65536;
+
+	private:
+		// No instanciation! >:(
+		VertexWelder();
+	};
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include "Eule/Vector3.h"
+#include <cstdint>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** Downsamples point clouds onto a grid of cubic voxels, keeping one point per occupied voxel: the centroid of the points within it.
+	* Voxels are accumulated in flat hash tables (open addressing, keyed by std::hash<Vector3i>), so memory is proportional
+	* to the amount of occupied voxels, not to the volume spanned.
+	*
+	* Each thread accumulates its share of the points into one table per partition of the hash space,
+	* after which each partition gets merged by one thread.
+	*/
+	class VoxelGridFilter
+	{
+	public:
+		//! Will compute the centroid of each occupied voxel, on `threadCount` threads (0 means one per hardware thread).
+		//! `centroids` gets overwritten, ordered by voxel (by x, then y, then z).
+		//! Throws std::invalid_argument if `voxelSize` is not positive.
+		static void Downsample(
+			const std::vector<Vector3d>& points,
+			double voxelSize,
+			std::vector<Vector3d>& centroids,
+			std::size_t threadCount = 1
+		);
+
+		//! Like Downsample(), but also writes the voxel of each centroid to `voxels`
+		static void Downsample(
+			const std::vector<Vector3d>& points,
+			double voxelSize,
+			std::vector<Vector3d>& centroids,
+			std::vector<Vector3i>& voxels,
+			std::size_t threadCount = 1
+		);
+
+		//! Will return the voxel containing a point. Unlike Vector3d::ToInt(), this rounds towards negative infinity
+		static Vector3i VoxelOf(const Vector3d& point, double voxelSize);
+
+		//! Points a thread has to get at least, for Downsample() to spawn it
+		static constexpr std::size_t MIN_POINTS_PER_THREAD = 65536;
+
+	private:
+		// No instanciation! >:(
+		VoxelGridFilter();
+	};
+}
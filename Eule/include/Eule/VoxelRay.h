@@ -0,0 +1,141 @@
+#pragma once
+#include "Eule/Vector3.h"
+#include "Eule/RaycastHit.h"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace Leonetienne::Eule
+{
+	/** Walks a ray through a grid of cubic voxels, visiting every voxel it passes, in order.
+	* Uses the incremental traversal of Amanatides and Woo: each step only compares the ray parameters
+	* at which the next voxel boundary along each axis gets crossed.
+	*
+	* The grid is made of voxels of edge length `voxelSize`, with voxel (0, 0, 0) spanning from `gridOrigin` to `gridOrigin + voxelSize`.
+	*/
+	class VoxelRay
+	{
+	public:
+		//! Starts a walk in the voxel containing `origin`.
+		//! Throws std::invalid_argument if `direction` is zero, or `voxelSize` is not positive.
+		VoxelRay(const Vector3d& origin, const Vector3d& direction, double voxelSize, const Vector3d& gridOrigin = Vector3d::zero);
+
+		//! Will advance to the next voxel along the ray
+		void Step();
+
+		//! Will return the current voxel
+		const Vector3i& GetVoxel() const;
+
+		//! Will return the ray parameter at which the ray entered the current voxel. It is 0 for the first voxel
+		double GetEntryT() const;
+
+		//! Will return the ray parameter at which the ray will leave the current voxel
+		double GetExitT() const;
+
+		//! Will return the axis (0 = x, 1 = y, 2 = z) through whose face the ray entered the current voxel, or NO_AXIS for the first voxel
+		std::size_t GetEntryAxis() const;
+
+		//! Will walk many rays at once, advancing all of them by one voxel per round, until each finds a voxel for which `isOccupied(voxel)` returns true,
+		//! or has passed `maxT`. `hits` and `voxels` get resized to `origins.size()`.
+		//! For rays that found a voxel, `hits[i].t` is where they entered it, and `hits[i].face` the axis they entered through (see GetEntryAxis()).
+		//! `hits[i].normal` is the normal of that face, pointing towards where the ray came from. It is zero for rays starting in an occupied voxel.
+		//! Rays that found nothing get `t = infinity`.
+		//! Throws std::invalid_argument if `directions` differs in size, if `maxT` is not finite, or like the constructor.
+		template <typename IsOccupied>
+		static void FindFirstOccupied(
+			const std::vector<Vector3d>& origins,
+			const std::vector<Vector3d>& directions,
+			double maxT,
+			double voxelSize,
+			const Vector3d& gridOrigin,
+			IsOccupied isOccupied,
+			std::vector<RaycastHit>& hits,
+			std::vector<Vector3i>& voxels
+		)
+		{
+			if (origins.size() != directions.size())
+				throw std::invalid_argument("There has to be one direction per origin!");
+
+			// Otherwise, rays that hit nothing would walk forever
+			if (!std::isfinite(maxT))
+				throw std::invalid_argument("The maximum ray parameter has to be finite!");
+
+			std::vector<VoxelRay> rays;
+			rays.reserve(origins.size());
+			for (std::size_t i = 0; i < origins.size(); i++)
+				rays.emplace_back(origins[i], directions[i], voxelSize, gridOrigin);
+
+			hits.resize(origins.size());
+			voxels.resize(origins.size());
+
+			// Indices of rays still walking. Finished ones get swapped out
+			std::vector<std::size_t> active(rays.size());
+			for (std::size_t i = 0; i < active.size(); i++)
+				active[i] = i;
+
+			while (!active.empty())
+			{
+				for (std::size_t a = 0; a < active.size();)
+				{
+					const std::size_t i = active[a];
+					VoxelRay& ray = rays[i];
+
+					const bool passedMaxT = ray.GetEntryT() > maxT;
+					const bool occupied = !passedMaxT && isOccupied(ray.GetVoxel());
+
+					if (!passedMaxT && !occupied)
+					{
+						ray.Step();
+						a++;
+						continue;
+					}
+
+					RaycastHit& hit = hits[i];
+					voxels[i] = ray.GetVoxel();
+
+					if (occupied)
+					{
+						hit.t = ray.GetEntryT();
+						hit.point = origins[i] + directions[i] * hit.t;
+						hit.face = ray.GetEntryAxis();
+						hit.normal = Vector3d::zero;
+						if (hit.face != NO_AXIS)
+							hit.normal[hit.face] = -(double)ray.step[hit.face];
+					}
+					else
+					{
+						hit.t = std::numeric_limits<double>::infinity();
+						hit.point = Vector3d::zero;
+						hit.normal = Vector3d::zero;
+						hit.face = NO_AXIS;
+					}
+
+					active[a] = active.back();
+					active.pop_back();
+				}
+			}
+
+			return;
+		}
+
+		//! Marks that the ray did not enter a voxel through a face, because it started inside of it
+		static constexpr std::size_t NO_AXIS = 3;
+
+	private:
+		Vector3i voxel;
+
+		//! Direction of a step along each axis: -1, 0 or 1
+		Vector3i step;
+
+		//! Ray parameter at which the next voxel boundary along each axis gets crossed
+		Vector3d tMax;
+
+		//! Ray parameter between two voxel boundaries along each axis
+		Vector3d tDelta;
+
+		double entryT = 0;
+		std::size_t entryAxis = NO_AXIS;
+	};
+}
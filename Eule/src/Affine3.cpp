@@ -0,0 +1,254 @@
+#include "Eule/Affine3.h"
+#include "Eule/Matrix3x3.h"
+#include "Eule/Math.h"
+
+//#define _EULE_NO_INTRINSICS_
+#ifndef _EULE_NO_INTRINSICS_
+#include <immintrin.h>
+#endif
+
+namespace Leonetienne::Eule {
+
+    namespace {
+        //! Will return the 3x3 component of a transformation
+        Matrix3x3 Linear(const Affine3& affine)
+        {
+            Matrix3x3 linear;
+            for (std::size_t i = 0; i < 3; i++)
+                for (std::size_t j = 0; j < 3; j++)
+                    linear[i][j] = affine[i][j];
+
+            return linear;
+        }
+    }
+
+    Affine3::Affine3()
+    {
+        // Create identity
+        for (std::size_t i = 0; i < 3; i++)
+            for (std::size_t j = 0; j < 4; j++)
+                v[i][j] = double(i == j);
+
+        return;
+    }
+
+    Affine3::Affine3(const Matrix4x4& matrix)
+    {
+        for (std::size_t i = 0; i < 3; i++)
+            v[i] = matrix[i];
+
+        return;
+    }
+
+    void Affine3::operator=(const Affine3& other)
+    {
+        v = other.v;
+        return;
+    }
+
+    void Affine3::operator=(Affine3&& other) noexcept
+    {
+        v = std::move(other.v);
+        return;
+    }
+
+    Matrix4x4 Affine3::ToMatrix4x4() const
+    {
+        // Default-constructs to the identity, so the last row is (0, 0, 0, 1) already
+        Matrix4x4 matrix;
+        for (std::size_t i = 0; i < 3; i++)
+            matrix[i] = v[i];
+
+        return matrix;
+    }
+
+    Affine3 Affine3::operator*(const Affine3& other) const
+    {
+        Affine3 result;
+
+#ifndef _EULE_NO_INTRINSICS_
+
+        const __m256d __o0 = _mm256_load_pd(other.v[0].data());
+        const __m256d __o1 = _mm256_load_pd(other.v[1].data());
+        const __m256d __o2 = _mm256_load_pd(other.v[2].data());
+
+        // Each row of the result is a linear combination of the rows of `other`
+        for (std::size_t y = 0; y < 3; y++)
+        {
+            __m256d __row = _mm256_mul_pd(_mm256_set1_pd(v[y][0]), __o0);
+            __row = _mm256_fmadd_pd(_mm256_set1_pd(v[y][1]), __o1, __row);
+            __row = _mm256_fmadd_pd(_mm256_set1_pd(v[y][2]), __o2, __row);
+
+            // The translations just get added
+            const __m256d __translation = _mm256_add_pd(_mm256_load_pd(v[y].data()), _mm256_load_pd(other.v[y].data()));
+            _mm256_store_pd(result.v[y].data(), _mm256_blend_pd(__row, __translation, 0b1000));
+        }
+
+#else
+
+        // Rotation, Scaling
+        for (std::size_t y = 0; y < 3; y++)
+            for (std::size_t x = 0; x < 3; x++)
+                result[y][x] = (v[y][0] * other[0][x]) + (v[y][1] * other[1][x]) + (v[y][2] * other[2][x]);
+
+        // Translation
+        for (std::size_t y = 0; y < 3; y++)
+            result[y][3] = v[y][3] + other[y][3];
+
+#endif
+
+        return result;
+    }
+
+    void Affine3::operator*=(const Affine3& other)
+    {
+        *this = *this * other;
+        return;
+    }
+
+    Affine3 Affine3::Inverse3x3() const
+    {
+        // Throws, if the 3x3 component is not inversible
+        const Matrix3x3 inverse = Linear(*this).Inverse();
+
+        Affine3 inv;
+        for (std::size_t i = 0; i < 3; i++)
+            for (std::size_t j = 0; j < 3; j++)
+                inv[i][j] = inverse[i][j];
+
+        inv.SetTranslationComponent(-GetTranslationComponent());
+
+        return inv;
+    }
+
+    bool Affine3::IsInversible3x3() const
+    {
+        return Determinant3x3() != 0;
+    }
+
+    double Affine3::Determinant3x3() const
+    {
+        return Linear(*this).Determinant();
+    }
+
+    Vector3d Affine3::TransformPoint(const Vector3d& point) const
+    {
+#ifndef _EULE_NO_INTRINSICS_
+
+        // Dot each row with (x, y, z, 1), then sum up the four products of each row, all at once
+        const __m256d __p = _mm256_set_pd(1, point.z, point.y, point.x);
+        const __m256d __m0 = _mm256_mul_pd(_mm256_load_pd(v[0].data()), __p);
+        const __m256d __m1 = _mm256_mul_pd(_mm256_load_pd(v[1].data()), __p);
+        const __m256d __m2 = _mm256_mul_pd(_mm256_load_pd(v[2].data()), __p);
+
+        // Pairwise sums: (m0[0] + m0[1], m1[0] + m1[1], m0[2] + m0[3], m1[2] + m1[3]) and (m2[0] + m2[1], 0, m2[2] + m2[3], 0).
+        // Adding the swapped upper halves to them yields (x, y, z, 0)
+        const __m256d __h01 = _mm256_hadd_pd(__m0, __m1);
+        const __m256d __h2 = _mm256_hadd_pd(__m2, _mm256_setzero_pd());
+
+        const __m256d __sum = _mm256_add_pd(
+            _mm256_permute2f128_pd(__h01, __h2, 0x21),
+            _mm256_blend_pd(__h01, __h2, 0b1100)
+        );
+
+        alignas(32) double result[4];
+        _mm256_store_pd(result, __sum);
+
+        return Vector3d(result[0], result[1], result[2]);
+
+#else
+
+        return Vector3d(
+            (v[0][0] * point.x) + (v[0][1] * point.y) + (v[0][2] * point.z) + v[0][3],
+            (v[1][0] * point.x) + (v[1][1] * point.y) + (v[1][2] * point.z) + v[1][3],
+            (v[2][0] * point.x) + (v[2][1] * point.y) + (v[2][2] * point.z) + v[2][3]
+        );
+
+#endif
+    }
+
+    void Affine3::TransformPoints(const std::vector<Vector3d>& points, std::vector<Vector3d>& out) const
+    {
+        out.resize(points.size());
+        std::size_t i = 0;
+
+#ifndef _EULE_NO_INTRINSICS_
+
+        // One broadcast coefficient per register, so that each lane transforms its own point
+        __m256d __m[3][4];
+        for (std::size_t y = 0; y < 3; y++)
+            for (std::size_t x = 0; x < 4; x++)
+                __m[y][x] = _mm256_set1_pd(v[y][x]);
+
+        alignas(32) double result[3][4];
+
+        for (; i + 4 <= points.size(); i += 4)
+        {
+            const Vector3d* p = &points[i];
+            const __m256d __x = _mm256_set_pd(p[3].x, p[2].x, p[1].x, p[0].x);
+            const __m256d __y = _mm256_set_pd(p[3].y, p[2].y, p[1].y, p[0].y);
+            const __m256d __z = _mm256_set_pd(p[3].z, p[2].z, p[1].z, p[0].z);
+
+            for (std::size_t y = 0; y < 3; y++)
+            {
+                __m256d __r = _mm256_fmadd_pd(__m[y][2], __z, __m[y][3]);
+                __r = _mm256_fmadd_pd(__m[y][1], __y, __r);
+                __r = _mm256_fmadd_pd(__m[y][0], __x, __r);
+                _mm256_store_pd(result[y], __r);
+            }
+
+            for (std::size_t j = 0; j < 4; j++)
+                out[i + j] = Vector3d(result[0][j], result[1][j], result[2][j]);
+        }
+
+#endif
+
+        for (; i < points.size(); i++)
+            out[i] = TransformPoint(points[i]);
+
+        return;
+    }
+
+    Vector3d Affine3::GetTranslationComponent() const
+    {
+        return Vector3d(v[0][3], v[1][3], v[2][3]);
+    }
+
+    void Affine3::SetTranslationComponent(const Vector3d& trans)
+    {
+        v[0][3] = trans.x;
+        v[1][3] = trans.y;
+        v[2][3] = trans.z;
+        return;
+    }
+
+    std::array<double, 4>& Affine3::operator[](std::size_t y)
+    {
+        return v[y];
+    }
+
+    const std::array<double, 4>& Affine3::operator[](std::size_t y) const
+    {
+        return v[y];
+    }
+
+    bool Affine3::operator==(const Affine3& other) const
+    {
+        return v == other.v;
+    }
+
+    bool Affine3::operator!=(const Affine3& other) const
+    {
+        return !operator==(other);
+    }
+
+    bool Affine3::Similar(const Affine3& other, double epsilon) const
+    {
+        for (std::size_t i = 0; i < 3; i++)
+            for (std::size_t j = 0; j < 4; j++)
+                if (!Math::Similar(v[i][j], other[i][j], epsilon))
+                    return false;
+
+        return true;
+    }
+}
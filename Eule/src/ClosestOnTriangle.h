@@ -0,0 +1,100 @@
+#pragma once
+#include "Eule/Vector3.h"
+
+/* Private to the library sources.
+* Shared by the closest point queries of TrapazoidalPrismCollider, and the simplex reduction of GJK in Overlap. */
+
+namespace Leonetienne::Eule::Internal {
+
+    //! The smallest feature of a triangle abc containing a point
+    enum class TRIANGLE_FEATURE
+    {
+        A,
+        B,
+        C,
+        AB,
+        AC,
+        BC,
+        FACE
+    };
+
+    /*
+    * BEGIN_REF
+    * Ericson: Real-Time Collision Detection, 5.1.5 (closest point on triangle to point)
+    */
+    //! Will return the point of triangle abc closest to p, and write the smallest feature containing it to `feature`
+    inline Vector3d ClosestOnTriangle(const Vector3d& p, const Vector3d& a, const Vector3d& b, const Vector3d& c, TRIANGLE_FEATURE& feature)
+    {
+        const Vector3d ab = b - a;
+        const Vector3d ac = c - a;
+
+        // Vertex region a
+        const Vector3d ap = p - a;
+        const double d1 = ab.DotProduct(ap);
+        const double d2 = ac.DotProduct(ap);
+        if ((d1 <= 0) && (d2 <= 0))
+        {
+            feature = TRIANGLE_FEATURE::A;
+            return a;
+        }
+
+        // Vertex region b
+        const Vector3d bp = p - b;
+        const double d3 = ab.DotProduct(bp);
+        const double d4 = ac.DotProduct(bp);
+        if ((d3 >= 0) && (d4 <= d3))
+        {
+            feature = TRIANGLE_FEATURE::B;
+            return b;
+        }
+
+        // Edge region ab
+        const double vc = d1 * d4 - d3 * d2;
+        if ((vc <= 0) && (d1 >= 0) && (d3 <= 0))
+        {
+            feature = TRIANGLE_FEATURE::AB;
+            return a + ab * (d1 / (d1 - d3));
+        }
+
+        // Vertex region c
+        const Vector3d cp = p - c;
+        const double d5 = ab.DotProduct(cp);
+        const double d6 = ac.DotProduct(cp);
+        if ((d6 >= 0) && (d5 <= d6))
+        {
+            feature = TRIANGLE_FEATURE::C;
+            return c;
+        }
+
+        // Edge region ac
+        const double vb = d5 * d2 - d1 * d6;
+        if ((vb <= 0) && (d2 >= 0) && (d6 <= 0))
+        {
+            feature = TRIANGLE_FEATURE::AC;
+            return a + ac * (d2 / (d2 - d6));
+        }
+
+        // Edge region bc
+        const double va = d3 * d6 - d5 * d4;
+        if ((va <= 0) && ((d4 - d3) >= 0) && ((d5 - d6) >= 0))
+        {
+            feature = TRIANGLE_FEATURE::BC;
+            return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+        }
+
+        // Face region
+        feature = TRIANGLE_FEATURE::FACE;
+        const double denominator = 1.0 / (va + vb + vc);
+        return a + ab * (vb * denominator) + ac * (vc * denominator);
+    }
+    /*
+    * END REF
+    */
+
+    //! Will return the point of triangle abc closest to p
+    inline Vector3d ClosestOnTriangle(const Vector3d& p, const Vector3d& a, const Vector3d& b, const Vector3d& c)
+    {
+        TRIANGLE_FEATURE feature;
+        return ClosestOnTriangle(p, a, b, c, feature);
+    }
+}
@@ -1 +1,19 @@
 #include "Eule/Collider.h"
+#include <stdexcept>
+
+using namespace Leonetienne::Eule;
+
+Vector3d Collider::SupportPoint(const Vector3d&) const
+{
+	throw std::logic_error("This collider does not provide a support point. It is either not convex, or does not implement one.");
+}
+
+double Collider::SignedDistance(const Vector3d&) const
+{
+	throw std::logic_error("This collider does not implement distance queries.");
+}
+
+Vector3d Collider::ClosestPoint(const Vector3d&) const
+{
+	throw std::logic_error("This collider does not implement distance queries.");
+}
@@ -0,0 +1,211 @@
+#include "Eule/ColliderSet.h"
+
+//#define _EULE_NO_INTRINSICS_
+#ifndef _EULE_NO_INTRINSICS_
+#include <immintrin.h>
+#endif
+
+namespace Leonetienne::Eule {
+
+    namespace {
+        //! Will translate the group-local indices appended to `out` since `begin` into handles
+        void IndicesToHandles(std::vector<std::size_t>& out, std::size_t begin, const std::vector<std::size_t>& handles)
+        {
+            for (std::size_t i = begin; i < out.size(); i++)
+                out[i] = handles[out[i]];
+
+            return;
+        }
+    }
+
+    std::size_t ColliderSet::Add(const TrapazoidalPrismCollider& collider)
+    {
+        const std::size_t lane = prismHandles.size() % PRISM_BLOCK_WIDTH;
+
+        // Start a new block. Unused lanes reject every point (0 + -1 < 0)
+        if (lane == 0)
+        {
+            PrismBlock block;
+            for (std::size_t f = 0; f < 6; f++)
+            {
+                block.nx[f].fill(0);
+                block.ny[f].fill(0);
+                block.nz[f].fill(0);
+                block.d[f].fill(-1);
+            }
+            prismBlocks.push_back(block);
+        }
+
+        PrismBlock& block = prismBlocks.back();
+        for (std::size_t f = 0; f < 6; f++)
+        {
+            const TrapazoidalPrismCollider::FACE_NORMALS face = (TrapazoidalPrismCollider::FACE_NORMALS)f;
+            const Vector3d& normal = collider.GetFaceNormal(face);
+
+            block.nx[f][lane] = normal.x;
+            block.ny[f][lane] = normal.y;
+            block.nz[f][lane] = normal.z;
+            block.d[f][lane] = collider.GetFaceOffset(face);
+        }
+
+        prismHandles.push_back(size);
+
+        return size++;
+    }
+
+    std::size_t ColliderSet::Add(const Frustum& collider)
+    {
+        frustums.colliders.push_back(collider);
+        frustums.handles.push_back(size);
+
+        return size++;
+    }
+
+    std::size_t ColliderSet::Add(const Collider* collider)
+    {
+        others.colliders.push_back(collider);
+        others.handles.push_back(size);
+
+        return size++;
+    }
+
+    std::size_t ColliderSet::Size() const
+    {
+        return size;
+    }
+
+    void ColliderSet::Clear()
+    {
+        prismBlocks.clear();
+        prismHandles.clear();
+        frustums = Group<Frustum>();
+        others = Group<const Collider*>();
+        size = 0;
+
+        return;
+    }
+
+    template <typename Callback>
+    bool ColliderSet::ForEachContainingPrism(const Vector3d& point, Callback onContained) const
+    {
+#ifndef _EULE_NO_INTRINSICS_
+
+        const __m256d __px = _mm256_set1_pd(point.x);
+        const __m256d __py = _mm256_set1_pd(point.y);
+        const __m256d __pz = _mm256_set1_pd(point.z);
+        const __m256d __zero = _mm256_setzero_pd();
+
+        for (std::size_t b = 0; b < prismBlocks.size(); b++)
+        {
+            const PrismBlock& block = prismBlocks[b];
+            int outside = 0;
+
+            // One plane of four prisms per iteration
+            for (std::size_t f = 0; (f < 6) && (outside != 0xF); f++)
+            {
+                __m256d __dot = _mm256_load_pd(block.d[f].data());
+                __dot = _mm256_fmadd_pd(_mm256_load_pd(block.nx[f].data()), __px, __dot);
+                __dot = _mm256_fmadd_pd(_mm256_load_pd(block.ny[f].data()), __py, __dot);
+                __dot = _mm256_fmadd_pd(_mm256_load_pd(block.nz[f].data()), __pz, __dot);
+
+                outside |= _mm256_movemask_pd(_mm256_cmp_pd(__dot, __zero, _CMP_LT_OQ));
+            }
+
+            // Padding lanes are always outside
+            for (std::size_t j = 0; j < PRISM_BLOCK_WIDTH; j++)
+                if (!(outside & (1 << j)))
+                    if (onContained(prismHandles[b * PRISM_BLOCK_WIDTH + j]))
+                        return true;
+        }
+
+#else
+
+        for (std::size_t b = 0; b < prismBlocks.size(); b++)
+        {
+            const PrismBlock& block = prismBlocks[b];
+
+            // Evaluate all planes for all prisms of a block. This loop has no early exit, so that it stays auto-vectorizable
+            std::array<bool, PRISM_BLOCK_WIDTH> inside;
+            inside.fill(true);
+
+            for (std::size_t f = 0; f < 6; f++)
+                for (std::size_t j = 0; j < PRISM_BLOCK_WIDTH; j++)
+                    inside[j] &= (block.nx[f][j] * point.x + block.ny[f][j] * point.y + block.nz[f][j] * point.z + block.d[f][j]) >= 0;
+
+            // Padding lanes are always outside
+            for (std::size_t j = 0; j < PRISM_BLOCK_WIDTH; j++)
+                if (inside[j])
+                    if (onContained(prismHandles[b * PRISM_BLOCK_WIDTH + j]))
+                        return true;
+        }
+
+#endif
+
+        return false;
+    }
+
+    void ColliderSet::FindContaining(const Vector3d& point, std::vector<std::size_t>& out) const
+    {
+        // One specialized batch per concrete type
+        ForEachContainingPrism(point, [&out](std::size_t handle) {
+            out.push_back(handle);
+            return false;
+        });
+
+        const std::size_t begin = out.size();
+        Frustum::Contains(frustums.colliders, point, out);
+        IndicesToHandles(out, begin, frustums.handles);
+
+        // Everything else goes through the vtable
+        for (std::size_t i = 0; i < others.colliders.size(); i++)
+            if (others.colliders[i]->Contains(point))
+                out.push_back(others.handles[i]);
+
+        return;
+    }
+
+    std::vector<std::size_t> ColliderSet::FindContaining(const Vector3d& point) const
+    {
+        std::vector<std::size_t> out;
+        FindContaining(point, out);
+
+        return out;
+    }
+
+    void ColliderSet::FindContainingMask(const Vector3d& point, std::vector<std::uint64_t>& bits) const
+    {
+        bits.assign((size + 63) / 64, 0);
+
+        ForEachContainingPrism(point, [&bits](std::size_t handle) {
+            bits[handle / 64] |= std::uint64_t(1) << (handle % 64);
+            return false;
+        });
+
+        for (std::size_t i = 0; i < frustums.colliders.size(); i++)
+            if (frustums.colliders[i].Frustum::Contains(point))
+                bits[frustums.handles[i] / 64] |= std::uint64_t(1) << (frustums.handles[i] % 64);
+
+        for (std::size_t i = 0; i < others.colliders.size(); i++)
+            if (others.colliders[i]->Contains(point))
+                bits[others.handles[i] / 64] |= std::uint64_t(1) << (others.handles[i] % 64);
+
+        return;
+    }
+
+    bool ColliderSet::AnyContains(const Vector3d& point) const
+    {
+        if (ForEachContainingPrism(point, [](std::size_t) { return true; }))
+            return true;
+
+        // Qualified calls, to skip the virtual dispatch
+        for (const Frustum& c : frustums.colliders)
+            if (c.Frustum::Contains(point))
+                return true;
+
+        for (const Collider* c : others.colliders)
+            if (c->Contains(point))
+                return true;
+
+        return false;
+    }
+}
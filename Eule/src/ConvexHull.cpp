@@ -0,0 +1,485 @@
+#include "Eule/ConvexHull.h"
+#include "Eule/PointStatistics.h"
+#include "Eule/Parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace Leonetienne::Eule {
+
+    namespace {
+        constexpr std::uint32_t NONE = UINT32_MAX;
+
+        //! Will return the index with the highest score. Ties go to the lower index, no matter how many threads ran
+        template <typename Score>
+        std::size_t ArgMax(std::size_t count, std::size_t threadCount, Score score)
+        {
+            const std::size_t chunks = Parallel::ChunkCount(count, threadCount, ConvexHull::MIN_POINTS_PER_THREAD);
+            const std::size_t chunkSize = (count + chunks - 1) / chunks;
+
+            std::vector<std::size_t> best(chunks, 0);
+            std::vector<double> bestScores(chunks, -std::numeric_limits<double>::infinity());
+
+            Parallel::For(chunks, chunks, 1, [&](std::size_t beginChunk, std::size_t endChunk) {
+                for (std::size_t c = beginChunk; c < endChunk; c++)
+                    for (std::size_t i = c * chunkSize; i < std::min((c + 1) * chunkSize, count); i++)
+                    {
+                        const double s = score(i);
+                        if (s > bestScores[c])
+                        {
+                            bestScores[c] = s;
+                            best[c] = i;
+                        }
+                    }
+            });
+
+            for (std::size_t c = 1; c < chunks; c++)
+                if (bestScores[c] > bestScores[0])
+                {
+                    bestScores[0] = bestScores[c];
+                    best[0] = best[c];
+                }
+
+            return best[0];
+        }
+
+        struct HalfEdge
+        {
+            //! The point this edge starts at
+            std::uint32_t origin;
+            //! The opposite edge, belonging to the neighbouring face
+            std::uint32_t twin;
+            //! The next edge around the same face, counter-clockwise
+            std::uint32_t next;
+            std::uint32_t face;
+        };
+
+        struct Face
+        {
+            //! Any of its three edges
+            std::uint32_t edge;
+            //! Outwards-facing, normalized
+            Vector3d normal;
+            double offset;
+            //! The points outside of this face, that have not been added yet
+            std::vector<std::uint32_t> outside;
+            bool alive;
+            bool visible;
+        };
+
+        class QuickHull
+        {
+        public:
+            QuickHull(const std::vector<Vector3d>& points, std::size_t threadCount)
+                :
+                points { points },
+                threadCount { threadCount }
+            {
+                return;
+            }
+
+            void Build()
+            {
+                if (points.size() < 4)
+                    throw std::invalid_argument("There have to be at least four points!");
+
+                // Distances below this are rounding errors, relative to the magnitude of the coordinates
+                const AABB bounds = PointStatistics::Bounds(points, threadCount);
+                epsilon = 3 * std::numeric_limits<double>::epsilon() * (
+                    std::max(std::abs(bounds.min.x), std::abs(bounds.max.x)) +
+                    std::max(std::abs(bounds.min.y), std::abs(bounds.max.y)) +
+                    std::max(std::abs(bounds.min.z), std::abs(bounds.max.z))
+                );
+
+                BuildTetrahedron();
+
+                while (!pending.empty())
+                {
+                    const std::uint32_t face = pending.back();
+                    pending.pop_back();
+
+                    if (faces[face].alive && !faces[face].outside.empty())
+                        AddFurthestPoint(face);
+                }
+
+                return;
+            }
+
+            void Extract(std::vector<Vector3d>& vertices, std::vector<std::array<std::size_t, 3>>& triangles, std::vector<std::size_t>& sourceIndices) const
+            {
+                std::vector<std::uint32_t> vertexOf(points.size(), NONE);
+
+                for (const Face& face : faces)
+                {
+                    if (!face.alive)
+                        continue;
+
+                    std::array<std::size_t, 3> triangle;
+                    std::uint32_t e = face.edge;
+                    for (std::size_t k = 0; k < 3; k++)
+                    {
+                        const std::uint32_t point = edges[e].origin;
+                        if (vertexOf[point] == NONE)
+                        {
+                            vertexOf[point] = (std::uint32_t)vertices.size();
+                            vertices.push_back(points[point]);
+                            sourceIndices.push_back(point);
+                        }
+
+                        triangle[k] = vertexOf[point];
+                        e = edges[e].next;
+                    }
+
+                    triangles.push_back(triangle);
+                }
+
+                return;
+            }
+
+            double GetEpsilon() const
+            {
+                return epsilon;
+            }
+
+        private:
+            double Distance(std::uint32_t face, std::uint32_t point) const
+            {
+                return faces[face].normal.DotProduct(points[point]) - faces[face].offset;
+            }
+
+            std::uint32_t Destination(std::uint32_t edge) const
+            {
+                return edges[edges[edge].next].origin;
+            }
+
+            std::uint32_t NewEdge()
+            {
+                if (!freeEdges.empty())
+                {
+                    const std::uint32_t edge = freeEdges.back();
+                    freeEdges.pop_back();
+                    return edge;
+                }
+
+                edges.emplace_back();
+                return (std::uint32_t)(edges.size() - 1);
+            }
+
+            //! Will create the triangle a, b, c (counter-clockwise, seen from outside). Its edges have no twins yet
+            std::uint32_t NewFace(std::uint32_t a, std::uint32_t b, std::uint32_t c)
+            {
+                std::uint32_t face;
+                if (!freeFaces.empty())
+                {
+                    face = freeFaces.back();
+                    freeFaces.pop_back();
+                }
+                else
+                {
+                    faces.emplace_back();
+                    face = (std::uint32_t)(faces.size() - 1);
+                }
+
+                const std::uint32_t e0 = NewEdge();
+                const std::uint32_t e1 = NewEdge();
+                const std::uint32_t e2 = NewEdge();
+                edges[e0] = HalfEdge { a, NONE, e1, face };
+                edges[e1] = HalfEdge { b, NONE, e2, face };
+                edges[e2] = HalfEdge { c, NONE, e0, face };
+
+                const Vector3d normal = (points[b] - points[a]).CrossProduct(points[c] - points[a]);
+                const double length = std::sqrt(normal.DotProduct(normal));
+
+                Face& f = faces[face];
+                f.edge = e0;
+                f.normal = normal / length;
+                f.offset = f.normal.DotProduct((points[a] + points[b] + points[c]) / 3.0);
+                f.outside.clear();
+                f.alive = true;
+                f.visible = false;
+
+                return face;
+            }
+
+            void DeleteFace(std::uint32_t face)
+            {
+                std::uint32_t e = faces[face].edge;
+                for (std::size_t k = 0; k < 3; k++)
+                {
+                    freeEdges.push_back(e);
+                    e = edges[e].next;
+                }
+
+                faces[face].alive = false;
+                faces[face].visible = false;
+                faces[face].outside.clear();
+                freeFaces.push_back(face);
+
+                return;
+            }
+
+            void BuildTetrahedron()
+            {
+                // The two furthest apart of the extreme points along each axis
+                std::array<std::size_t, 6> extremes;
+                for (std::size_t k = 0; k < 3; k++)
+                {
+                    extremes[2 * k] = ArgMax(points.size(), threadCount, [&](std::size_t i) { return -points[i][k]; });
+                    extremes[2 * k + 1] = ArgMax(points.size(), threadCount, [&](std::size_t i) { return points[i][k]; });
+                }
+
+                std::size_t a = 0, b = 0;
+                double furthest = -1;
+                for (std::size_t i = 0; i < 6; i++)
+                    for (std::size_t j = i + 1; j < 6; j++)
+                    {
+                        const Vector3d d = points[extremes[j]] - points[extremes[i]];
+                        if (d.DotProduct(d) > furthest)
+                        {
+                            furthest = d.DotProduct(d);
+                            a = extremes[i];
+                            b = extremes[j];
+                        }
+                    }
+
+                if (std::sqrt(furthest) <= epsilon)
+                    throw std::invalid_argument("The points don't span a volume!");
+
+                // The point furthest from their line
+                const Vector3d direction = points[b] - points[a];
+                const std::size_t c = ArgMax(points.size(), threadCount, [&](std::size_t i) {
+                    const Vector3d cross = (points[i] - points[a]).CrossProduct(direction);
+                    return cross.DotProduct(cross);
+                });
+
+                const Vector3d normal = direction.CrossProduct(points[c] - points[a]);
+                if (std::sqrt(normal.DotProduct(normal) / direction.DotProduct(direction)) <= epsilon)
+                    throw std::invalid_argument("The points don't span a volume!");
+
+                // The point furthest from their plane
+                const Vector3d unitNormal = normal / std::sqrt(normal.DotProduct(normal));
+                const std::size_t d = ArgMax(points.size(), threadCount, [&](std::size_t i) {
+                    return std::abs(unitNormal.DotProduct(points[i] - points[a]));
+                });
+
+                const double height = unitNormal.DotProduct(points[d] - points[a]);
+                if (std::abs(height) <= epsilon)
+                    throw std::invalid_argument("The points don't span a volume!");
+
+                // The base has to face away from the apex
+                std::uint32_t p0 = (std::uint32_t)a, p1 = (std::uint32_t)b, p2 = (std::uint32_t)c;
+                const std::uint32_t p3 = (std::uint32_t)d;
+                if (height > 0)
+                    std::swap(p1, p2);
+
+                const std::array<std::uint32_t, 4> initial = {
+                    NewFace(p0, p1, p2),
+                    NewFace(p1, p0, p3),
+                    NewFace(p2, p1, p3),
+                    NewFace(p0, p2, p3)
+                };
+
+                // Pair up the twelve edges
+                for (std::uint32_t f : initial)
+                    for (std::uint32_t g : initial)
+                    {
+                        std::uint32_t e = faces[f].edge;
+                        for (std::size_t i = 0; i < 3; i++, e = edges[e].next)
+                        {
+                            std::uint32_t h = faces[g].edge;
+                            for (std::size_t j = 0; j < 3; j++, h = edges[h].next)
+                                if ((edges[e].origin == Destination(h)) && (edges[h].origin == Destination(e)))
+                                    edges[e].twin = h;
+                        }
+                    }
+
+                std::vector<std::uint32_t> candidates;
+                candidates.reserve(points.size());
+                for (std::uint32_t i = 0; i < (std::uint32_t)points.size(); i++)
+                    if ((i != p0) && (i != p1) && (i != p2) && (i != p3))
+                        candidates.push_back(i);
+
+                AssignPoints(candidates, std::vector<std::uint32_t>(initial.begin(), initial.end()));
+
+                return;
+            }
+
+            //! Will move each candidate point to the outside set of the first of `targets` it lies outside of. Points inside all of them get dropped
+            void AssignPoints(const std::vector<std::uint32_t>& candidates, const std::vector<std::uint32_t>& targets)
+            {
+                const std::size_t chunks = Parallel::ChunkCount(candidates.size(), threadCount, ConvexHull::MIN_POINTS_PER_THREAD);
+
+                if (chunks == 1)
+                {
+                    for (std::uint32_t point : candidates)
+                        for (std::uint32_t face : targets)
+                            if (Distance(face, point) > epsilon)
+                            {
+                                faces[face].outside.push_back(point);
+                                break;
+                            }
+                }
+                else
+                {
+                    // Indexed [chunk][target]. Merged in chunk order, so the outside sets come out as if assigned in sequence
+                    const std::size_t chunkSize = (candidates.size() + chunks - 1) / chunks;
+                    std::vector<std::vector<std::vector<std::uint32_t>>> local(chunks, std::vector<std::vector<std::uint32_t>>(targets.size()));
+
+                    Parallel::For(chunks, chunks, 1, [&](std::size_t beginChunk, std::size_t endChunk) {
+                        for (std::size_t c = beginChunk; c < endChunk; c++)
+                            for (std::size_t i = c * chunkSize; i < std::min((c + 1) * chunkSize, candidates.size()); i++)
+                                for (std::size_t t = 0; t < targets.size(); t++)
+                                    if (Distance(targets[t], candidates[i]) > epsilon)
+                                    {
+                                        local[c][t].push_back(candidates[i]);
+                                        break;
+                                    }
+                    });
+
+                    for (std::size_t t = 0; t < targets.size(); t++)
+                        for (std::size_t c = 0; c < chunks; c++)
+                            faces[targets[t]].outside.insert(faces[targets[t]].outside.end(), local[c][t].begin(), local[c][t].end());
+                }
+
+                for (std::uint32_t face : targets)
+                    if (!faces[face].outside.empty())
+                        pending.push_back(face);
+
+                return;
+            }
+
+            //! Will add the point furthest outside of a face to the hull, replacing all faces it sees
+            void AddFurthestPoint(std::uint32_t face)
+            {
+                std::uint32_t eye = faces[face].outside[0];
+                double furthest = Distance(face, eye);
+                for (std::uint32_t point : faces[face].outside)
+                    if (Distance(face, point) > furthest)
+                    {
+                        furthest = Distance(face, point);
+                        eye = point;
+                    }
+
+                // All faces the eye sees. They are connected, so search outwards from the first one
+                std::vector<std::uint32_t> visible = { face };
+                faces[face].visible = true;
+                for (std::size_t i = 0; i < visible.size(); i++)
+                {
+                    std::uint32_t e = faces[visible[i]].edge;
+                    for (std::size_t k = 0; k < 3; k++, e = edges[e].next)
+                    {
+                        const std::uint32_t neighbour = edges[edges[e].twin].face;
+                        if (!faces[neighbour].visible && (Distance(neighbour, eye) > epsilon))
+                        {
+                            faces[neighbour].visible = true;
+                            visible.push_back(neighbour);
+                        }
+                    }
+                }
+
+                // The horizon: edges between visible and hidden faces, keyed by where they start
+                std::unordered_map<std::uint32_t, std::uint32_t> horizonFrom;
+                std::uint32_t first = NONE;
+                for (std::uint32_t f : visible)
+                {
+                    std::uint32_t e = faces[f].edge;
+                    for (std::size_t k = 0; k < 3; k++, e = edges[e].next)
+                        if (!faces[edges[edges[e].twin].face].visible)
+                        {
+                            horizonFrom[edges[e].origin] = e;
+                            if (first == NONE)
+                                first = e;
+                        }
+                }
+
+                // Walk around the horizon, and connect each of its edges to the eye
+                std::vector<std::uint32_t> created;
+                std::uint32_t e = first;
+                do
+                {
+                    const std::uint32_t twin = edges[e].twin;
+                    const std::uint32_t newFace = NewFace(edges[e].origin, Destination(e), eye);
+
+                    const std::uint32_t newEdge = faces[newFace].edge;
+                    edges[newEdge].twin = twin;
+                    edges[twin].twin = newEdge;
+                    created.push_back(newFace);
+
+                    const auto next = horizonFrom.find(Destination(e));
+                    if ((next == horizonFrom.end()) || (created.size() > horizonFrom.size()))
+                        throw std::logic_error("The horizon is not a simple loop!");
+
+                    e = next->second;
+                } while (e != first);
+
+                // The edge from b to the eye of each new face (a, b, eye) pairs up with the edge from the eye to b of the next one
+                for (std::size_t i = 0; i < created.size(); i++)
+                {
+                    const std::uint32_t toEye = edges[faces[created[i]].edge].next;
+                    const std::uint32_t fromEye = edges[edges[faces[created[(i + 1) % created.size()]].edge].next].next;
+                    edges[toEye].twin = fromEye;
+                    edges[fromEye].twin = toEye;
+                }
+
+                // The points outside the removed faces either lie outside the new ones, or within the hull
+                std::vector<std::uint32_t> orphans;
+                for (std::uint32_t f : visible)
+                {
+                    for (std::uint32_t point : faces[f].outside)
+                        if (point != eye)
+                            orphans.push_back(point);
+
+                    DeleteFace(f);
+                }
+
+                AssignPoints(orphans, created);
+
+                return;
+            }
+
+            const std::vector<Vector3d>& points;
+            const std::size_t threadCount;
+            double epsilon = 0;
+
+            std::vector<HalfEdge> edges;
+            std::vector<std::uint32_t> freeEdges;
+            std::vector<Face> faces;
+            std::vector<std::uint32_t> freeFaces;
+
+            //! Faces that may have points outside of them
+            std::vector<std::uint32_t> pending;
+        };
+    }
+
+    ConvexHull::ConvexHull(const std::vector<Vector3d>& points, std::size_t threadCount)
+    {
+        QuickHull quickHull(points, threadCount);
+        quickHull.Build();
+        quickHull.Extract(vertices, triangles, sourceIndices);
+        tolerance = quickHull.GetEpsilon();
+
+        return;
+    }
+
+    const std::vector<Vector3d>& ConvexHull::GetVertices() const
+    {
+        return vertices;
+    }
+
+    const std::vector<std::array<std::size_t, 3>>& ConvexHull::GetTriangles() const
+    {
+        return triangles;
+    }
+
+    const std::vector<std::size_t>& ConvexHull::GetSourceIndices() const
+    {
+        return sourceIndices;
+    }
+
+    double ConvexHull::GetTolerance() const
+    {
+        return tolerance;
+    }
+}
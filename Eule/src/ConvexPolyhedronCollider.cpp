@@ -0,0 +1,237 @@
+#include "Eule/ConvexPolyhedronCollider.h"
+#include <limits>
+
+//#define _EULE_NO_INTRINSICS_
+#ifndef _EULE_NO_INTRINSICS_
+#include <immintrin.h>
+#endif
+
+namespace Leonetienne::Eule {
+
+    ConvexPolyhedronCollider::ConvexPolyhedronCollider()
+    {
+        for (std::size_t i = 0; i < 8; i++)
+            vertices.push_back(Vector3d((i & 2) ? 1 : -1, (i & 1) ? 1 : -1, (i & 4) ? 1 : -1));
+
+        for (std::size_t k = 0; k < 3; k++)
+        {
+            Vector3d normal;
+            normal[k] = 1;
+            AddPlane(normal, 1);
+            AddPlane(-normal, 1);
+        }
+
+        PadPlanes();
+
+        return;
+    }
+
+    ConvexPolyhedronCollider::ConvexPolyhedronCollider(const ConvexHull& hull)
+        :
+        vertices { hull.GetVertices() },
+        tolerance { hull.GetTolerance() }
+    {
+        for (const std::array<std::size_t, 3>& triangle : hull.GetTriangles())
+        {
+            const Vector3d& a = vertices[triangle[0]];
+            const Vector3d& b = vertices[triangle[1]];
+            const Vector3d& c = vertices[triangle[2]];
+
+            // Triangles are counter-clockwise seen from outside, so (c - a) x (b - a) points inwards
+            const Vector3d inwards = (c - a).CrossProduct(b - a);
+
+            const Vector3d centroid = (a + b + c) / 3.0;
+            AddPlane(inwards, -inwards.DotProduct(centroid));
+        }
+
+        PadPlanes();
+
+        return;
+    }
+
+    ConvexPolyhedronCollider::ConvexPolyhedronCollider(const std::vector<Vector3d>& points, std::size_t threadCount)
+        :
+        ConvexPolyhedronCollider(ConvexHull(points, threadCount))
+    {
+        return;
+    }
+
+    ConvexPolyhedronCollider::ConvexPolyhedronCollider(const TrapazoidalPrismCollider& prism)
+    {
+        for (std::size_t i = 0; i < 8; i++)
+            vertices.push_back(prism.GetVertex(i));
+
+        for (std::size_t f = 0; f < 6; f++)
+        {
+            const TrapazoidalPrismCollider::FACE_NORMALS face = (TrapazoidalPrismCollider::FACE_NORMALS)f;
+            AddPlane(prism.GetFaceNormal(face), prism.GetFaceOffset(face));
+        }
+
+        PadPlanes();
+
+        return;
+    }
+
+    ConvexPolyhedronCollider::ConvexPolyhedronCollider(const OBB& box)
+    {
+        for (std::size_t i = 0; i < 8; i++)
+            vertices.push_back(box.GetCorner(i));
+
+        const Vector3d& center = box.GetCenter();
+        for (std::size_t k = 0; k < 3; k++)
+        {
+            const Vector3d& axis = box.GetAxis(k);
+            const double centerDot = axis.DotProduct(center);
+
+            // The box spans [centerDot - halfSize, centerDot + halfSize] along each axis
+            AddPlane(axis, box.GetHalfSize()[k] - centerDot);
+            AddPlane(-axis, box.GetHalfSize()[k] + centerDot);
+        }
+
+        PadPlanes();
+
+        return;
+    }
+
+    ConvexPolyhedronCollider::ConvexPolyhedronCollider(const Frustum& frustum)
+    {
+        for (std::size_t i = 0; i < 8; i++)
+            vertices.push_back(frustum.GetCorner(i));
+
+        for (std::size_t i = 0; i < 6; i++)
+            AddPlane(frustum.GetPlaneNormal(i), frustum.GetPlaneOffset(i));
+
+        PadPlanes();
+
+        return;
+    }
+
+    void ConvexPolyhedronCollider::operator=(const ConvexPolyhedronCollider& other)
+    {
+        planeCount = other.planeCount;
+        nx = other.nx;
+        ny = other.ny;
+        nz = other.nz;
+        d = other.d;
+        vertices = other.vertices;
+        tolerance = other.tolerance;
+
+        return;
+    }
+
+    void ConvexPolyhedronCollider::operator=(ConvexPolyhedronCollider&& other) noexcept
+    {
+        planeCount = other.planeCount;
+        nx = std::move(other.nx);
+        ny = std::move(other.ny);
+        nz = std::move(other.nz);
+        d = std::move(other.d);
+        vertices = std::move(other.vertices);
+        tolerance = other.tolerance;
+
+        return;
+    }
+
+    std::size_t ConvexPolyhedronCollider::GetPlaneCount() const
+    {
+        return planeCount;
+    }
+
+    Vector3d ConvexPolyhedronCollider::GetPlaneNormal(std::size_t plane) const
+    {
+        return Vector3d(nx[plane], ny[plane], nz[plane]);
+    }
+
+    double ConvexPolyhedronCollider::GetPlaneOffset(std::size_t plane) const
+    {
+        return d[plane];
+    }
+
+    const std::vector<Vector3d>& ConvexPolyhedronCollider::GetVertices() const
+    {
+        return vertices;
+    }
+
+    double ConvexPolyhedronCollider::GetTolerance() const
+    {
+        return tolerance;
+    }
+
+    bool ConvexPolyhedronCollider::Contains(const Vector3d& point) const
+    {
+#ifndef _EULE_NO_INTRINSICS_
+
+        const __m256d __px = _mm256_set1_pd(point.x);
+        const __m256d __py = _mm256_set1_pd(point.y);
+        const __m256d __pz = _mm256_set1_pd(point.z);
+        const __m256d __limit = _mm256_set1_pd(-tolerance);
+
+        // Four planes per iteration. Padding planes have a zero normal and offset, so they never reject
+        for (std::size_t i = 0; i < nx.size(); i += PLANE_BLOCK_WIDTH)
+        {
+            __m256d __dot = _mm256_loadu_pd(&d[i]);
+            __dot = _mm256_fmadd_pd(_mm256_loadu_pd(&nx[i]), __px, __dot);
+            __dot = _mm256_fmadd_pd(_mm256_loadu_pd(&ny[i]), __py, __dot);
+            __dot = _mm256_fmadd_pd(_mm256_loadu_pd(&nz[i]), __pz, __dot);
+
+            if (_mm256_movemask_pd(_mm256_cmp_pd(__dot, __limit, _CMP_LT_OQ)))
+                return false;
+        }
+
+        return true;
+
+#else
+
+        for (std::size_t i = 0; i < planeCount; i++)
+            if (nx[i] * point.x + ny[i] * point.y + nz[i] * point.z + d[i] < -tolerance)
+                return false;
+
+        return true;
+
+#endif
+    }
+
+    Vector3d ConvexPolyhedronCollider::SupportPoint(const Vector3d& direction) const
+    {
+        std::size_t best = 0;
+        double bestDot = -std::numeric_limits<double>::infinity();
+
+        for (std::size_t i = 0; i < vertices.size(); i++)
+        {
+            const double dot = vertices[i].DotProduct(direction);
+            if (dot > bestDot)
+            {
+                bestDot = dot;
+                best = i;
+            }
+        }
+
+        return vertices[best];
+    }
+
+    void ConvexPolyhedronCollider::AddPlane(const Vector3d& normal, double offset)
+    {
+        const double length = normal.Magnitude();
+
+        nx.push_back(normal.x / length);
+        ny.push_back(normal.y / length);
+        nz.push_back(normal.z / length);
+        d.push_back(offset / length);
+        planeCount++;
+
+        return;
+    }
+
+    void ConvexPolyhedronCollider::PadPlanes()
+    {
+        const std::size_t padded = (planeCount + PLANE_BLOCK_WIDTH - 1) / PLANE_BLOCK_WIDTH * PLANE_BLOCK_WIDTH;
+
+        // 0 * p + 0 >= 0 holds for any point
+        nx.resize(padded, 0);
+        ny.resize(padded, 0);
+        nz.resize(padded, 0);
+        d.resize(padded, 0);
+
+        return;
+    }
+}
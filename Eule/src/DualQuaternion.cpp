@@ -0,0 +1,458 @@
+#include "Eule/DualQuaternion.h"
+#include "Eule/Matrix3x3.h"
+#include "Eule/Math.h"
+#include <stdexcept>
+
+//#define _EULE_NO_INTRINSICS_
+#ifndef _EULE_NO_INTRINSICS_
+#include <immintrin.h>
+#endif
+
+/*
+    NOTE:
+    Both parts are stored in the same convention as the raw values of a Quaternion.
+    Because Quaternion::RotateVector() computes q^-1 * p * q, these are the quaternion-conjugates
+    of the "textbook" dual quaternion parts. This way GetRotation() can be handed to any other Quaternion
+    without conversion, and concatenation happens in the same order as Quaternion::operator*.
+
+    With the real part q = (u, w) and the dual part e = (ev, ew):
+    - rotation:     p' = p + 2 * u x (u x p - w * p)
+    - translation:  t  = 2 * (ew * u - w * ev + u x ev)
+    - construction: e  = (-0.5 * (w * t + u x t), 0.5 * (u . t))
+*/
+
+namespace Leonetienne::Eule {
+
+    namespace {
+        //! Hamilton product of two raw quaternion values
+        inline Vector4d HamiltonProduct(const Vector4d& a, const Vector4d& b)
+        {
+            return Vector4d(
+                a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+                a.w * b.y + a.y * b.w + a.z * b.x - a.x * b.z,
+                a.w * b.z + a.z * b.w + a.x * b.y - a.y * b.x,
+                a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z
+            );
+        }
+
+        inline double Dot4(const Vector4d& a, const Vector4d& b)
+        {
+            return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+        }
+
+        //! Will compute the dual part for a given rotation and translation
+        inline Vector4d DualFromTranslation(const Vector4d& q, const Vector3d& t)
+        {
+            return Vector4d(
+                -0.5 * (q.w * t.x + (q.y * t.z - q.z * t.y)),
+                -0.5 * (q.w * t.y + (q.z * t.x - q.x * t.z)),
+                -0.5 * (q.w * t.z + (q.x * t.y - q.y * t.x)),
+                 0.5 * (q.x * t.x + q.y * t.y + q.z * t.z)
+            );
+        }
+
+        //! Will rotate a point by an (assumed unit-length) real part
+        inline Vector3d RotateByReal(const Vector4d& q, const Vector3d& p)
+        {
+            // a = u x p - w * p
+            const double ax = (q.y * p.z - q.z * p.y) - q.w * p.x;
+            const double ay = (q.z * p.x - q.x * p.z) - q.w * p.y;
+            const double az = (q.x * p.y - q.y * p.x) - q.w * p.z;
+
+            // p + 2 * (u x a)
+            return Vector3d(
+                p.x + 2.0 * (q.y * az - q.z * ay),
+                p.y + 2.0 * (q.z * ax - q.x * az),
+                p.z + 2.0 * (q.x * ay - q.y * ax)
+            );
+        }
+
+        //! Will extract the translation of a normalized dual quaternion
+        inline Vector3d TranslationOf(const Vector4d& q, const Vector4d& e)
+        {
+            return Vector3d(
+                2.0 * (e.w * q.x - q.w * e.x + (q.y * e.z - q.z * e.y)),
+                2.0 * (e.w * q.y - q.w * e.y + (q.z * e.x - q.x * e.z)),
+                2.0 * (e.w * q.z - q.w * e.z + (q.x * e.y - q.y * e.x))
+            );
+        }
+
+        //! Will skin a single vertex. Used for the scalar path, and for the tail of the vectorized path
+        inline Vector3d SkinVertex(
+            const Vector3d& vertex,
+            const DualQuaternion::BoneInfluence& influence,
+            const std::vector<DualQuaternion>& palette)
+        {
+            const Vector4d& pivot = palette[influence.bones[0]].GetReal();
+
+            Vector4d real;
+            Vector4d dual;
+            for (std::size_t k = 0; k < 4; k++)
+            {
+                const DualQuaternion& bone = palette[influence.bones[k]];
+
+                // Take the shortest path, relative to the first influence
+                const double w = (Dot4(bone.GetReal(), pivot) < 0) ? -influence.weights[k] : influence.weights[k];
+
+                real += bone.GetReal() * w;
+                dual += bone.GetDual() * w;
+            }
+
+            // Without any weight, there is no transformation to normalize
+            const double length = real.Magnitude();
+            if (length == 0)
+                return vertex;
+
+            const double invLength = 1.0 / length;
+            real *= invLength;
+            dual *= invLength;
+
+            return RotateByReal(real, vertex) + TranslationOf(real, dual);
+        }
+    }
+
+    DualQuaternion::DualQuaternion()
+        :
+        real(0, 0, 0, 1),
+        dual(0, 0, 0, 0)
+    {
+        return;
+    }
+
+    DualQuaternion::DualQuaternion(const Vector4d real, const Vector4d dual)
+        :
+        real(real),
+        dual(dual)
+    {
+        return;
+    }
+
+    DualQuaternion::DualQuaternion(const Quaternion& rotation, const Vector3d& translation)
+    {
+        real = rotation.UnitQuaternion().GetRawValues();
+        dual = DualFromTranslation(real, translation);
+
+        return;
+    }
+
+    DualQuaternion::DualQuaternion(const Matrix4x4& mat)
+    {
+        real = Matrix3x3(mat).ToQuaternion().GetRawValues().Normalize();
+        dual = DualFromTranslation(real, mat.GetTranslationComponent());
+
+        return;
+    }
+
+    void DualQuaternion::operator=(const DualQuaternion& other)
+    {
+        real = other.real;
+        dual = other.dual;
+
+        return;
+    }
+
+    void DualQuaternion::operator=(DualQuaternion&& other) noexcept
+    {
+        real = std::move(other.real);
+        dual = std::move(other.dual);
+
+        return;
+    }
+
+    DualQuaternion DualQuaternion::operator*(const DualQuaternion& other) const
+    {
+        return DualQuaternion(
+            HamiltonProduct(real, other.real),
+            HamiltonProduct(real, other.dual) + HamiltonProduct(dual, other.real)
+        );
+    }
+
+    void DualQuaternion::operator*=(const DualQuaternion& other)
+    {
+        *this = *this * other;
+        return;
+    }
+
+    Vector3d DualQuaternion::operator*(const Vector3d& p) const
+    {
+        return TransformPoint(p);
+    }
+
+    bool DualQuaternion::operator==(const DualQuaternion& other) const
+    {
+        return Similar(other);
+    }
+
+    bool DualQuaternion::operator!=(const DualQuaternion& other) const
+    {
+        return !Similar(other);
+    }
+
+    Vector3d DualQuaternion::TransformPoint(const Vector3d& p) const
+    {
+        return RotateByReal(real, p) + TranslationOf(real, dual);
+    }
+
+    Vector3d DualQuaternion::TransformDirection(const Vector3d& dir) const
+    {
+        return RotateByReal(real, dir);
+    }
+
+    DualQuaternion DualQuaternion::Inverse() const
+    {
+        // For unit dual quaternions, the inverse is the conjugate
+        return Conjugate();
+    }
+
+    DualQuaternion DualQuaternion::Conjugate() const
+    {
+        return DualQuaternion(
+            Vector4d(-real.x, -real.y, -real.z, real.w),
+            Vector4d(-dual.x, -dual.y, -dual.z, dual.w)
+        );
+    }
+
+    DualQuaternion DualQuaternion::Normalize() const
+    {
+        DualQuaternion dq(*this);
+        dq.NormalizeSelf();
+
+        return dq;
+    }
+
+    void DualQuaternion::NormalizeSelf()
+    {
+        const double length = real.Magnitude();
+
+        // Prevent division by 0
+        if (length == 0)
+        {
+            real = Vector4d(0, 0, 0, 1);
+            dual = Vector4d(0, 0, 0, 0);
+            return;
+        }
+
+        const double invLength = 1.0 / length;
+        real *= invLength;
+        dual *= invLength;
+
+        // Remove the component of the dual part that is not orthogonal to the real part
+        dual -= real * Dot4(real, dual);
+
+        return;
+    }
+
+    Quaternion DualQuaternion::GetRotation() const
+    {
+        return Quaternion(real);
+    }
+
+    Vector3d DualQuaternion::GetTranslation() const
+    {
+        return TranslationOf(real, dual);
+    }
+
+    Matrix4x4 DualQuaternion::ToMatrix() const
+    {
+        Matrix4x4 m = Quaternion(real).ToRotationMatrix();
+        m.SetTranslationComponent(GetTranslation());
+
+        return m;
+    }
+
+    const Vector4d& DualQuaternion::GetReal() const
+    {
+        return real;
+    }
+
+    const Vector4d& DualQuaternion::GetDual() const
+    {
+        return dual;
+    }
+
+    void DualQuaternion::SetRawValues(const Vector4d real, const Vector4d dual)
+    {
+        this->real = real;
+        this->dual = dual;
+
+        return;
+    }
+
+    DualQuaternion DualQuaternion::Lerp(const DualQuaternion& other, double t) const
+    {
+        // Take the shortest path
+        const double otherT = (Dot4(real, other.real) < 0) ? -t : t;
+        const double it = 1.0 - t;
+
+        DualQuaternion blend(
+            real * it + other.real * otherT,
+            dual * it + other.dual * otherT
+        );
+
+        return blend.Normalize();
+    }
+
+    bool DualQuaternion::Similar(const DualQuaternion& other, double epsilon) const
+    {
+        // q and -q describe the same transformation
+        return
+            ((real.Similar(other.real, epsilon)) && (dual.Similar(other.dual, epsilon))) ||
+            ((real.Similar(-other.real, epsilon)) && (dual.Similar(-other.dual, epsilon)));
+    }
+
+    void DualQuaternion::Skin(
+        const std::vector<Vector3d>& vertices,
+        const std::vector<BoneInfluence>& influences,
+        const std::vector<DualQuaternion>& palette,
+        std::vector<Vector3d>& out)
+    {
+        if (vertices.size() != influences.size())
+            throw std::invalid_argument("Every vertex needs exactly one BoneInfluence!");
+
+        const std::size_t count = vertices.size();
+        out.resize(count);
+
+        std::size_t i = 0;
+
+#ifndef _EULE_NO_INTRINSICS_
+
+        // Four vertices per iteration. Every register holds one component of four vertices
+        for (; i + 4 <= count; i += 4)
+        {
+            const BoneInfluence* inf = &influences[i];
+
+            __m256d __rx = _mm256_setzero_pd();
+            __m256d __ry = _mm256_setzero_pd();
+            __m256d __rz = _mm256_setzero_pd();
+            __m256d __rw = _mm256_setzero_pd();
+            __m256d __ex = _mm256_setzero_pd();
+            __m256d __ey = _mm256_setzero_pd();
+            __m256d __ez = _mm256_setzero_pd();
+            __m256d __ew = _mm256_setzero_pd();
+
+            // Real parts of the first influence. Used to pick the shortest path
+            __m256d __px, __py, __pz, __pw;
+
+            for (std::size_t k = 0; k < 4; k++)
+            {
+                const DualQuaternion& b0 = palette[inf[0].bones[k]];
+                const DualQuaternion& b1 = palette[inf[1].bones[k]];
+                const DualQuaternion& b2 = palette[inf[2].bones[k]];
+                const DualQuaternion& b3 = palette[inf[3].bones[k]];
+
+                // Load bone components
+                __m256d __bx = _mm256_set_pd(b3.real.x, b2.real.x, b1.real.x, b0.real.x);
+                __m256d __by = _mm256_set_pd(b3.real.y, b2.real.y, b1.real.y, b0.real.y);
+                __m256d __bz = _mm256_set_pd(b3.real.z, b2.real.z, b1.real.z, b0.real.z);
+                __m256d __bw = _mm256_set_pd(b3.real.w, b2.real.w, b1.real.w, b0.real.w);
+
+                if (k == 0)
+                {
+                    __px = __bx;
+                    __py = __by;
+                    __pz = __bz;
+                    __pw = __bw;
+                }
+
+                // Load weights, and flip them, if this bone is in the opposite hemisphere of the first one
+                __m256d __w = _mm256_set_pd(inf[3].weights[k], inf[2].weights[k], inf[1].weights[k], inf[0].weights[k]);
+
+                __m256d __dot = _mm256_mul_pd(__bx, __px);
+                __dot = _mm256_fmadd_pd(__by, __py, __dot);
+                __dot = _mm256_fmadd_pd(__bz, __pz, __dot);
+                __dot = _mm256_fmadd_pd(__bw, __pw, __dot);
+
+                __m256d __flip = _mm256_cmp_pd(__dot, _mm256_setzero_pd(), _CMP_LT_OQ);
+                __w = _mm256_blendv_pd(__w, _mm256_sub_pd(_mm256_setzero_pd(), __w), __flip);
+
+                // Accumulate
+                __rx = _mm256_fmadd_pd(__w, __bx, __rx);
+                __ry = _mm256_fmadd_pd(__w, __by, __ry);
+                __rz = _mm256_fmadd_pd(__w, __bz, __rz);
+                __rw = _mm256_fmadd_pd(__w, __bw, __rw);
+
+                __ex = _mm256_fmadd_pd(__w, _mm256_set_pd(b3.dual.x, b2.dual.x, b1.dual.x, b0.dual.x), __ex);
+                __ey = _mm256_fmadd_pd(__w, _mm256_set_pd(b3.dual.y, b2.dual.y, b1.dual.y, b0.dual.y), __ey);
+                __ez = _mm256_fmadd_pd(__w, _mm256_set_pd(b3.dual.z, b2.dual.z, b1.dual.z, b0.dual.z), __ez);
+                __ew = _mm256_fmadd_pd(__w, _mm256_set_pd(b3.dual.w, b2.dual.w, b1.dual.w, b0.dual.w), __ew);
+            }
+
+            // Normalize
+            __m256d __len = _mm256_mul_pd(__rx, __rx);
+            __len = _mm256_fmadd_pd(__ry, __ry, __len);
+            __len = _mm256_fmadd_pd(__rz, __rz, __len);
+            __len = _mm256_fmadd_pd(__rw, __rw, __len);
+            __m256d __invLen = _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(__len));
+
+            __rx = _mm256_mul_pd(__rx, __invLen);
+            __ry = _mm256_mul_pd(__ry, __invLen);
+            __rz = _mm256_mul_pd(__rz, __invLen);
+            __rw = _mm256_mul_pd(__rw, __invLen);
+            __ex = _mm256_mul_pd(__ex, __invLen);
+            __ey = _mm256_mul_pd(__ey, __invLen);
+            __ez = _mm256_mul_pd(__ez, __invLen);
+            __ew = _mm256_mul_pd(__ew, __invLen);
+
+            // Load vertices
+            __m256d __vx = _mm256_set_pd(vertices[i+3].x, vertices[i+2].x, vertices[i+1].x, vertices[i].x);
+            __m256d __vy = _mm256_set_pd(vertices[i+3].y, vertices[i+2].y, vertices[i+1].y, vertices[i].y);
+            __m256d __vz = _mm256_set_pd(vertices[i+3].z, vertices[i+2].z, vertices[i+1].z, vertices[i].z);
+
+            // a = u x p - w * p
+            __m256d __ax = _mm256_fnmadd_pd(__rw, __vx, _mm256_fmsub_pd(__ry, __vz, _mm256_mul_pd(__rz, __vy)));
+            __m256d __ay = _mm256_fnmadd_pd(__rw, __vy, _mm256_fmsub_pd(__rz, __vx, _mm256_mul_pd(__rx, __vz)));
+            __m256d __az = _mm256_fnmadd_pd(__rw, __vz, _mm256_fmsub_pd(__rx, __vy, _mm256_mul_pd(__ry, __vx)));
+
+            // c = u x a + (ew * u - w * ev + u x ev), the result is p + 2c
+            __m256d __cx = _mm256_fmsub_pd(__ry, __az, _mm256_mul_pd(__rz, __ay));
+            __m256d __cy = _mm256_fmsub_pd(__rz, __ax, _mm256_mul_pd(__rx, __az));
+            __m256d __cz = _mm256_fmsub_pd(__rx, __ay, _mm256_mul_pd(__ry, __ax));
+
+            __cx = _mm256_add_pd(__cx, _mm256_fnmadd_pd(__rw, __ex, _mm256_fmadd_pd(__ew, __rx, _mm256_fmsub_pd(__ry, __ez, _mm256_mul_pd(__rz, __ey)))));
+            __cy = _mm256_add_pd(__cy, _mm256_fnmadd_pd(__rw, __ey, _mm256_fmadd_pd(__ew, __ry, _mm256_fmsub_pd(__rz, __ex, _mm256_mul_pd(__rx, __ez)))));
+            __cz = _mm256_add_pd(__cz, _mm256_fnmadd_pd(__rw, __ez, _mm256_fmadd_pd(__ew, __rz, _mm256_fmsub_pd(__rx, __ey, _mm256_mul_pd(__ry, __ex)))));
+
+            const __m256d __two = _mm256_set1_pd(2.0);
+            __m256d __ox = _mm256_fmadd_pd(__two, __cx, __vx);
+            __m256d __oy = _mm256_fmadd_pd(__two, __cy, __vy);
+            __m256d __oz = _mm256_fmadd_pd(__two, __cz, __vz);
+
+            // Pass vertices without any weight through, instead of their NaNs
+            const __m256d __unweighted = _mm256_cmp_pd(__len, _mm256_setzero_pd(), _CMP_EQ_OQ);
+            __ox = _mm256_blendv_pd(__ox, __vx, __unweighted);
+            __oy = _mm256_blendv_pd(__oy, __vy, __unweighted);
+            __oz = _mm256_blendv_pd(__oz, __vz, __unweighted);
+
+            // Retrieve results
+            double ox[4];
+            double oy[4];
+            double oz[4];
+            _mm256_storeu_pd(ox, __ox);
+            _mm256_storeu_pd(oy, __oy);
+            _mm256_storeu_pd(oz, __oz);
+
+            for (std::size_t j = 0; j < 4; j++)
+                out[i + j] = Vector3d(ox[j], oy[j], oz[j]);
+        }
+
+#endif
+
+        // Remaining vertices (or all of them, without intrinsics)
+        for (; i < count; i++)
+            out[i] = SkinVertex(vertices[i], influences[i], palette);
+
+        return;
+    }
+
+    std::ostream& operator<< (std::ostream& os, const DualQuaternion& dq)
+    {
+        os << "[real: " << dq.real << "  dual: " << dq.dual << "]";
+        return os;
+    }
+
+    std::wostream& operator<< (std::wostream& os, const DualQuaternion& dq)
+    {
+        os << L"[real: " << dq.real << L"  dual: " << dq.dual << L"]";
+        return os;
+    }
+}
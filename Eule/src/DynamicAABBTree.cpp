@@ -0,0 +1,492 @@
+#include "Eule/DynamicAABBTree.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+/*
+    NOTE:
+    The structure of this tree (node pool, surface area heuristic for insertion, and rotations for balance)
+    follows the dynamic tree of Box2D by Erin Catto, extended to three dimensions.
+*/
+
+namespace Leonetienne::Eule {
+
+    namespace {
+        inline AABB Union(const AABB& a, const AABB& b)
+        {
+            return AABB {
+                Vector3d(std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z)),
+                Vector3d(std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z))
+            };
+        }
+
+        inline double SurfaceArea(const AABB& box)
+        {
+            const double dx = box.max.x - box.min.x;
+            const double dy = box.max.y - box.min.y;
+            const double dz = box.max.z - box.min.z;
+
+            return 2.0 * (dx * dy + dy * dz + dz * dx);
+        }
+
+        inline bool Encloses(const AABB& outer, const AABB& inner)
+        {
+            return
+                (outer.min.x <= inner.min.x) && (outer.min.y <= inner.min.y) && (outer.min.z <= inner.min.z) &&
+                (inner.max.x <= outer.max.x) && (inner.max.y <= outer.max.y) && (inner.max.z <= outer.max.z);
+        }
+
+        inline bool Overlaps(const AABB& a, const AABB& b)
+        {
+            return
+                (a.min.x <= b.max.x) && (b.min.x <= a.max.x) &&
+                (a.min.y <= b.max.y) && (b.min.y <= a.max.y) &&
+                (a.min.z <= b.max.z) && (b.min.z <= a.max.z);
+        }
+
+        inline bool ContainsPoint(const AABB& box, const Vector3d& point)
+        {
+            return
+                (box.min.x <= point.x) && (point.x <= box.max.x) &&
+                (box.min.y <= point.y) && (point.y <= box.max.y) &&
+                (box.min.z <= point.z) && (point.z <= box.max.z);
+        }
+
+        //! Slab test of a ray against a box, within [0, maxT]
+        inline bool RayHitsBox(const AABB& box, const Vector3d& origin, const Vector3d& inverseDirection, double maxT)
+        {
+            double tEnter = 0;
+            double tExit = maxT;
+
+            for (std::size_t i = 0; i < 3; i++)
+            {
+                // Parallel to this slab. Either always inside, or never
+                if (std::isinf(inverseDirection[i]))
+                {
+                    if ((origin[i] < box.min[i]) || (origin[i] > box.max[i]))
+                        return false;
+                    continue;
+                }
+
+                const double t0 = (box.min[i] - origin[i]) * inverseDirection[i];
+                const double t1 = (box.max[i] - origin[i]) * inverseDirection[i];
+
+                tEnter = std::max(tEnter, std::min(t0, t1));
+                tExit = std::min(tExit, std::max(t0, t1));
+
+                if (tEnter > tExit)
+                    return false;
+            }
+
+            return true;
+        }
+    }
+
+    DynamicAABBTree::DynamicAABBTree(double margin)
+        :
+        margin { margin }
+    {
+        return;
+    }
+
+    std::size_t DynamicAABBTree::AllocateNode()
+    {
+        // Grow the pool, and thread all new nodes onto the free list
+        if (freeList == NULL_NODE)
+        {
+            const std::size_t oldSize = nodes.size();
+            nodes.resize(std::max<std::size_t>(16, oldSize * 2));
+
+            for (std::size_t i = oldSize; i < nodes.size(); i++)
+            {
+                nodes[i].parent = (i + 1 < nodes.size()) ? i + 1 : NULL_NODE;
+                nodes[i].height = -1;
+            }
+
+            freeList = oldSize;
+        }
+
+        const std::size_t node = freeList;
+        freeList = nodes[node].parent;
+
+        nodes[node] = Node();
+        nodes[node].height = 0;
+
+        return node;
+    }
+
+    void DynamicAABBTree::FreeNode(std::size_t node)
+    {
+        nodes[node] = Node();
+        nodes[node].parent = freeList;
+        freeList = node;
+
+        return;
+    }
+
+    std::size_t DynamicAABBTree::Insert(const AABB& bounds, const Collider* collider)
+    {
+        const std::size_t leaf = AllocateNode();
+
+        nodes[leaf].bounds = AABB {
+            bounds.min - Vector3d(margin, margin, margin),
+            bounds.max + Vector3d(margin, margin, margin)
+        };
+        nodes[leaf].collider = collider;
+
+        InsertLeaf(leaf);
+        leafCount++;
+
+        return leaf;
+    }
+
+    void DynamicAABBTree::Remove(std::size_t handle)
+    {
+        if ((handle >= nodes.size()) || (nodes[handle].height != 0))
+            throw std::out_of_range("No leaf with this handle!");
+
+        RemoveLeaf(handle);
+        FreeNode(handle);
+        leafCount--;
+
+        return;
+    }
+
+    bool DynamicAABBTree::Move(std::size_t handle, const AABB& bounds, const Vector3d& displacement)
+    {
+        if ((handle >= nodes.size()) || (nodes[handle].height != 0))
+            throw std::out_of_range("No leaf with this handle!");
+
+        if (Encloses(nodes[handle].bounds, bounds))
+            return false;
+
+        RemoveLeaf(handle);
+
+        AABB fat {
+            bounds.min - Vector3d(margin, margin, margin),
+            bounds.max + Vector3d(margin, margin, margin)
+        };
+
+        // Stretch towards where it is heading
+        for (std::size_t i = 0; i < 3; i++)
+        {
+            if (displacement[i] < 0)
+                fat.min[i] += displacement[i];
+            else
+                fat.max[i] += displacement[i];
+        }
+
+        nodes[handle].bounds = fat;
+        InsertLeaf(handle);
+
+        return true;
+    }
+
+    const AABB& DynamicAABBTree::GetFatBounds(std::size_t handle) const
+    {
+        return nodes[handle].bounds;
+    }
+
+    const Collider* DynamicAABBTree::GetCollider(std::size_t handle) const
+    {
+        return nodes[handle].collider;
+    }
+
+    std::size_t DynamicAABBTree::Size() const
+    {
+        return leafCount;
+    }
+
+    std::size_t DynamicAABBTree::GetHeight() const
+    {
+        if (root == NULL_NODE)
+            return 0;
+
+        return nodes[root].height;
+    }
+
+    void DynamicAABBTree::Clear()
+    {
+        nodes.clear();
+        root = NULL_NODE;
+        freeList = NULL_NODE;
+        leafCount = 0;
+
+        return;
+    }
+
+    void DynamicAABBTree::InsertLeaf(std::size_t leaf)
+    {
+        if (root == NULL_NODE)
+        {
+            root = leaf;
+            nodes[leaf].parent = NULL_NODE;
+            return;
+        }
+
+        // Descend to the sibling that is cheapest to pair up with, by the surface area heuristic
+        const AABB leafBounds = nodes[leaf].bounds;
+        std::size_t index = root;
+
+        while (!nodes[index].IsLeaf())
+        {
+            const std::size_t left = nodes[index].left;
+            const std::size_t right = nodes[index].right;
+
+            const double area = SurfaceArea(nodes[index].bounds);
+            const double combinedArea = SurfaceArea(Union(nodes[index].bounds, leafBounds));
+
+            // Cost of creating a new parent for this node and the leaf
+            const double cost = 2.0 * combinedArea;
+
+            // Minimum cost of pushing the leaf further down, for enlarging this node
+            const double inheritanceCost = 2.0 * (combinedArea - area);
+
+            const auto descendCost = [&](std::size_t child)
+            {
+                const double enlarged = SurfaceArea(Union(nodes[child].bounds, leafBounds));
+                if (nodes[child].IsLeaf())
+                    return enlarged + inheritanceCost;
+
+                return (enlarged - SurfaceArea(nodes[child].bounds)) + inheritanceCost;
+            };
+
+            const double costLeft = descendCost(left);
+            const double costRight = descendCost(right);
+
+            if ((cost < costLeft) && (cost < costRight))
+                break;
+
+            index = (costLeft < costRight) ? left : right;
+        }
+
+        const std::size_t sibling = index;
+
+        // Create a new parent for the sibling and the leaf
+        const std::size_t oldParent = nodes[sibling].parent;
+        const std::size_t newParent = AllocateNode();
+
+        nodes[newParent].parent = oldParent;
+        nodes[newParent].bounds = Union(leafBounds, nodes[sibling].bounds);
+        nodes[newParent].height = nodes[sibling].height + 1;
+        nodes[newParent].left = sibling;
+        nodes[newParent].right = leaf;
+
+        if (oldParent == NULL_NODE)
+            root = newParent;
+        else if (nodes[oldParent].left == sibling)
+            nodes[oldParent].left = newParent;
+        else
+            nodes[oldParent].right = newParent;
+
+        nodes[sibling].parent = newParent;
+        nodes[leaf].parent = newParent;
+
+        Refit(newParent);
+
+        return;
+    }
+
+    void DynamicAABBTree::RemoveLeaf(std::size_t leaf)
+    {
+        if (leaf == root)
+        {
+            root = NULL_NODE;
+            return;
+        }
+
+        // The sibling takes the place of the parent
+        const std::size_t parent = nodes[leaf].parent;
+        const std::size_t grandParent = nodes[parent].parent;
+        const std::size_t sibling = (nodes[parent].left == leaf) ? nodes[parent].right : nodes[parent].left;
+
+        nodes[sibling].parent = grandParent;
+        FreeNode(parent);
+
+        if (grandParent == NULL_NODE)
+        {
+            root = sibling;
+            return;
+        }
+
+        if (nodes[grandParent].left == parent)
+            nodes[grandParent].left = sibling;
+        else
+            nodes[grandParent].right = sibling;
+
+        Refit(grandParent);
+
+        return;
+    }
+
+    void DynamicAABBTree::Refit(std::size_t node)
+    {
+        while (node != NULL_NODE)
+        {
+            node = Balance(node);
+
+            const Node& left = nodes[nodes[node].left];
+            const Node& right = nodes[nodes[node].right];
+
+            nodes[node].height = 1 + std::max(left.height, right.height);
+            nodes[node].bounds = Union(left.bounds, right.bounds);
+
+            node = nodes[node].parent;
+        }
+
+        return;
+    }
+
+    std::size_t DynamicAABBTree::Balance(std::size_t a)
+    {
+        if (nodes[a].IsLeaf() || (nodes[a].height < 2))
+            return a;
+
+        const std::size_t b = nodes[a].left;
+        const std::size_t c = nodes[a].right;
+        const int balance = nodes[c].height - nodes[b].height;
+
+        // Which child to rotate up, and the other one
+        std::size_t up;
+        std::size_t stay;
+        if (balance > 1)
+        {
+            up = c;
+            stay = b;
+        }
+        else if (balance < -1)
+        {
+            up = b;
+            stay = c;
+        }
+        else
+            return a;
+
+        // The taller grandchild stays with `up`, the shorter one moves down to `a`, in place of `up`
+        const std::size_t f = nodes[up].left;
+        const std::size_t g = nodes[up].right;
+        const std::size_t taller = (nodes[f].height > nodes[g].height) ? f : g;
+        const std::size_t shorter = (taller == f) ? g : f;
+
+        // `up` takes the place of `a`
+        nodes[up].parent = nodes[a].parent;
+        if (nodes[up].parent == NULL_NODE)
+            root = up;
+        else if (nodes[nodes[up].parent].left == a)
+            nodes[nodes[up].parent].left = up;
+        else
+            nodes[nodes[up].parent].right = up;
+
+        nodes[up].left = a;
+        nodes[up].right = taller;
+        nodes[a].parent = up;
+
+        if (up == c)
+            nodes[a].right = shorter;
+        else
+            nodes[a].left = shorter;
+        nodes[shorter].parent = a;
+
+        nodes[a].bounds = Union(nodes[stay].bounds, nodes[shorter].bounds);
+        nodes[a].height = 1 + std::max(nodes[stay].height, nodes[shorter].height);
+
+        nodes[up].bounds = Union(nodes[a].bounds, nodes[taller].bounds);
+        nodes[up].height = 1 + std::max(nodes[a].height, nodes[taller].height);
+
+        return up;
+    }
+
+    template <typename Test, typename Visit>
+    void DynamicAABBTree::Traverse(Test test, Visit visit) const
+    {
+        if (root == NULL_NODE)
+            return;
+
+        std::vector<std::size_t> stack;
+        stack.reserve(64);
+        stack.push_back(root);
+
+        while (!stack.empty())
+        {
+            const std::size_t index = stack.back();
+            stack.pop_back();
+
+            const Node& node = nodes[index];
+            if (!test(node.bounds))
+                continue;
+
+            if (node.IsLeaf())
+                visit(index);
+            else
+            {
+                stack.push_back(node.left);
+                stack.push_back(node.right);
+            }
+        }
+
+        return;
+    }
+
+    void DynamicAABBTree::Query(const AABB& box, std::vector<std::size_t>& out) const
+    {
+        Traverse(
+            [&box](const AABB& bounds) { return Overlaps(bounds, box); },
+            [&out](std::size_t leaf) { out.push_back(leaf); }
+        );
+
+        return;
+    }
+
+    void DynamicAABBTree::FindContaining(const Vector3d& point, std::vector<std::size_t>& out) const
+    {
+        Traverse(
+            [&point](const AABB& bounds) { return ContainsPoint(bounds, point); },
+            [this, &point, &out](std::size_t leaf)
+            {
+                const Collider* collider = nodes[leaf].collider;
+                if ((collider == nullptr) || (collider->Contains(point)))
+                    out.push_back(leaf);
+            }
+        );
+
+        return;
+    }
+
+    void DynamicAABBTree::Raycast(const Vector3d& origin, const Vector3d& direction, double maxT, std::vector<std::size_t>& out) const
+    {
+        const Vector3d inverseDirection(
+            (direction.x == 0) ? std::numeric_limits<double>::infinity() : 1.0 / direction.x,
+            (direction.y == 0) ? std::numeric_limits<double>::infinity() : 1.0 / direction.y,
+            (direction.z == 0) ? std::numeric_limits<double>::infinity() : 1.0 / direction.z
+        );
+
+        Traverse(
+            [&](const AABB& bounds) { return RayHitsBox(bounds, origin, inverseDirection, maxT); },
+            [&out](std::size_t leaf) { out.push_back(leaf); }
+        );
+
+        return;
+    }
+
+    void DynamicAABBTree::FindOverlappingPairs(std::vector<std::pair<std::size_t, std::size_t>>& out) const
+    {
+        for (std::size_t i = 0; i < nodes.size(); i++)
+        {
+            if (nodes[i].height != 0)
+                continue;
+
+            const AABB& bounds = nodes[i].bounds;
+            Traverse(
+                [&bounds](const AABB& other) { return Overlaps(bounds, other); },
+                [i, &out](std::size_t leaf)
+                {
+                    if (leaf > i)
+                        out.emplace_back(i, leaf);
+                }
+            );
+        }
+
+        return;
+    }
+}
@@ -0,0 +1,431 @@
+#include "Eule/Frustum.h"
+#include "Eule/Math.h"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+//#define _EULE_NO_INTRINSICS_
+#ifndef _EULE_NO_INTRINSICS_
+#include <immintrin.h>
+#endif
+
+namespace Leonetienne::Eule {
+
+    Frustum::Frustum()
+    {
+        SetFromMatrix(Matrix4x4());
+        return;
+    }
+
+    Frustum::Frustum(const Matrix4x4& viewProjection)
+    {
+        SetFromMatrix(viewProjection);
+        return;
+    }
+
+    void Frustum::operator=(const Frustum& other)
+    {
+        nx = other.nx;
+        ny = other.ny;
+        nz = other.nz;
+        d = other.d;
+        corners = other.corners;
+
+        return;
+    }
+
+    void Frustum::operator=(Frustum&& other) noexcept
+    {
+        nx = std::move(other.nx);
+        ny = std::move(other.ny);
+        nz = std::move(other.nz);
+        d = std::move(other.d);
+        corners = std::move(other.corners);
+
+        return;
+    }
+
+    void Frustum::SetFromMatrix(const Matrix4x4& viewProjection)
+    {
+        /*
+        * BEGIN_REF
+        * Gribb, Hartmann: Fast Extraction of Viewing Frustum Planes from the World-View-Projection Matrix
+        */
+        const std::array<double, 4>& row0 = viewProjection[0];
+        const std::array<double, 4>& row1 = viewProjection[1];
+        const std::array<double, 4>& row2 = viewProjection[2];
+        const std::array<double, 4>& row3 = viewProjection[3];
+
+        for (std::size_t i = 0; i < 6; i++)
+        {
+            // Which row to combine with row3, and with what sign
+            const std::array<double, 4>& row = (i < 2) ? row0 : ((i < 4) ? row1 : row2);
+            const double sign = (i % 2 == 0) ? 1.0 : -1.0;
+
+            nx[i] = row3[0] + sign * row[0];
+            ny[i] = row3[1] + sign * row[1];
+            nz[i] = row3[2] + sign * row[2];
+            d[i]  = row3[3] + sign * row[3];
+
+            // Normalize
+            const double length = sqrt(nx[i] * nx[i] + ny[i] * ny[i] + nz[i] * nz[i]);
+            if (length != 0)
+            {
+                nx[i] /= length;
+                ny[i] /= length;
+                nz[i] /= length;
+                d[i] /= length;
+            }
+        }
+        /*
+        * END REF
+        */
+
+        // Intersect the three planes meeting at each corner: n1.p = -d1, n2.p = -d2, n3.p = -d3
+        for (std::size_t i = 0; i < 8; i++)
+        {
+            const std::size_t a = (i & 2) ? RIGHT : LEFT;
+            const std::size_t b = (i & 1) ? TOP : BOTTOM;
+            const std::size_t c = (i & 4) ? FRONT : BACK;
+
+            const Vector3d n1 = GetPlaneNormal(a);
+            const Vector3d n2 = GetPlaneNormal(b);
+            const Vector3d n3 = GetPlaneNormal(c);
+
+            const Vector3d n2n3 = n2.CrossProduct(n3);
+            const Vector3d n3n1 = n3.CrossProduct(n1);
+            const Vector3d n1n2 = n1.CrossProduct(n2);
+
+            const double det = n1.x * n2n3.x + n1.y * n2n3.y + n1.z * n2n3.z;
+
+            // Parallel planes don't meet
+            if (det == 0)
+                corners[i] = Vector3d::zero;
+            else
+                corners[i] = (n2n3 * d[a] + n3n1 * d[b] + n1n2 * d[c]) * (-1.0 / det);
+        }
+
+        return;
+    }
+
+    Vector3d Frustum::GetPlaneNormal(std::size_t plane) const
+    {
+        return Vector3d(nx[plane], ny[plane], nz[plane]);
+    }
+
+    double Frustum::GetPlaneOffset(std::size_t plane) const
+    {
+        return d[plane];
+    }
+
+    const Vector3d& Frustum::GetCorner(std::size_t index) const
+    {
+        return corners[index];
+    }
+
+    bool Frustum::Contains(const Vector3d& point) const
+    {
+        for (std::size_t i = 0; i < 6; i++)
+            if (nx[i] * point.x + ny[i] * point.y + nz[i] * point.z + d[i] < 0)
+                return false;
+
+        return true;
+    }
+
+    Vector3d Frustum::SupportPoint(const Vector3d& direction) const
+    {
+        std::size_t best = 0;
+        double bestDot = -std::numeric_limits<double>::infinity();
+
+        for (std::size_t i = 0; i < 8; i++)
+        {
+            const double dot = corners[i].x * direction.x + corners[i].y * direction.y + corners[i].z * direction.z;
+            if (dot > bestDot)
+            {
+                bestDot = dot;
+                best = i;
+            }
+        }
+
+        return corners[best];
+    }
+
+    void Frustum::Contains(
+        const std::vector<Frustum>& frustums,
+        const Vector3d& point,
+        std::vector<std::size_t>& out)
+    {
+        // Qualified, to skip the virtual dispatch
+        for (std::size_t i = 0; i < frustums.size(); i++)
+            if (frustums[i].Frustum::Contains(point))
+                out.push_back(i);
+
+        return;
+    }
+
+    Frustum::CLASSIFICATION Frustum::ClassifySphere(const Vector3d& center, double radius) const
+    {
+        CLASSIFICATION result;
+        Classify<false, false>(&center, &radius, nullptr, 1, &result, nullptr);
+
+        return result;
+    }
+
+    Frustum::CLASSIFICATION Frustum::ClassifyAABB(const AABB& box) const
+    {
+        CLASSIFICATION result;
+        Classify<true, false>(nullptr, nullptr, &box, 1, &result, nullptr);
+
+        return result;
+    }
+
+    void Frustum::ClassifySpheres(
+        const std::vector<Vector3d>& centers,
+        const std::vector<double>& radii,
+        std::vector<CLASSIFICATION>& out) const
+    {
+        if (centers.size() != radii.size())
+            throw std::invalid_argument("Every sphere needs exactly one radius!");
+
+        out.resize(centers.size());
+        Classify<false, false>(centers.data(), radii.data(), nullptr, centers.size(), out.data(), nullptr);
+
+        return;
+    }
+
+    void Frustum::ClassifySpheres(
+        const std::vector<Vector3d>& centers,
+        const std::vector<double>& radii,
+        std::vector<CLASSIFICATION>& out,
+        std::vector<std::uint8_t>& lastRejectingPlane) const
+    {
+        if (centers.size() != radii.size())
+            throw std::invalid_argument("Every sphere needs exactly one radius!");
+
+        out.resize(centers.size());
+        lastRejectingPlane.resize(centers.size(), 0);
+        Classify<false, true>(centers.data(), radii.data(), nullptr, centers.size(), out.data(), lastRejectingPlane.data());
+
+        return;
+    }
+
+    void Frustum::ClassifyAABBs(
+        const std::vector<AABB>& boxes,
+        std::vector<CLASSIFICATION>& out) const
+    {
+        out.resize(boxes.size());
+        Classify<true, false>(nullptr, nullptr, boxes.data(), boxes.size(), out.data(), nullptr);
+
+        return;
+    }
+
+    void Frustum::ClassifyAABBs(
+        const std::vector<AABB>& boxes,
+        std::vector<CLASSIFICATION>& out,
+        std::vector<std::uint8_t>& lastRejectingPlane) const
+    {
+        out.resize(boxes.size());
+        lastRejectingPlane.resize(boxes.size(), 0);
+        Classify<true, true>(nullptr, nullptr, boxes.data(), boxes.size(), out.data(), lastRejectingPlane.data());
+
+        return;
+    }
+
+    template <bool isBox, bool isCoherent>
+    void Frustum::Classify(
+        const Vector3d* centers,
+        const double* radii,
+        const AABB* boxes,
+        std::size_t count,
+        CLASSIFICATION* out,
+        std::uint8_t* lastRejectingPlane) const
+    {
+        std::size_t i = 0;
+
+#ifndef _EULE_NO_INTRINSICS_
+
+        // Four objects per iteration. Every register holds one component of four objects
+        const __m256d __half = _mm256_set1_pd(0.5);
+        const __m256d __zero = _mm256_setzero_pd();
+
+        for (; i + 4 <= count; i += 4)
+        {
+            // Load centers and radii (for spheres), or extents (for boxes)
+            __m256d __cx, __cy, __cz;
+            __m256d __ex, __ey, __ez;
+            __m256d __r;
+
+            if constexpr (isBox)
+            {
+                const AABB* b = &boxes[i];
+                __m256d __minx = _mm256_set_pd(b[3].min.x, b[2].min.x, b[1].min.x, b[0].min.x);
+                __m256d __miny = _mm256_set_pd(b[3].min.y, b[2].min.y, b[1].min.y, b[0].min.y);
+                __m256d __minz = _mm256_set_pd(b[3].min.z, b[2].min.z, b[1].min.z, b[0].min.z);
+                __m256d __maxx = _mm256_set_pd(b[3].max.x, b[2].max.x, b[1].max.x, b[0].max.x);
+                __m256d __maxy = _mm256_set_pd(b[3].max.y, b[2].max.y, b[1].max.y, b[0].max.y);
+                __m256d __maxz = _mm256_set_pd(b[3].max.z, b[2].max.z, b[1].max.z, b[0].max.z);
+
+                __cx = _mm256_mul_pd(_mm256_add_pd(__minx, __maxx), __half);
+                __cy = _mm256_mul_pd(_mm256_add_pd(__miny, __maxy), __half);
+                __cz = _mm256_mul_pd(_mm256_add_pd(__minz, __maxz), __half);
+                __ex = _mm256_mul_pd(_mm256_sub_pd(__maxx, __minx), __half);
+                __ey = _mm256_mul_pd(_mm256_sub_pd(__maxy, __miny), __half);
+                __ez = _mm256_mul_pd(_mm256_sub_pd(__maxz, __minz), __half);
+            }
+            else
+            {
+                const Vector3d* c = &centers[i];
+                __cx = _mm256_set_pd(c[3].x, c[2].x, c[1].x, c[0].x);
+                __cy = _mm256_set_pd(c[3].y, c[2].y, c[1].y, c[0].y);
+                __cz = _mm256_set_pd(c[3].z, c[2].z, c[1].z, c[0].z);
+                __r = _mm256_loadu_pd(&radii[i]);
+            }
+
+            // Computes the signed distance of all four objects to a plane, and their projected radius,
+            // given the plane's components in registers
+            auto planeTest = [&](__m256d __nx, __m256d __ny, __m256d __nz, __m256d __d, __m256d& __rOut) {
+                if constexpr (isBox)
+                {
+                    // Abs via clearing the sign bit
+                    const __m256d __signMask = _mm256_set1_pd(-0.0);
+                    __rOut = _mm256_mul_pd(__ex, _mm256_andnot_pd(__signMask, __nx));
+                    __rOut = _mm256_fmadd_pd(__ey, _mm256_andnot_pd(__signMask, __ny), __rOut);
+                    __rOut = _mm256_fmadd_pd(__ez, _mm256_andnot_pd(__signMask, __nz), __rOut);
+                }
+                else
+                    __rOut = __r;
+
+                __m256d __dist = _mm256_fmadd_pd(__nx, __cx, __d);
+                __dist = _mm256_fmadd_pd(__ny, __cy, __dist);
+                __dist = _mm256_fmadd_pd(__nz, __cz, __dist);
+                return __dist;
+            };
+
+            int rejectedByCache = 0;
+            if constexpr (isCoherent)
+            {
+                // Test the plane that rejected each object last time first
+                const std::uint8_t* p = &lastRejectingPlane[i];
+                __m256d __rp;
+                __m256d __dist = planeTest(
+                    _mm256_set_pd(nx[p[3]], nx[p[2]], nx[p[1]], nx[p[0]]),
+                    _mm256_set_pd(ny[p[3]], ny[p[2]], ny[p[1]], ny[p[0]]),
+                    _mm256_set_pd(nz[p[3]], nz[p[2]], nz[p[1]], nz[p[0]]),
+                    _mm256_set_pd(d[p[3]], d[p[2]], d[p[1]], d[p[0]]),
+                    __rp
+                );
+
+                rejectedByCache = _mm256_movemask_pd(_mm256_cmp_pd(__dist, _mm256_sub_pd(__zero, __rp), _CMP_LT_OQ));
+
+                // Culled all four with a single plane
+                if (rejectedByCache == 0xF)
+                {
+                    for (std::size_t j = 0; j < 4; j++)
+                        out[i + j] = CLASSIFICATION::OUTSIDE;
+                    continue;
+                }
+            }
+
+            int outside = rejectedByCache;
+            int intersecting = 0;
+            for (std::size_t plane = 0; plane < 6; plane++)
+            {
+                __m256d __rp;
+                __m256d __dist = planeTest(
+                    _mm256_set1_pd(nx[plane]),
+                    _mm256_set1_pd(ny[plane]),
+                    _mm256_set1_pd(nz[plane]),
+                    _mm256_set1_pd(d[plane]),
+                    __rp
+                );
+
+                const int isOutside = _mm256_movemask_pd(_mm256_cmp_pd(__dist, _mm256_sub_pd(__zero, __rp), _CMP_LT_OQ));
+                intersecting |= _mm256_movemask_pd(_mm256_cmp_pd(__dist, __rp, _CMP_LT_OQ));
+
+                if constexpr (isCoherent)
+                {
+                    // Remember the first plane that rejected an object
+                    const int newlyOutside = isOutside & ~outside;
+                    for (std::size_t j = 0; j < 4; j++)
+                        if (newlyOutside & (1 << j))
+                            lastRejectingPlane[i + j] = (std::uint8_t)plane;
+                }
+
+                outside |= isOutside;
+
+                if (outside == 0xF)
+                    break;
+            }
+
+            for (std::size_t j = 0; j < 4; j++)
+            {
+                if (outside & (1 << j))
+                    out[i + j] = CLASSIFICATION::OUTSIDE;
+                else if (intersecting & (1 << j))
+                    out[i + j] = CLASSIFICATION::INTERSECTING;
+                else
+                    out[i + j] = CLASSIFICATION::INSIDE;
+            }
+        }
+
+#endif
+
+        // Remaining objects (or all of them, without intrinsics)
+        for (; i < count; i++)
+        {
+            Vector3d center;
+            Vector3d extent;
+            if constexpr (isBox)
+            {
+                center = (boxes[i].min + boxes[i].max) * 0.5;
+                extent = (boxes[i].max - boxes[i].min) * 0.5;
+            }
+            else
+                center = centers[i];
+
+            // Computes the signed distance to a plane, and the projected radius
+            auto planeTest = [&](std::size_t plane, double& r) {
+                if constexpr (isBox)
+                    r = extent.x * Math::Abs(nx[plane]) + extent.y * Math::Abs(ny[plane]) + extent.z * Math::Abs(nz[plane]);
+                else
+                    r = radii[i];
+
+                return nx[plane] * center.x + ny[plane] * center.y + nz[plane] * center.z + d[plane];
+            };
+
+            if constexpr (isCoherent)
+            {
+                // Test the plane that rejected this object last time first
+                double r;
+                if (planeTest(lastRejectingPlane[i], r) < -r)
+                {
+                    out[i] = CLASSIFICATION::OUTSIDE;
+                    continue;
+                }
+            }
+
+            CLASSIFICATION result = CLASSIFICATION::INSIDE;
+            for (std::size_t plane = 0; plane < 6; plane++)
+            {
+                double r;
+                const double dist = planeTest(plane, r);
+
+                if (dist < -r)
+                {
+                    result = CLASSIFICATION::OUTSIDE;
+
+                    if constexpr (isCoherent)
+                        lastRejectingPlane[i] = (std::uint8_t)plane;
+
+                    break;
+                }
+                else if (dist < r)
+                    result = CLASSIFICATION::INTERSECTING;
+            }
+
+            out[i] = result;
+        }
+
+        return;
+    }
+}
@@ -0,0 +1,236 @@
+#include "Eule/KDTree.h"
+#include "Eule/Parallel.h"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+namespace Leonetienne::Eule {
+
+    namespace {
+        inline double SqrDistance(const Vector3d& a, const Vector3d& b)
+        {
+            const double dx = a.x - b.x;
+            const double dy = a.y - b.y;
+            const double dz = a.z - b.z;
+
+            return dx * dx + dy * dy + dz * dz;
+        }
+    }
+
+    KDTree::KDTree(const std::vector<Vector3d>& points, std::size_t threadCount)
+        :
+        points { points },
+        indices(points.size()),
+        axes(points.size(), 0)
+    {
+        std::iota(indices.begin(), indices.end(), 0);
+
+        // While building, only the indices get reordered. `points` stays in its original order
+        Build(0, points.size(), Parallel::ThreadCount(threadCount));
+
+        for (std::size_t i = 0; i < indices.size(); i++)
+            this->points[i] = points[indices[i]];
+
+        return;
+    }
+
+    std::size_t KDTree::Nearest(const Vector3d& point) const
+    {
+        if (points.empty())
+            throw std::logic_error("The tree is empty!");
+
+        std::vector<Candidate> heap;
+        heap.reserve(1);
+        SearchKNearest(0, points.size(), point, 1, heap);
+
+        return indices[heap.front().index];
+    }
+
+    void KDTree::KNearest(const Vector3d& point, std::size_t k, std::vector<std::size_t>& out) const
+    {
+        k = std::min(k, points.size());
+        if (k == 0)
+            return;
+
+        std::vector<Candidate> heap;
+        heap.reserve(k);
+        SearchKNearest(0, points.size(), point, k, heap);
+
+        std::sort_heap(heap.begin(), heap.end());
+        for (const Candidate& c : heap)
+            out.push_back(indices[c.index]);
+
+        return;
+    }
+
+    void KDTree::Radius(const Vector3d& center, double radius, std::vector<std::size_t>& out) const
+    {
+        if (radius >= 0)
+            SearchRadius(0, points.size(), center, radius * radius, out);
+
+        return;
+    }
+
+    void KDTree::Nearest(const std::vector<Vector3d>& queries, std::vector<std::size_t>& out, std::size_t threadCount) const
+    {
+        if (points.empty())
+            throw std::logic_error("The tree is empty!");
+
+        out.resize(queries.size());
+
+        Parallel::For(queries.size(), threadCount, MIN_QUERIES_PER_THREAD, [&](std::size_t begin, std::size_t end) {
+            std::vector<Candidate> heap;
+            heap.reserve(1);
+
+            for (std::size_t i = begin; i < end; i++)
+            {
+                heap.clear();
+                SearchKNearest(0, points.size(), queries[i], 1, heap);
+                out[i] = indices[heap.front().index];
+            }
+        });
+
+        return;
+    }
+
+    void KDTree::KNearest(const std::vector<Vector3d>& queries, std::size_t k, std::vector<std::size_t>& out, std::size_t threadCount) const
+    {
+        k = std::min(k, points.size());
+        out.resize(queries.size() * k);
+
+        if (k == 0)
+            return;
+
+        Parallel::For(queries.size(), threadCount, MIN_QUERIES_PER_THREAD, [&](std::size_t begin, std::size_t end) {
+            std::vector<Candidate> heap;
+            heap.reserve(k);
+
+            for (std::size_t i = begin; i < end; i++)
+            {
+                heap.clear();
+                SearchKNearest(0, points.size(), queries[i], k, heap);
+                std::sort_heap(heap.begin(), heap.end());
+
+                for (std::size_t j = 0; j < k; j++)
+                    out[i * k + j] = indices[heap[j].index];
+            }
+        });
+
+        return;
+    }
+
+    std::size_t KDTree::Size() const
+    {
+        return points.size();
+    }
+
+    void KDTree::Build(std::size_t begin, std::size_t end, std::size_t threads)
+    {
+        if (end - begin <= 1)
+            return;
+
+        // Split along the axis the points spread the most
+        Vector3d min = points[indices[begin]];
+        Vector3d max = min;
+        for (std::size_t i = begin + 1; i < end; i++)
+        {
+            const Vector3d& p = points[indices[i]];
+            min.x = std::min(min.x, p.x); max.x = std::max(max.x, p.x);
+            min.y = std::min(min.y, p.y); max.y = std::max(max.y, p.y);
+            min.z = std::min(min.z, p.z); max.z = std::max(max.z, p.z);
+        }
+
+        const Vector3d extent = max - min;
+        std::uint8_t axis = 0;
+        if (extent.y > extent[axis]) axis = 1;
+        if (extent.z > extent[axis]) axis = 2;
+
+        // Partition around the median. Points left of it are <= it along the axis, points right of it are >= it
+        const std::size_t mid = begin + (end - begin) / 2;
+        std::nth_element(
+            indices.begin() + begin, indices.begin() + mid, indices.begin() + end,
+            [this, axis](std::size_t a, std::size_t b) { return points[a][axis] < points[b][axis]; }
+        );
+        axes[mid] = axis;
+
+        // Both halves touch disjoint ranges, so they can be built at once
+        if ((threads > 1) && (end - begin >= MIN_POINTS_PER_THREAD))
+        {
+            std::thread left(&KDTree::Build, this, begin, mid, threads / 2);
+            Build(mid + 1, end, threads - threads / 2);
+            left.join();
+        }
+        else
+        {
+            Build(begin, mid, 1);
+            Build(mid + 1, end, 1);
+        }
+
+        return;
+    }
+
+    void KDTree::SearchKNearest(std::size_t begin, std::size_t end, const Vector3d& point, std::size_t k, std::vector<Candidate>& heap) const
+    {
+        if (begin >= end)
+            return;
+
+        const std::size_t mid = begin + (end - begin) / 2;
+        const Vector3d& p = points[mid];
+
+        const double sqrDistance = SqrDistance(point, p);
+        if (heap.size() < k)
+        {
+            heap.push_back(Candidate { sqrDistance, mid });
+            std::push_heap(heap.begin(), heap.end());
+        }
+        else if (sqrDistance < heap.front().sqrDistance)
+        {
+            std::pop_heap(heap.begin(), heap.end());
+            heap.back() = Candidate { sqrDistance, mid };
+            std::push_heap(heap.begin(), heap.end());
+        }
+
+        const std::uint8_t axis = axes[mid];
+        const double offset = point[axis] - p[axis];
+
+        // Search the side of the split the point lies on first. The other side is at least |offset| away
+        if (offset < 0)
+        {
+            SearchKNearest(begin, mid, point, k, heap);
+            if ((heap.size() < k) || (offset * offset < heap.front().sqrDistance))
+                SearchKNearest(mid + 1, end, point, k, heap);
+        }
+        else
+        {
+            SearchKNearest(mid + 1, end, point, k, heap);
+            if ((heap.size() < k) || (offset * offset < heap.front().sqrDistance))
+                SearchKNearest(begin, mid, point, k, heap);
+        }
+
+        return;
+    }
+
+    void KDTree::SearchRadius(std::size_t begin, std::size_t end, const Vector3d& center, double sqrRadius, std::vector<std::size_t>& out) const
+    {
+        if (begin >= end)
+            return;
+
+        const std::size_t mid = begin + (end - begin) / 2;
+        const Vector3d& p = points[mid];
+
+        if (SqrDistance(center, p) <= sqrRadius)
+            out.push_back(indices[mid]);
+
+        const std::uint8_t axis = axes[mid];
+        const double offset = center[axis] - p[axis];
+
+        if ((offset <= 0) || (offset * offset <= sqrRadius))
+            SearchRadius(begin, mid, center, sqrRadius, out);
+
+        if ((offset >= 0) || (offset * offset <= sqrRadius))
+            SearchRadius(mid + 1, end, center, sqrRadius, out);
+
+        return;
+    }
+}
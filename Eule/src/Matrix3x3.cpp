@@ -0,0 +1,379 @@
+#include "Eule/Matrix3x3.h"
+#include "Eule/Quaternion.h"
+#include "Eule/Vector4.h"
+#include "Eule/Math.h"
+#include <cmath>
+#include <stdexcept>
+
+//#define _EULE_NO_INTRINSICS_
+#ifndef _EULE_NO_INTRINSICS_
+#include <immintrin.h>
+#endif
+
+#include "Pack.h"
+
+namespace Leonetienne::Eule {
+
+    using namespace Internal;
+
+    namespace {
+        /* The closed forms below are written once, for doubles and Packs (see Pack.h).
+        * With doubles, they process one matrix. With packs of four doubles, they process four at once. */
+
+#ifndef _EULE_NO_INTRINSICS_
+        //! Will load the same value of four consecutive matrices
+        inline void Gather(const Matrix3x3* matrices, Pack (&m)[3][3])
+        {
+            for (std::size_t y = 0; y < 3; y++)
+                for (std::size_t x = 0; x < 3; x++)
+                    m[y][x] = _mm256_set_pd(matrices[3][y][x], matrices[2][y][x], matrices[1][y][x], matrices[0][y][x]);
+
+            return;
+        }
+
+        //! Will store each lane into its own matrix
+        inline void Scatter(const Pack (&m)[3][3], Matrix3x3* matrices)
+        {
+            alignas(32) double lanes[4];
+            for (std::size_t y = 0; y < 3; y++)
+                for (std::size_t x = 0; x < 3; x++)
+                {
+                    _mm256_store_pd(lanes, m[y][x].v);
+                    for (std::size_t i = 0; i < 4; i++)
+                        matrices[i][y][x] = lanes[i];
+                }
+
+            return;
+        }
+#endif
+
+        template <typename T>
+        void MultiplyKernel(const T (&a)[3][3], const T (&b)[3][3], T (&out)[3][3])
+        {
+            for (std::size_t y = 0; y < 3; y++)
+                for (std::size_t x = 0; x < 3; x++)
+                    out[y][x] = (a[y][0] * b[0][x]) + (a[y][1] * b[1][x]) + (a[y][2] * b[2][x]);
+
+            return;
+        }
+
+        template <typename T>
+        void Cross(const T (&a)[3], const T (&b)[3], T (&out)[3])
+        {
+            out[0] = a[1] * b[2] - a[2] * b[1];
+            out[1] = a[2] * b[0] - a[0] * b[2];
+            out[2] = a[0] * b[1] - a[1] * b[0];
+
+            return;
+        }
+
+        template <typename T>
+        T DeterminantKernel(const T (&m)[3][3])
+        {
+            T cross[3];
+            Cross(m[1], m[2], cross);
+
+            return m[0][0] * cross[0] + m[0][1] * cross[1] + m[0][2] * cross[2];
+        }
+
+        //! Will write the inverse of `m` to `out`, and return the determinant. Does not check it
+        template <typename T>
+        T InverseKernel(const T (&m)[3][3], T (&out)[3][3])
+        {
+            // The inverse is the transposed adjugate, divided by the determinant. The adjugate's columns are cross products of rows
+            T cross[3][3];
+            for (std::size_t k = 0; k < 3; k++)
+                Cross(m[(k + 1) % 3], m[(k + 2) % 3], cross[k]);
+
+            const T det = m[0][0] * cross[0][0] + m[0][1] * cross[0][1] + m[0][2] * cross[0][2];
+
+            for (std::size_t y = 0; y < 3; y++)
+                for (std::size_t x = 0; x < 3; x++)
+                    out[y][x] = cross[x][y] / det;
+
+            return det;
+        }
+
+        inline void ToArray(const Matrix3x3& matrix, double (&m)[3][3])
+        {
+            for (std::size_t y = 0; y < 3; y++)
+                for (std::size_t x = 0; x < 3; x++)
+                    m[y][x] = matrix[y][x];
+
+            return;
+        }
+
+        inline void FromArray(const double (&m)[3][3], Matrix3x3& matrix)
+        {
+            for (std::size_t y = 0; y < 3; y++)
+                for (std::size_t x = 0; x < 3; x++)
+                    matrix[y][x] = m[y][x];
+
+            return;
+        }
+    }
+
+    Matrix3x3::Matrix3x3()
+    {
+        // Create identity matrix
+        for (std::size_t i = 0; i < 3; i++)
+            for (std::size_t j = 0; j < 3; j++)
+                v[i][j] = double(i == j);
+
+        return;
+    }
+
+    Matrix3x3::Matrix3x3(const Matrix4x4& matrix)
+    {
+        for (std::size_t i = 0; i < 3; i++)
+            for (std::size_t j = 0; j < 3; j++)
+                v[i][j] = matrix[i][j];
+
+        return;
+    }
+
+    Matrix3x3::Matrix3x3(const Quaternion& rotation)
+        :
+        Matrix3x3(rotation.ToRotationMatrix())
+    {
+        return;
+    }
+
+    void Matrix3x3::operator=(const Matrix3x3& other)
+    {
+        v = other.v;
+        return;
+    }
+
+    void Matrix3x3::operator=(Matrix3x3&& other) noexcept
+    {
+        v = std::move(other.v);
+        return;
+    }
+
+    Matrix4x4 Matrix3x3::ToMatrix4x4() const
+    {
+        // Default-constructs to the identity, so there is no translation already
+        Matrix4x4 matrix;
+        for (std::size_t i = 0; i < 3; i++)
+            for (std::size_t j = 0; j < 3; j++)
+                matrix[i][j] = v[i][j];
+
+        return matrix;
+    }
+
+    Quaternion Matrix3x3::ToQuaternion() const
+    {
+        // Quaternion::ToRotationMatrix() yields v[0][1] - v[1][0] = 4wz, v[1][2] - v[2][1] = 4wx, v[2][0] - v[0][2] = 4wy,
+        // and v[0][1] + v[1][0] = 4xy and so on. Dividing by the largest of w, x, y and z keeps this stable (Shepperd's method)
+        const double trace = v[0][0] + v[1][1] + v[2][2];
+        Vector4d q;
+
+        if (trace > 0)
+        {
+            q.w = std::sqrt(1 + trace) / 2;
+            q.x = (v[1][2] - v[2][1]) / (4 * q.w);
+            q.y = (v[2][0] - v[0][2]) / (4 * q.w);
+            q.z = (v[0][1] - v[1][0]) / (4 * q.w);
+        }
+        else if ((v[0][0] >= v[1][1]) && (v[0][0] >= v[2][2]))
+        {
+            q.x = std::sqrt(1 + v[0][0] - v[1][1] - v[2][2]) / 2;
+            q.w = (v[1][2] - v[2][1]) / (4 * q.x);
+            q.y = (v[0][1] + v[1][0]) / (4 * q.x);
+            q.z = (v[0][2] + v[2][0]) / (4 * q.x);
+        }
+        else if (v[1][1] >= v[2][2])
+        {
+            q.y = std::sqrt(1 - v[0][0] + v[1][1] - v[2][2]) / 2;
+            q.w = (v[2][0] - v[0][2]) / (4 * q.y);
+            q.x = (v[0][1] + v[1][0]) / (4 * q.y);
+            q.z = (v[1][2] + v[2][1]) / (4 * q.y);
+        }
+        else
+        {
+            q.z = std::sqrt(1 - v[0][0] - v[1][1] + v[2][2]) / 2;
+            q.w = (v[0][1] - v[1][0]) / (4 * q.z);
+            q.x = (v[0][2] + v[2][0]) / (4 * q.z);
+            q.y = (v[1][2] + v[2][1]) / (4 * q.z);
+        }
+
+        return Quaternion(q);
+    }
+
+    Matrix3x3 Matrix3x3::operator*(const Matrix3x3& other) const
+    {
+        Matrix3x3 result;
+
+#ifndef _EULE_NO_INTRINSICS_
+
+        // Rows only have three values. The fourth lane never gets loaded or stored
+        const __m256i __mask = _mm256_set_epi64x(0, -1, -1, -1);
+        const __m256d __o0 = _mm256_maskload_pd(other.v[0].data(), __mask);
+        const __m256d __o1 = _mm256_maskload_pd(other.v[1].data(), __mask);
+        const __m256d __o2 = _mm256_maskload_pd(other.v[2].data(), __mask);
+
+        // Each row of the result is a linear combination of the rows of `other`
+        for (std::size_t y = 0; y < 3; y++)
+        {
+            __m256d __row = _mm256_mul_pd(_mm256_set1_pd(v[y][0]), __o0);
+            __row = _mm256_fmadd_pd(_mm256_set1_pd(v[y][1]), __o1, __row);
+            __row = _mm256_fmadd_pd(_mm256_set1_pd(v[y][2]), __o2, __row);
+            _mm256_maskstore_pd(result.v[y].data(), __mask, __row);
+        }
+
+#else
+
+        double a[3][3];
+        double b[3][3];
+        double product[3][3];
+        ToArray(*this, a);
+        ToArray(other, b);
+        MultiplyKernel(a, b, product);
+        FromArray(product, result);
+
+#endif
+
+        return result;
+    }
+
+    void Matrix3x3::operator*=(const Matrix3x3& other)
+    {
+        *this = *this * other;
+        return;
+    }
+
+    Vector3d Matrix3x3::TransformVector(const Vector3d& vec) const
+    {
+        return Vector3d(
+            (v[0][0] * vec.x) + (v[0][1] * vec.y) + (v[0][2] * vec.z),
+            (v[1][0] * vec.x) + (v[1][1] * vec.y) + (v[1][2] * vec.z),
+            (v[2][0] * vec.x) + (v[2][1] * vec.y) + (v[2][2] * vec.z)
+        );
+    }
+
+    Matrix3x3 Matrix3x3::Transpose() const
+    {
+        Matrix3x3 trans;
+        for (std::size_t i = 0; i < 3; i++)
+            for (std::size_t j = 0; j < 3; j++)
+                trans[i][j] = v[j][i];
+
+        return trans;
+    }
+
+    double Matrix3x3::Determinant() const
+    {
+        double m[3][3];
+        ToArray(*this, m);
+
+        return DeterminantKernel(m);
+    }
+
+    Matrix3x3 Matrix3x3::Inverse() const
+    {
+        double m[3][3];
+        double inverse[3][3];
+        ToArray(*this, m);
+
+        if (InverseKernel(m, inverse) == 0.0)
+            throw std::runtime_error("Matrix3x3 not inversible!");
+
+        Matrix3x3 inv;
+        FromArray(inverse, inv);
+
+        return inv;
+    }
+
+    bool Matrix3x3::IsInversible() const
+    {
+        return Determinant() != 0;
+    }
+
+    void Matrix3x3::Multiply(const std::vector<Matrix3x3>& a, const std::vector<Matrix3x3>& b, std::vector<Matrix3x3>& out)
+    {
+        if (a.size() != b.size())
+            throw std::invalid_argument("Every matrix needs exactly one matrix to be multiplied with!");
+
+        out.resize(a.size());
+        std::size_t i = 0;
+
+#ifndef _EULE_NO_INTRINSICS_
+
+        for (; i + 4 <= a.size(); i += 4)
+        {
+            Pack pa[3][3];
+            Pack pb[3][3];
+            Pack product[3][3];
+            Gather(&a[i], pa);
+            Gather(&b[i], pb);
+            MultiplyKernel(pa, pb, product);
+            Scatter(product, &out[i]);
+        }
+
+#endif
+
+        for (; i < a.size(); i++)
+            out[i] = a[i] * b[i];
+
+        return;
+    }
+
+    void Matrix3x3::Inverse(const std::vector<Matrix3x3>& matrices, std::vector<Matrix3x3>& out)
+    {
+        out.resize(matrices.size());
+        std::size_t i = 0;
+
+#ifndef _EULE_NO_INTRINSICS_
+
+        for (; i + 4 <= matrices.size(); i += 4)
+        {
+            Pack m[3][3];
+            Pack inverse[3][3];
+            Gather(&matrices[i], m);
+
+            const Pack det = InverseKernel(m, inverse);
+            if (_mm256_movemask_pd(_mm256_cmp_pd(det.v, _mm256_setzero_pd(), _CMP_EQ_OQ)))
+                throw std::runtime_error("Matrix3x3 not inversible!");
+
+            Scatter(inverse, &out[i]);
+        }
+
+#endif
+
+        for (; i < matrices.size(); i++)
+            out[i] = matrices[i].Inverse();
+
+        return;
+    }
+
+    std::array<double, 3>& Matrix3x3::operator[](std::size_t y)
+    {
+        return v[y];
+    }
+
+    const std::array<double, 3>& Matrix3x3::operator[](std::size_t y) const
+    {
+        return v[y];
+    }
+
+    bool Matrix3x3::operator==(const Matrix3x3& other) const
+    {
+        return v == other.v;
+    }
+
+    bool Matrix3x3::operator!=(const Matrix3x3& other) const
+    {
+        return !operator==(other);
+    }
+
+    bool Matrix3x3::Similar(const Matrix3x3& other, double epsilon) const
+    {
+        for (std::size_t i = 0; i < 3; i++)
+            for (std::size_t j = 0; j < 3; j++)
+                if (!Math::Similar(v[i][j], other[i][j], epsilon))
+                    return false;
+
+        return true;
+    }
+}
@@ -0,0 +1,396 @@
+#include "Eule/MatrixDecomposition.h"
+#include "Eule/Parallel.h"
+#include <algorithm>
+#include <cmath>
+
+//#define _EULE_NO_INTRINSICS_
+#ifndef _EULE_NO_INTRINSICS_
+#include <immintrin.h>
+#endif
+
+#include "Pack.h"
+
+namespace Leonetienne::Eule {
+
+    using namespace Internal;
+
+    namespace {
+        // Keeps rotation formulas from dividing zero by zero, without branching
+        constexpr double TINY = 1e-300;
+
+        /* The decompositions below are written once, for doubles and Packs (see Pack.h).
+        * With doubles, they decompose one matrix. With packs of four doubles, they decompose four at once. */
+
+        template <typename T>
+        void SetIdentity(T (&m)[3][3])
+        {
+            for (std::size_t y = 0; y < 3; y++)
+                for (std::size_t x = 0; x < 3; x++)
+                    m[y][x] = T(double(x == y));
+
+            return;
+        }
+
+        //! Will apply a Jacobi rotation zeroing a[p][q] to the symmetric `a`, and accumulate it into `v`
+        template <typename T>
+        void JacobiRotate(T (&a)[3][3], T (&v)[3][3], std::size_t p, std::size_t q)
+        {
+            // t = tan(angle), from (a[q][q] - a[p][p]) / 2a[p][q] = cot(2 angle), picking the smaller angle
+            const T d = a[q][q] - a[p][p];
+            const T o = a[p][q] * T(2);
+            const T t = CopySign(T(1), d) * o / (Abs(d) + Sqrt(d * d + o * o) + T(TINY));
+            const T c = T(1) / Sqrt(t * t + T(1));
+            const T s = t * c;
+
+            const std::size_t r = 3 - p - q;
+            const T apq = a[p][q];
+            const T arp = a[r][p];
+            const T arq = a[r][q];
+
+            a[p][p] = a[p][p] - t * apq;
+            a[q][q] = a[q][q] + t * apq;
+            a[p][q] = a[q][p] = T(0);
+            a[r][p] = a[p][r] = c * arp - s * arq;
+            a[r][q] = a[q][r] = s * arp + c * arq;
+
+            for (std::size_t k = 0; k < 3; k++)
+            {
+                const T vkp = v[k][p];
+                const T vkq = v[k][q];
+                v[k][p] = c * vkp - s * vkq;
+                v[k][q] = s * vkp + c * vkq;
+            }
+
+            return;
+        }
+
+        //! Will swap values[i] and values[j], if values[j] is larger. Returns whether they got swapped
+        template <typename T>
+        auto OrderPair(T (&values)[3], std::size_t i, std::size_t j)
+        {
+            const auto swap = Greater(values[j], values[i]);
+            const T vi = values[i];
+            values[i] = Select(swap, values[j], vi);
+            values[j] = Select(swap, vi, values[j]);
+
+            return swap;
+        }
+
+        //! Will swap columns i and j where `swap` is set, negating one of them, so rotations stay rotations
+        template <typename T, typename Mask>
+        void SwapColumns(const Mask& swap, T (&m)[3][3], std::size_t i, std::size_t j)
+        {
+            for (std::size_t k = 0; k < 3; k++)
+            {
+                const T a = m[k][i];
+                const T b = m[k][j];
+                m[k][i] = Select(swap, b, a);
+                m[k][j] = Select(swap, -a, b);
+            }
+
+            return;
+        }
+
+        //! Will diagonalize the symmetric `a` in place, writing its eigenvalues, in descending order, and eigenvectors
+        template <typename T>
+        void Eigen(T (&a)[3][3], T (&values)[3], T (&v)[3][3])
+        {
+            SetIdentity(v);
+
+            for (std::size_t sweep = 0; sweep < MatrixDecomposition::JACOBI_SWEEPS; sweep++)
+            {
+                JacobiRotate(a, v, 0, 1);
+                JacobiRotate(a, v, 0, 2);
+                JacobiRotate(a, v, 1, 2);
+            }
+
+            for (std::size_t i = 0; i < 3; i++)
+                values[i] = a[i][i];
+
+            // A sorting network of three
+            SwapColumns(OrderPair(values, 0, 1), v, 0, 1);
+            SwapColumns(OrderPair(values, 0, 2), v, 0, 2);
+            SwapColumns(OrderPair(values, 1, 2), v, 1, 2);
+
+            return;
+        }
+
+        //! Will apply a Givens rotation to rows p and q of `b`, zeroing b[q][p], and accumulate its transpose into `u`
+        template <typename T>
+        void GivensRotate(T (&b)[3][3], T (&u)[3][3], std::size_t p, std::size_t q)
+        {
+            const T x = b[p][p];
+            const T y = b[q][p];
+            const T r = Sqrt(x * x + y * y);
+
+            // Nothing to rotate, if both are zero
+            const auto valid = Greater(r, T(TINY));
+            const T c = Select(valid, x / r, T(1));
+            const T s = Select(valid, y / r, T(0));
+
+            for (std::size_t k = 0; k < 3; k++)
+            {
+                const T bp = b[p][k];
+                const T bq = b[q][k];
+                b[p][k] = c * bp + s * bq;
+                b[q][k] = c * bq - s * bp;
+
+                const T up = u[k][p];
+                const T uq = u[k][q];
+                u[k][p] = c * up + s * uq;
+                u[k][q] = c * uq - s * up;
+            }
+
+            return;
+        }
+
+        template <typename T>
+        void Svd(const T (&m)[3][3], T (&u)[3][3], T (&sigma)[3], T (&v)[3][3])
+        {
+            // V diagonalizes m^T m
+            T mtm[3][3];
+            for (std::size_t y = 0; y < 3; y++)
+                for (std::size_t x = 0; x < 3; x++)
+                    mtm[y][x] = m[0][y] * m[0][x] + m[1][y] * m[1][x] + m[2][y] * m[2][x];
+
+            T values[3];
+            Eigen(mtm, values, v);
+
+            // m * v has orthogonal columns, with lengths of the singular values
+            T b[3][3];
+            for (std::size_t y = 0; y < 3; y++)
+                for (std::size_t x = 0; x < 3; x++)
+                    b[y][x] = m[y][0] * v[0][x] + m[y][1] * v[1][x] + m[y][2] * v[2][x];
+
+            // Order by the column lengths. These are more precise than the eigenvalues for small singular values
+            T lengths[3];
+            for (std::size_t x = 0; x < 3; x++)
+                lengths[x] = b[0][x] * b[0][x] + b[1][x] * b[1][x] + b[2][x] * b[2][x];
+
+            const std::size_t pairs[3][2] = { { 0, 1 }, { 0, 2 }, { 1, 2 } };
+            for (const std::size_t (&pair)[2] : pairs)
+            {
+                const auto swap = OrderPair(lengths, pair[0], pair[1]);
+                SwapColumns(swap, b, pair[0], pair[1]);
+                SwapColumns(swap, v, pair[0], pair[1]);
+            }
+
+            // QR decomposition of b. As its columns are orthogonal, R is diagonal
+            SetIdentity(u);
+            GivensRotate(b, u, 0, 1);
+            GivensRotate(b, u, 0, 2);
+            GivensRotate(b, u, 1, 2);
+
+            for (std::size_t i = 0; i < 3; i++)
+                sigma[i] = b[i][i];
+
+            return;
+        }
+
+        inline void Load(const Matrix4x4& matrix, double (&m)[3][3])
+        {
+            for (std::size_t y = 0; y < 3; y++)
+                for (std::size_t x = 0; x < 3; x++)
+                    m[y][x] = matrix[y][x];
+
+            return;
+        }
+
+        inline Matrix4x4 ToMatrix(const double (&m)[3][3])
+        {
+            Matrix4x4 matrix;
+            for (std::size_t y = 0; y < 3; y++)
+                for (std::size_t x = 0; x < 3; x++)
+                    matrix[y][x] = m[y][x];
+
+            return matrix;
+        }
+
+#ifndef _EULE_NO_INTRINSICS_
+        //! Will load the matrices [first, first + 4)
+        inline void Load(const std::vector<Matrix4x4>& matrices, std::size_t first, Pack (&m)[3][3])
+        {
+            for (std::size_t y = 0; y < 3; y++)
+                for (std::size_t x = 0; x < 3; x++)
+                    m[y][x] = _mm256_set_pd(matrices[first + 3][y][x], matrices[first + 2][y][x], matrices[first + 1][y][x], matrices[first][y][x]);
+
+            return;
+        }
+
+        inline void Store(const Pack (&m)[3][3], std::vector<Matrix4x4>& matrices, std::size_t first)
+        {
+            alignas(32) double lanes[4];
+            for (std::size_t y = 0; y < 3; y++)
+                for (std::size_t x = 0; x < 3; x++)
+                {
+                    _mm256_store_pd(lanes, m[y][x].v);
+                    for (std::size_t i = 0; i < 4; i++)
+                        matrices[first + i][y][x] = lanes[i];
+                }
+
+            return;
+        }
+
+        inline void Store(const Pack (&values)[3], std::vector<Vector3d>& vectors, std::size_t first)
+        {
+            alignas(32) double lanes[4];
+            for (std::size_t k = 0; k < 3; k++)
+            {
+                _mm256_store_pd(lanes, values[k].v);
+                for (std::size_t i = 0; i < 4; i++)
+                    vectors[first + i][k] = lanes[i];
+            }
+
+            return;
+        }
+#endif
+
+        template <typename T>
+        void Symmetrize(T (&m)[3][3])
+        {
+            m[1][0] = m[0][1];
+            m[2][0] = m[0][2];
+            m[2][1] = m[1][2];
+
+            return;
+        }
+    }
+
+    void MatrixDecomposition::SymmetricEigen(const Matrix4x4& symmetric, Vector3d& eigenvalues, Matrix4x4& eigenvectors)
+    {
+        double a[3][3];
+        Load(symmetric, a);
+        Symmetrize(a);
+
+        double values[3];
+        double v[3][3];
+        Eigen(a, values, v);
+
+        eigenvalues = Vector3d(values[0], values[1], values[2]);
+        eigenvectors = ToMatrix(v);
+
+        return;
+    }
+
+    void MatrixDecomposition::SymmetricEigen(
+        const std::vector<Matrix4x4>& symmetric,
+        std::vector<Vector3d>& eigenvalues,
+        std::vector<Matrix4x4>& eigenvectors,
+        std::size_t threadCount)
+    {
+        eigenvalues.resize(symmetric.size());
+        eigenvectors.resize(symmetric.size());
+
+        // Chunks in multiples of four, so only the last one has a scalar tail
+        const std::size_t groups = (symmetric.size() + 3) / 4;
+
+        Parallel::For(groups, threadCount, MIN_MATRICES_PER_THREAD / 4, [&](std::size_t beginGroup, std::size_t endGroup) {
+            std::size_t i = beginGroup * 4;
+            const std::size_t end = std::min(endGroup * 4, symmetric.size());
+
+#ifndef _EULE_NO_INTRINSICS_
+            for (; i + 4 <= end; i += 4)
+            {
+                Pack a[3][3];
+                Load(symmetric, i, a);
+                Symmetrize(a);
+
+                Pack values[3];
+                Pack v[3][3];
+                Eigen(a, values, v);
+
+                Store(values, eigenvalues, i);
+                Store(v, eigenvectors, i);
+            }
+#endif
+
+            for (; i < end; i++)
+                SymmetricEigen(symmetric[i], eigenvalues[i], eigenvectors[i]);
+        });
+
+        return;
+    }
+
+    void MatrixDecomposition::SVD(const Matrix4x4& matrix, Matrix4x4& u, Vector3d& sigma, Matrix4x4& v)
+    {
+        double m[3][3];
+        Load(matrix, m);
+
+        double u3[3][3];
+        double s3[3];
+        double v3[3][3];
+        Svd(m, u3, s3, v3);
+
+        u = ToMatrix(u3);
+        sigma = Vector3d(s3[0], s3[1], s3[2]);
+        v = ToMatrix(v3);
+
+        return;
+    }
+
+    void MatrixDecomposition::SVD(
+        const std::vector<Matrix4x4>& matrices,
+        std::vector<Matrix4x4>& u,
+        std::vector<Vector3d>& sigma,
+        std::vector<Matrix4x4>& v,
+        std::size_t threadCount)
+    {
+        u.resize(matrices.size());
+        sigma.resize(matrices.size());
+        v.resize(matrices.size());
+
+        // Chunks in multiples of four, so only the last one has a scalar tail
+        const std::size_t groups = (matrices.size() + 3) / 4;
+
+        Parallel::For(groups, threadCount, MIN_MATRICES_PER_THREAD / 4, [&](std::size_t beginGroup, std::size_t endGroup) {
+            std::size_t i = beginGroup * 4;
+            const std::size_t end = std::min(endGroup * 4, matrices.size());
+
+#ifndef _EULE_NO_INTRINSICS_
+            for (; i + 4 <= end; i += 4)
+            {
+                Pack m[3][3];
+                Load(matrices, i, m);
+
+                Pack u4[3][3];
+                Pack s4[3];
+                Pack v4[3][3];
+                Svd(m, u4, s4, v4);
+
+                Store(u4, u, i);
+                Store(s4, sigma, i);
+                Store(v4, v, i);
+            }
+#endif
+
+            for (; i < end; i++)
+                SVD(matrices[i], u[i], sigma[i], v[i]);
+        });
+
+        return;
+    }
+
+    void MatrixDecomposition::Polar(const Matrix4x4& matrix, Matrix4x4& rotation, Matrix4x4& stretch)
+    {
+        Matrix4x4 u;
+        Vector3d sigma;
+        Matrix4x4 v;
+        SVD(matrix, u, sigma, v);
+
+        // rotation = u * v^T, stretch = v * diag(sigma) * v^T
+        double r[3][3] = {};
+        double s[3][3] = {};
+        for (std::size_t y = 0; y < 3; y++)
+            for (std::size_t x = 0; x < 3; x++)
+                for (std::size_t k = 0; k < 3; k++)
+                {
+                    r[y][x] += u[y][k] * v[x][k];
+                    s[y][x] += v[y][k] * sigma[k] * v[x][k];
+                }
+
+        rotation = ToMatrix(r);
+        stretch = ToMatrix(s);
+
+        return;
+    }
+}
@@ -0,0 +1,330 @@
+#include "Eule/Morton.h"
+#include "Eule/Parallel.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+
+//#define _EULE_NO_INTRINSICS_
+#ifndef _EULE_NO_INTRINSICS_
+#include <immintrin.h>
+#endif
+
+namespace Leonetienne::Eule {
+
+    namespace {
+        constexpr std::uint64_t MASK_2D = 0x5555555555555555ull;
+        constexpr std::uint64_t MASK_3D = 0x1249249249249249ull;
+
+        // Biases signed 3d components into [0, 2^21)
+        constexpr std::int64_t BIAS_3D = 1ll << 20;
+
+        //! Will spread the lower 32 bits of x to every second bit
+        inline std::uint64_t Spread2(std::uint64_t x)
+        {
+#if !defined(_EULE_NO_INTRINSICS_) && defined(__BMI2__)
+            return _pdep_u64(x, MASK_2D);
+#else
+            x &= 0x00000000FFFFFFFFull;
+            x = (x | (x << 16)) & 0x0000FFFF0000FFFFull;
+            x = (x | (x << 8))  & 0x00FF00FF00FF00FFull;
+            x = (x | (x << 4))  & 0x0F0F0F0F0F0F0F0Full;
+            x = (x | (x << 2))  & 0x3333333333333333ull;
+            x = (x | (x << 1))  & MASK_2D;
+            return x;
+#endif
+        }
+
+        //! Will gather every second bit of x into the lower 32 bits. The inverse of Spread2()
+        inline std::uint64_t Compact2(std::uint64_t x)
+        {
+#if !defined(_EULE_NO_INTRINSICS_) && defined(__BMI2__)
+            return _pext_u64(x, MASK_2D);
+#else
+            x &= MASK_2D;
+            x = (x | (x >> 1))  & 0x3333333333333333ull;
+            x = (x | (x >> 2))  & 0x0F0F0F0F0F0F0F0Full;
+            x = (x | (x >> 4))  & 0x00FF00FF00FF00FFull;
+            x = (x | (x >> 8))  & 0x0000FFFF0000FFFFull;
+            x = (x | (x >> 16)) & 0x00000000FFFFFFFFull;
+            return x;
+#endif
+        }
+
+        //! Will spread the lower 21 bits of x to every third bit
+        inline std::uint64_t Spread3(std::uint64_t x)
+        {
+#if !defined(_EULE_NO_INTRINSICS_) && defined(__BMI2__)
+            return _pdep_u64(x, MASK_3D);
+#else
+            x &= 0x1FFFFFull;
+            x = (x | (x << 32)) & 0x001F00000000FFFFull;
+            x = (x | (x << 16)) & 0x001F0000FF0000FFull;
+            x = (x | (x << 8))  & 0x100F00F00F00F00Full;
+            x = (x | (x << 4))  & 0x10C30C30C30C30C3ull;
+            x = (x | (x << 2))  & MASK_3D;
+            return x;
+#endif
+        }
+
+        //! Will gather every third bit of x into the lower 21 bits. The inverse of Spread3()
+        inline std::uint64_t Compact3(std::uint64_t x)
+        {
+#if !defined(_EULE_NO_INTRINSICS_) && defined(__BMI2__)
+            return _pext_u64(x, MASK_3D);
+#else
+            x &= MASK_3D;
+            x = (x | (x >> 2))  & 0x10C30C30C30C30C3ull;
+            x = (x | (x >> 4))  & 0x100F00F00F00F00Full;
+            x = (x | (x >> 8))  & 0x001F0000FF0000FFull;
+            x = (x | (x >> 16)) & 0x001F00000000FFFFull;
+            x = (x | (x >> 32)) & 0x1FFFFFull;
+            return x;
+#endif
+        }
+
+        //! Cells per unit, for each axis of a box. Flat axes map everything onto their first cell
+        inline Vector3d GridScale(const AABB& bounds)
+        {
+            const double cells = (double)Morton::CELLS_3D;
+            const Vector3d extent = bounds.max - bounds.min;
+
+            return Vector3d(
+                (extent.x > 0) ? (cells / extent.x) : 0,
+                (extent.y > 0) ? (cells / extent.y) : 0,
+                (extent.z > 0) ? (cells / extent.z) : 0
+            );
+        }
+
+        //! Will return the grid cell of a coordinate along one axis
+        inline std::uint64_t Quantize(double value, double min, double scale)
+        {
+            const double cell = std::floor((value - min) * scale);
+            return (std::uint64_t)std::min(std::max(cell, 0.0), (double)(Morton::CELLS_3D - 1));
+        }
+
+        //! The bits of the code that the radix sort looks at per pass
+        constexpr std::size_t RADIX_BITS = 8;
+        constexpr std::size_t RADIX_BUCKETS = 1 << RADIX_BITS;
+    }
+
+    std::uint64_t Morton::Encode(const Vector2i& cell)
+    {
+        // Flipping the sign bit maps int onto unsigned, keeping the order
+        const std::uint64_t x = (std::uint32_t)cell.x ^ 0x80000000u;
+        const std::uint64_t y = (std::uint32_t)cell.y ^ 0x80000000u;
+
+        return Spread2(x) | (Spread2(y) << 1);
+    }
+
+    std::uint64_t Morton::Encode(const Vector3i& cell)
+    {
+        const std::uint64_t x = (std::uint64_t)(cell.x + BIAS_3D);
+        const std::uint64_t y = (std::uint64_t)(cell.y + BIAS_3D);
+        const std::uint64_t z = (std::uint64_t)(cell.z + BIAS_3D);
+
+        return Spread3(x) | (Spread3(y) << 1) | (Spread3(z) << 2);
+    }
+
+    std::uint64_t Morton::Encode(const Vector3d& point, const AABB& bounds)
+    {
+        const Vector3d scale = GridScale(bounds);
+
+        return
+            Spread3(Quantize(point.x, bounds.min.x, scale.x)) |
+            (Spread3(Quantize(point.y, bounds.min.y, scale.y)) << 1) |
+            (Spread3(Quantize(point.z, bounds.min.z, scale.z)) << 2);
+    }
+
+    void Morton::Encode(const std::vector<Vector3d>& points, const AABB& bounds, std::vector<std::uint64_t>& out)
+    {
+        out.resize(points.size());
+
+        const Vector3d scale = GridScale(bounds);
+        std::size_t i = 0;
+
+#ifndef _EULE_NO_INTRINSICS_
+
+        // Four points per iteration. Every register holds one component of four points
+        const __m256d __minx = _mm256_set1_pd(bounds.min.x);
+        const __m256d __miny = _mm256_set1_pd(bounds.min.y);
+        const __m256d __minz = _mm256_set1_pd(bounds.min.z);
+        const __m256d __scalex = _mm256_set1_pd(scale.x);
+        const __m256d __scaley = _mm256_set1_pd(scale.y);
+        const __m256d __scalez = _mm256_set1_pd(scale.z);
+        const __m256d __zero = _mm256_setzero_pd();
+        const __m256d __lastCell = _mm256_set1_pd((double)(CELLS_3D - 1));
+
+        // Same as Quantize(), for four values, widened to 64-bit lanes
+        const auto quantize = [&](__m256d __v, __m256d __min, __m256d __scale) {
+            __m256d __cell = _mm256_floor_pd(_mm256_mul_pd(_mm256_sub_pd(__v, __min), __scale));
+            __cell = _mm256_min_pd(_mm256_max_pd(__cell, __zero), __lastCell);
+            return _mm256_cvtepu32_epi64(_mm256_cvttpd_epi32(__cell));
+        };
+
+        // Same as Spread3(), on four 64-bit lanes
+        const auto spread = [](__m256i __x) {
+            __x = _mm256_and_si256(_mm256_or_si256(__x, _mm256_slli_epi64(__x, 32)), _mm256_set1_epi64x(0x001F00000000FFFFll));
+            __x = _mm256_and_si256(_mm256_or_si256(__x, _mm256_slli_epi64(__x, 16)), _mm256_set1_epi64x(0x001F0000FF0000FFll));
+            __x = _mm256_and_si256(_mm256_or_si256(__x, _mm256_slli_epi64(__x, 8)),  _mm256_set1_epi64x(0x100F00F00F00F00Fll));
+            __x = _mm256_and_si256(_mm256_or_si256(__x, _mm256_slli_epi64(__x, 4)),  _mm256_set1_epi64x(0x10C30C30C30C30C3ll));
+            __x = _mm256_and_si256(_mm256_or_si256(__x, _mm256_slli_epi64(__x, 2)),  _mm256_set1_epi64x((long long)MASK_3D));
+            return __x;
+        };
+
+        for (; i + 4 <= points.size(); i += 4)
+        {
+            const Vector3d* p = &points[i];
+            const __m256d __x = _mm256_set_pd(p[3].x, p[2].x, p[1].x, p[0].x);
+            const __m256d __y = _mm256_set_pd(p[3].y, p[2].y, p[1].y, p[0].y);
+            const __m256d __z = _mm256_set_pd(p[3].z, p[2].z, p[1].z, p[0].z);
+
+            const __m256i __code = _mm256_or_si256(
+                spread(quantize(__x, __minx, __scalex)),
+                _mm256_or_si256(
+                    _mm256_slli_epi64(spread(quantize(__y, __miny, __scaley)), 1),
+                    _mm256_slli_epi64(spread(quantize(__z, __minz, __scalez)), 2)
+                )
+            );
+
+            _mm256_storeu_si256((__m256i*)&out[i], __code);
+        }
+
+#endif
+
+        // Remaining points (or all of them, without intrinsics)
+        for (; i < points.size(); i++)
+            out[i] =
+                Spread3(Quantize(points[i].x, bounds.min.x, scale.x)) |
+                (Spread3(Quantize(points[i].y, bounds.min.y, scale.y)) << 1) |
+                (Spread3(Quantize(points[i].z, bounds.min.z, scale.z)) << 2);
+
+        return;
+    }
+
+    Vector2i Morton::Decode2(std::uint64_t code)
+    {
+        return Vector2i(
+            (int)((std::uint32_t)Compact2(code) ^ 0x80000000u),
+            (int)((std::uint32_t)Compact2(code >> 1) ^ 0x80000000u)
+        );
+    }
+
+    Vector3i Morton::Decode3(std::uint64_t code)
+    {
+        return Vector3i(
+            (int)((std::int64_t)Compact3(code) - BIAS_3D),
+            (int)((std::int64_t)Compact3(code >> 1) - BIAS_3D),
+            (int)((std::int64_t)Compact3(code >> 2) - BIAS_3D)
+        );
+    }
+
+    Vector3d Morton::Decode(std::uint64_t code, const AABB& bounds)
+    {
+        const Vector3d cellSize = (bounds.max - bounds.min) * (1.0 / (double)CELLS_3D);
+
+        return Vector3d(
+            bounds.min.x + ((double)Compact3(code) + 0.5) * cellSize.x,
+            bounds.min.y + ((double)Compact3(code >> 1) + 0.5) * cellSize.y,
+            bounds.min.z + ((double)Compact3(code >> 2) + 0.5) * cellSize.z
+        );
+    }
+
+    void Morton::Sort(std::vector<std::uint64_t>& codes, std::vector<std::size_t>& permutation, std::size_t threadCount)
+    {
+        const std::size_t count = codes.size();
+
+        permutation.resize(count);
+        std::iota(permutation.begin(), permutation.end(), 0);
+
+        if (count < 2)
+            return;
+
+        // Digits that are equal for all codes need no pass
+        std::uint64_t differingBits = 0;
+        for (std::uint64_t code : codes)
+            differingBits |= code ^ codes[0];
+
+        // Every chunk gets its own histogram. Scattering chunk by chunk, in order, keeps the sort stable
+        const std::size_t chunks = Parallel::ChunkCount(count, threadCount, MIN_CODES_PER_THREAD);
+        const std::size_t chunkSize = (count + chunks - 1) / chunks;
+
+        std::vector<std::array<std::size_t, RADIX_BUCKETS>> offsets(chunks);
+        std::vector<std::uint64_t> codesOut(count);
+        std::vector<std::size_t> permutationOut(count);
+
+        for (std::size_t shift = 0; shift < 64; shift += RADIX_BITS)
+        {
+            if (((differingBits >> shift) & (RADIX_BUCKETS - 1)) == 0)
+                continue;
+
+            // Count the digits of each chunk
+            Parallel::For(chunks, chunks, 1, [&](std::size_t beginChunk, std::size_t endChunk) {
+                for (std::size_t c = beginChunk; c < endChunk; c++)
+                {
+                    offsets[c].fill(0);
+                    for (std::size_t i = c * chunkSize; i < std::min((c + 1) * chunkSize, count); i++)
+                        offsets[c][(codes[i] >> shift) & (RADIX_BUCKETS - 1)]++;
+                }
+            });
+
+            // Turn the counts into where each chunk starts writing each digit
+            std::size_t offset = 0;
+            for (std::size_t digit = 0; digit < RADIX_BUCKETS; digit++)
+                for (std::size_t c = 0; c < chunks; c++)
+                {
+                    const std::size_t digitCount = offsets[c][digit];
+                    offsets[c][digit] = offset;
+                    offset += digitCount;
+                }
+
+            // Scatter
+            Parallel::For(chunks, chunks, 1, [&](std::size_t beginChunk, std::size_t endChunk) {
+                for (std::size_t c = beginChunk; c < endChunk; c++)
+                    for (std::size_t i = c * chunkSize; i < std::min((c + 1) * chunkSize, count); i++)
+                    {
+                        const std::size_t target = offsets[c][(codes[i] >> shift) & (RADIX_BUCKETS - 1)]++;
+                        codesOut[target] = codes[i];
+                        permutationOut[target] = permutation[i];
+                    }
+            });
+
+            std::swap(codes, codesOut);
+            std::swap(permutation, permutationOut);
+        }
+
+        return;
+    }
+
+    void Morton::Sort(std::vector<Vector3d>& points, std::size_t threadCount)
+    {
+        std::vector<std::size_t> permutation;
+        SortPoints(points, permutation, threadCount);
+
+        return;
+    }
+
+    void Morton::SortPoints(std::vector<Vector3d>& points, std::vector<std::size_t>& permutation, std::size_t threadCount)
+    {
+        if (points.empty())
+        {
+            permutation.clear();
+            return;
+        }
+
+        AABB bounds { points[0], points[0] };
+        for (const Vector3d& p : points)
+            for (std::size_t i = 0; i < 3; i++)
+            {
+                bounds.min[i] = std::min(bounds.min[i], p[i]);
+                bounds.max[i] = std::max(bounds.max[i], p[i]);
+            }
+
+        std::vector<std::uint64_t> codes;
+        Encode(points, bounds, codes);
+        Sort(codes, permutation, threadCount);
+        Permute(points, permutation);
+
+        return;
+    }
+}
@@ -0,0 +1,578 @@
+#include "Eule/OBB.h"
+#include "Eule/PointStatistics.h"
+#include "Eule/MatrixDecomposition.h"
+#include "Eule/Parallel.h"
+#include "Eule/Vector2.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+//#define _EULE_NO_INTRINSICS_
+#ifndef _EULE_NO_INTRINSICS_
+#include <immintrin.h>
+#endif
+
+namespace Leonetienne::Eule {
+
+    namespace {
+        // Gets added to the absolute rotation terms of the separating axis test.
+        // Cross products of near-parallel edges are near zero, and would otherwise report separations that are mere rounding errors
+        constexpr double SAT_EPSILON = 1e-12;
+
+        Matrix4x4 RotationFromAxes(const std::array<Vector3d, 3>& axes)
+        {
+            Matrix4x4 rotation;
+            for (std::size_t y = 0; y < 3; y++)
+                for (std::size_t x = 0; x < 3; x++)
+                    rotation[y][x] = axes[x][y];
+
+            return rotation;
+        }
+
+        //! Will return the smallest box with the given axes enclosing all points
+        OBB FitToAxes(const std::vector<Vector3d>& points, const std::array<Vector3d, 3>& axes, std::size_t threadCount)
+        {
+            const std::size_t chunks = Parallel::ChunkCount(points.size(), threadCount, OBB::MIN_POINTS_PER_THREAD);
+            const std::size_t chunkSize = (points.size() + chunks - 1) / chunks;
+
+            std::vector<Vector3d> mins(chunks, Vector3d(1, 1, 1) * std::numeric_limits<double>::infinity());
+            std::vector<Vector3d> maxs(chunks, Vector3d(1, 1, 1) * -std::numeric_limits<double>::infinity());
+
+            Parallel::For(chunks, chunks, 1, [&](std::size_t beginChunk, std::size_t endChunk) {
+                for (std::size_t c = beginChunk; c < endChunk; c++)
+                    for (std::size_t i = c * chunkSize; i < std::min((c + 1) * chunkSize, points.size()); i++)
+                        for (std::size_t k = 0; k < 3; k++)
+                        {
+                            const double projection = points[i].DotProduct(axes[k]);
+                            mins[c][k] = std::min(mins[c][k], projection);
+                            maxs[c][k] = std::max(maxs[c][k], projection);
+                        }
+            });
+
+            for (std::size_t c = 1; c < chunks; c++)
+                for (std::size_t k = 0; k < 3; k++)
+                {
+                    mins[0][k] = std::min(mins[0][k], mins[c][k]);
+                    maxs[0][k] = std::max(maxs[0][k], maxs[c][k]);
+                }
+
+            Vector3d center;
+            Vector3d halfSize;
+            for (std::size_t k = 0; k < 3; k++)
+            {
+                center += axes[k] * ((mins[0][k] + maxs[0][k]) * 0.5);
+                halfSize[k] = (maxs[0][k] - mins[0][k]) * 0.5;
+            }
+
+            return OBB(center, halfSize, RotationFromAxes(axes));
+        }
+
+        //! Will return the convex hull of points, counter-clockwise, without collinear points (Andrew's monotone chain)
+        std::vector<Vector2d> ConvexHull(std::vector<Vector2d> points)
+        {
+            std::sort(points.begin(), points.end(), [](const Vector2d& a, const Vector2d& b) {
+                return (a.x < b.x) || ((a.x == b.x) && (a.y < b.y));
+            });
+            points.erase(std::unique(points.begin(), points.end()), points.end());
+
+            if (points.size() < 3)
+                return points;
+
+            std::vector<Vector2d> hull(points.size() * 2);
+            std::size_t size = 0;
+
+            // Lower hull
+            for (std::size_t i = 0; i < points.size(); i++)
+            {
+                while ((size >= 2) && ((hull[size - 1] - hull[size - 2]).CrossProduct(points[i] - hull[size - 2]) <= 0))
+                    size--;
+                hull[size++] = points[i];
+            }
+
+            // Upper hull
+            const std::size_t lowerSize = size + 1;
+            for (std::size_t i = points.size() - 1; i-- > 0;)
+            {
+                while ((size >= lowerSize) && ((hull[size - 1] - hull[size - 2]).CrossProduct(points[i] - hull[size - 2]) <= 0))
+                    size--;
+                hull[size++] = points[i];
+            }
+
+            // The first point got appended again
+            hull.resize(size - 1);
+
+            return hull;
+        }
+
+        //! Will find the direction of one edge of the smallest rectangle enclosing a convex hull, using rotating calipers.
+        //! Such a rectangle always has an edge in common with the hull. Returns false if the hull has no edges
+        bool MinimumAreaRectangle(const std::vector<Vector2d>& hull, Vector2d& direction)
+        {
+            const std::size_t h = hull.size();
+            if (h < 2)
+                return false;
+
+            const auto along = [&](const Vector2d& axis, std::size_t i) {
+                return axis.x * hull[i].x + axis.y * hull[i].y;
+            };
+
+            double bestArea = std::numeric_limits<double>::infinity();
+
+            // The hull points furthest along the edge, furthest from it, and furthest against it
+            std::size_t right = 0;
+            std::size_t top = 0;
+            std::size_t left = 0;
+
+            for (std::size_t i = 0; i < h; i++)
+            {
+                const Vector2d delta = hull[(i + 1) % h] - hull[i];
+                const double length = std::sqrt(delta.x * delta.x + delta.y * delta.y);
+                const Vector2d edge(delta.x / length, delta.y / length);
+                const Vector2d normal(-edge.y, edge.x);
+
+                if (i == 0)
+                {
+                    for (std::size_t j = 1; j < h; j++)
+                    {
+                        if (along(edge, j) > along(edge, right)) right = j;
+                        if (along(normal, j) > along(normal, top)) top = j;
+                        if (along(edge, j) < along(edge, left)) left = j;
+                    }
+                }
+                else
+                {
+                    // As the edges turn counter-clockwise, so do the extreme points
+                    while (along(edge, (right + 1) % h) > along(edge, right)) right = (right + 1) % h;
+                    while (along(normal, (top + 1) % h) > along(normal, top)) top = (top + 1) % h;
+                    while (along(edge, (left + 1) % h) < along(edge, left)) left = (left + 1) % h;
+                }
+
+                const double area = (along(edge, right) - along(edge, left)) * (along(normal, top) - along(normal, i));
+                if (area < bestArea)
+                {
+                    bestArea = area;
+                    direction = edge;
+                }
+            }
+
+            return true;
+        }
+
+        //! Tests, if two boxes are separated along any of the 15 candidate axes (Gottschalk et al.)
+        bool Separated(const OBB& a, const OBB& b)
+        {
+            // b's axes, and the distance between the centers, in a's frame
+            double r[3][3];
+            double absR[3][3];
+            for (std::size_t i = 0; i < 3; i++)
+                for (std::size_t j = 0; j < 3; j++)
+                {
+                    r[i][j] = a.GetAxis(i).DotProduct(b.GetAxis(j));
+                    absR[i][j] = std::abs(r[i][j]) + SAT_EPSILON;
+                }
+
+            const Vector3d distance = b.GetCenter() - a.GetCenter();
+            const double t[3] = { distance.DotProduct(a.GetAxis(0)), distance.DotProduct(a.GetAxis(1)), distance.DotProduct(a.GetAxis(2)) };
+
+            const Vector3d& ha = a.GetHalfSize();
+            const Vector3d& hb = b.GetHalfSize();
+
+            // a's axes
+            for (std::size_t i = 0; i < 3; i++)
+                if (std::abs(t[i]) > ha[i] + hb[0] * absR[i][0] + hb[1] * absR[i][1] + hb[2] * absR[i][2])
+                    return true;
+
+            // b's axes
+            for (std::size_t j = 0; j < 3; j++)
+                if (std::abs(t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j]) > ha[0] * absR[0][j] + ha[1] * absR[1][j] + ha[2] * absR[2][j] + hb[j])
+                    return true;
+
+            // Cross products of both boxes' axes
+            for (std::size_t i = 0; i < 3; i++)
+                for (std::size_t j = 0; j < 3; j++)
+                {
+                    const std::size_t i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+                    const std::size_t j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+
+                    const double ra = ha[i1] * absR[i2][j] + ha[i2] * absR[i1][j];
+                    const double rb = hb[j1] * absR[i][j2] + hb[j2] * absR[i][j1];
+                    if (std::abs(t[i2] * r[i1][j] - t[i1] * r[i2][j]) > ra + rb)
+                        return true;
+                }
+
+            return false;
+        }
+    }
+
+    OBB::OBB()
+        :
+        center { Vector3d::zero },
+        halfSize { Vector3d(1, 1, 1) },
+        axes { Vector3d(1, 0, 0), Vector3d(0, 1, 0), Vector3d(0, 0, 1) }
+    {
+        return;
+    }
+
+    OBB::OBB(const Vector3d& center, const Vector3d& halfSize, const Matrix4x4& rotation)
+        :
+        center { center }
+    {
+        SetHalfSize(halfSize);
+        SetRotation(rotation);
+
+        return;
+    }
+
+    OBB::OBB(const AABB& box)
+        :
+        OBB((box.min + box.max) * 0.5, (box.max - box.min) * 0.5)
+    {
+        return;
+    }
+
+    void OBB::operator=(const OBB& other)
+    {
+        center = other.center;
+        halfSize = other.halfSize;
+        axes = other.axes;
+
+        return;
+    }
+
+    void OBB::operator=(OBB&& other) noexcept
+    {
+        center = std::move(other.center);
+        halfSize = std::move(other.halfSize);
+        axes = std::move(other.axes);
+
+        return;
+    }
+
+    OBB OBB::Fit(const std::vector<Vector3d>& points, std::size_t threadCount)
+    {
+        // Principal axes
+        const Matrix4x4 covariance = PointStatistics::Covariance(points, threadCount);
+
+        Vector3d eigenvalues;
+        Matrix4x4 eigenvectors;
+        MatrixDecomposition::SymmetricEigen(covariance, eigenvalues, eigenvectors);
+
+        std::array<Vector3d, 3> axes;
+        for (std::size_t k = 0; k < 3; k++)
+            axes[k] = Vector3d(eigenvectors[0][k], eigenvectors[1][k], eigenvectors[2][k]);
+
+        OBB best = FitToAxes(points, axes, threadCount);
+
+        // Keep one axis, and find the smallest rectangle in the plane of the other two
+        std::vector<Vector2d> projected(points.size());
+        for (std::size_t k = 0; k < 3; k++)
+        {
+            const Vector3d& u = axes[(k + 1) % 3];
+            const Vector3d& v = axes[(k + 2) % 3];
+
+            Parallel::For(points.size(), threadCount, MIN_POINTS_PER_THREAD, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++)
+                    projected[i] = Vector2d(points[i].DotProduct(u), points[i].DotProduct(v));
+            });
+
+            Vector2d direction;
+            if (!MinimumAreaRectangle(ConvexHull(projected), direction))
+                continue;
+
+            // Rotating u and v within their plane keeps the axes right-handed
+            std::array<Vector3d, 3> rotated = axes;
+            rotated[(k + 1) % 3] = u * direction.x + v * direction.y;
+            rotated[(k + 2) % 3] = v * direction.x - u * direction.y;
+
+            const OBB candidate = FitToAxes(points, rotated, threadCount);
+            if (candidate.GetVolume() < best.GetVolume())
+                best = candidate;
+        }
+
+        return best;
+    }
+
+    const Vector3d& OBB::GetCenter() const
+    {
+        return center;
+    }
+
+    void OBB::SetCenter(const Vector3d& center)
+    {
+        this->center = center;
+        return;
+    }
+
+    const Vector3d& OBB::GetHalfSize() const
+    {
+        return halfSize;
+    }
+
+    void OBB::SetHalfSize(const Vector3d& halfSize)
+    {
+        if ((halfSize.x < 0) || (halfSize.y < 0) || (halfSize.z < 0))
+            throw std::invalid_argument("The half size must not be negative!");
+
+        this->halfSize = halfSize;
+
+        return;
+    }
+
+    Matrix4x4 OBB::GetRotation() const
+    {
+        return RotationFromAxes(axes);
+    }
+
+    void OBB::SetRotation(const Matrix4x4& rotation)
+    {
+        for (std::size_t k = 0; k < 3; k++)
+            axes[k] = Vector3d(rotation[0][k], rotation[1][k], rotation[2][k]);
+
+        return;
+    }
+
+    const Vector3d& OBB::GetAxis(std::size_t axis) const
+    {
+        return axes[axis];
+    }
+
+    Vector3d OBB::GetCorner(std::size_t index) const
+    {
+        return center
+            + axes[0] * ((index & TrapazoidalPrismCollider::RIGHT) ? halfSize.x : -halfSize.x)
+            + axes[1] * ((index & TrapazoidalPrismCollider::TOP) ? halfSize.y : -halfSize.y)
+            + axes[2] * ((index & TrapazoidalPrismCollider::FRONT) ? halfSize.z : -halfSize.z);
+    }
+
+    double OBB::GetVolume() const
+    {
+        return 8 * halfSize.x * halfSize.y * halfSize.z;
+    }
+
+    AABB OBB::GetBounds() const
+    {
+        Vector3d extent;
+        for (std::size_t i = 0; i < 3; i++)
+            extent[i] = std::abs(axes[0][i]) * halfSize.x + std::abs(axes[1][i]) * halfSize.y + std::abs(axes[2][i]) * halfSize.z;
+
+        return AABB { center - extent, center + extent };
+    }
+
+    TrapazoidalPrismCollider OBB::ToPrism() const
+    {
+        // Prisms expect right-handed vertices. Mirrored axes get un-mirrored by swapping front and back
+        const Vector3d& a = axes[0];
+        const Vector3d& b = axes[1];
+        const double handedness = (a.y * b.z - a.z * b.y) * axes[2].x + (a.z * b.x - a.x * b.z) * axes[2].y + (a.x * b.y - a.y * b.x) * axes[2].z;
+        const std::size_t flip = (handedness < 0) ? TrapazoidalPrismCollider::FRONT : 0;
+
+        std::array<Vector3d, 8> vertices;
+        for (std::size_t i = 0; i < 8; i++)
+            vertices[i] = GetCorner(i ^ flip);
+
+        TrapazoidalPrismCollider prism;
+        prism.SetVertices(vertices);
+
+        return prism;
+    }
+
+    bool OBB::Contains(const Vector3d& point) const
+    {
+        const Vector3d d = point - center;
+
+        return
+            (std::abs(d.DotProduct(axes[0])) <= halfSize.x) &&
+            (std::abs(d.DotProduct(axes[1])) <= halfSize.y) &&
+            (std::abs(d.DotProduct(axes[2])) <= halfSize.z);
+    }
+
+    void OBB::Contains(const std::vector<Vector3d>& points, std::vector<std::size_t>& out) const
+    {
+        std::size_t i = 0;
+
+#ifndef _EULE_NO_INTRINSICS_
+        const __m256d __signBit = _mm256_set1_pd(-0.0);
+        const __m256d __cx = _mm256_set1_pd(center.x);
+        const __m256d __cy = _mm256_set1_pd(center.y);
+        const __m256d __cz = _mm256_set1_pd(center.z);
+
+        for (; i + 4 <= points.size(); i += 4)
+        {
+            const Vector3d* p = &points[i];
+            const __m256d __dx = _mm256_sub_pd(_mm256_set_pd(p[3].x, p[2].x, p[1].x, p[0].x), __cx);
+            const __m256d __dy = _mm256_sub_pd(_mm256_set_pd(p[3].y, p[2].y, p[1].y, p[0].y), __cy);
+            const __m256d __dz = _mm256_sub_pd(_mm256_set_pd(p[3].z, p[2].z, p[1].z, p[0].z), __cz);
+
+            __m256d __inside = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+            for (std::size_t k = 0; k < 3; k++)
+            {
+                __m256d __projection = _mm256_mul_pd(__dx, _mm256_set1_pd(axes[k].x));
+                __projection = _mm256_add_pd(__projection, _mm256_mul_pd(__dy, _mm256_set1_pd(axes[k].y)));
+                __projection = _mm256_add_pd(__projection, _mm256_mul_pd(__dz, _mm256_set1_pd(axes[k].z)));
+                __projection = _mm256_andnot_pd(__signBit, __projection);
+
+                __inside = _mm256_and_pd(__inside, _mm256_cmp_pd(__projection, _mm256_set1_pd(halfSize[k]), _CMP_LE_OQ));
+            }
+
+            const int mask = _mm256_movemask_pd(__inside);
+            for (std::size_t j = 0; j < 4; j++)
+                if (mask & (1 << j))
+                    out.push_back(i + j);
+        }
+#endif
+
+        for (; i < points.size(); i++)
+            if (Contains(points[i]))
+                out.push_back(i);
+
+        return;
+    }
+
+    Vector3d OBB::SupportPoint(const Vector3d& direction) const
+    {
+        Vector3d support = center;
+        for (std::size_t k = 0; k < 3; k++)
+            support += axes[k] * ((direction.DotProduct(axes[k]) >= 0) ? halfSize[k] : -halfSize[k]);
+
+        return support;
+    }
+
+    double OBB::SignedDistance(const Vector3d& point) const
+    {
+        const Vector3d d = point - center;
+
+        // Distances past each pair of faces
+        double outside = 0;
+        double inside = -std::numeric_limits<double>::infinity();
+        for (std::size_t k = 0; k < 3; k++)
+        {
+            const double q = std::abs(d.DotProduct(axes[k])) - halfSize[k];
+            outside += std::max(q, 0.0) * std::max(q, 0.0);
+            inside = std::max(inside, q);
+        }
+
+        return std::sqrt(outside) + std::min(inside, 0.0);
+    }
+
+    Vector3d OBB::ClosestPoint(const Vector3d& point) const
+    {
+        const Vector3d d = point - center;
+
+        Vector3d closest = center;
+        for (std::size_t k = 0; k < 3; k++)
+            closest += axes[k] * std::clamp(d.DotProduct(axes[k]), -halfSize[k], halfSize[k]);
+
+        return closest;
+    }
+
+    bool OBB::Intersects(const OBB& other) const
+    {
+        return !Separated(*this, other);
+    }
+
+    void OBB::Intersects(const std::vector<OBB>& others, std::vector<std::size_t>& out) const
+    {
+        std::size_t i = 0;
+
+#ifndef _EULE_NO_INTRINSICS_
+        const __m256d __signBit = _mm256_set1_pd(-0.0);
+        const __m256d __epsilon = _mm256_set1_pd(SAT_EPSILON);
+
+        const auto abs = [&](__m256d __v) {
+            return _mm256_andnot_pd(__signBit, __v);
+        };
+
+        for (; i + 4 <= others.size(); i += 4)
+        {
+            const OBB* o = &others[i];
+
+            // The other boxes' axes, and the distances between the centers, in this box's frame
+            __m256d __r[3][3];
+            __m256d __absR[3][3];
+            for (std::size_t j = 0; j < 3; j++)
+            {
+                const __m256d __bx = _mm256_set_pd(o[3].axes[j].x, o[2].axes[j].x, o[1].axes[j].x, o[0].axes[j].x);
+                const __m256d __by = _mm256_set_pd(o[3].axes[j].y, o[2].axes[j].y, o[1].axes[j].y, o[0].axes[j].y);
+                const __m256d __bz = _mm256_set_pd(o[3].axes[j].z, o[2].axes[j].z, o[1].axes[j].z, o[0].axes[j].z);
+
+                for (std::size_t k = 0; k < 3; k++)
+                {
+                    __r[k][j] = _mm256_mul_pd(__bx, _mm256_set1_pd(axes[k].x));
+                    __r[k][j] = _mm256_add_pd(__r[k][j], _mm256_mul_pd(__by, _mm256_set1_pd(axes[k].y)));
+                    __r[k][j] = _mm256_add_pd(__r[k][j], _mm256_mul_pd(__bz, _mm256_set1_pd(axes[k].z)));
+                    __absR[k][j] = _mm256_add_pd(abs(__r[k][j]), __epsilon);
+                }
+            }
+
+            const __m256d __dx = _mm256_sub_pd(_mm256_set_pd(o[3].center.x, o[2].center.x, o[1].center.x, o[0].center.x), _mm256_set1_pd(center.x));
+            const __m256d __dy = _mm256_sub_pd(_mm256_set_pd(o[3].center.y, o[2].center.y, o[1].center.y, o[0].center.y), _mm256_set1_pd(center.y));
+            const __m256d __dz = _mm256_sub_pd(_mm256_set_pd(o[3].center.z, o[2].center.z, o[1].center.z, o[0].center.z), _mm256_set1_pd(center.z));
+
+            __m256d __t[3];
+            __m256d __ha[3];
+            __m256d __hb[3];
+            for (std::size_t k = 0; k < 3; k++)
+            {
+                __t[k] = _mm256_mul_pd(__dx, _mm256_set1_pd(axes[k].x));
+                __t[k] = _mm256_add_pd(__t[k], _mm256_mul_pd(__dy, _mm256_set1_pd(axes[k].y)));
+                __t[k] = _mm256_add_pd(__t[k], _mm256_mul_pd(__dz, _mm256_set1_pd(axes[k].z)));
+
+                __ha[k] = _mm256_set1_pd(halfSize[k]);
+                __hb[k] = _mm256_set_pd(o[3].halfSize[k], o[2].halfSize[k], o[1].halfSize[k], o[0].halfSize[k]);
+            }
+
+            __m256d __separated = _mm256_setzero_pd();
+            const auto test = [&](__m256d __projection, __m256d __radius) {
+                __separated = _mm256_or_pd(__separated, _mm256_cmp_pd(abs(__projection), __radius, _CMP_GT_OQ));
+            };
+
+            // This box's axes
+            for (std::size_t k = 0; k < 3; k++)
+            {
+                __m256d __radius = _mm256_add_pd(__ha[k], _mm256_mul_pd(__hb[0], __absR[k][0]));
+                __radius = _mm256_add_pd(__radius, _mm256_mul_pd(__hb[1], __absR[k][1]));
+                __radius = _mm256_add_pd(__radius, _mm256_mul_pd(__hb[2], __absR[k][2]));
+                test(__t[k], __radius);
+            }
+
+            // The other boxes' axes
+            for (std::size_t j = 0; j < 3; j++)
+            {
+                __m256d __projection = _mm256_mul_pd(__t[0], __r[0][j]);
+                __projection = _mm256_add_pd(__projection, _mm256_mul_pd(__t[1], __r[1][j]));
+                __projection = _mm256_add_pd(__projection, _mm256_mul_pd(__t[2], __r[2][j]));
+
+                __m256d __radius = _mm256_add_pd(_mm256_mul_pd(__ha[0], __absR[0][j]), __hb[j]);
+                __radius = _mm256_add_pd(__radius, _mm256_mul_pd(__ha[1], __absR[1][j]));
+                __radius = _mm256_add_pd(__radius, _mm256_mul_pd(__ha[2], __absR[2][j]));
+                test(__projection, __radius);
+            }
+
+            // Cross products of both boxes' axes
+            for (std::size_t k = 0; k < 3; k++)
+                for (std::size_t j = 0; j < 3; j++)
+                {
+                    const std::size_t k1 = (k + 1) % 3, k2 = (k + 2) % 3;
+                    const std::size_t j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+
+                    const __m256d __projection = _mm256_sub_pd(_mm256_mul_pd(__t[k2], __r[k1][j]), _mm256_mul_pd(__t[k1], __r[k2][j]));
+                    const __m256d __ra = _mm256_add_pd(_mm256_mul_pd(__ha[k1], __absR[k2][j]), _mm256_mul_pd(__ha[k2], __absR[k1][j]));
+                    const __m256d __rb = _mm256_add_pd(_mm256_mul_pd(__hb[j1], __absR[k][j2]), _mm256_mul_pd(__hb[j2], __absR[k][j1]));
+                    test(__projection, _mm256_add_pd(__ra, __rb));
+                }
+
+            const int mask = _mm256_movemask_pd(__separated);
+            for (std::size_t j = 0; j < 4; j++)
+                if (!(mask & (1 << j)))
+                    out.push_back(i + j);
+        }
+#endif
+
+        for (; i < others.size(); i++)
+            if (!Separated(*this, others[i]))
+                out.push_back(i);
+
+        return;
+    }
+}
@@ -0,0 +1,250 @@
+#include "Eule/OccupancyGrid.h"
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cmath>
+#include <stdexcept>
+
+namespace Leonetienne::Eule {
+
+    namespace {
+        inline bool GetBit(const std::vector<std::uint64_t>& bits, std::size_t index)
+        {
+            return (bits[index >> 6] >> (index & 63)) & 1;
+        }
+
+        inline void SetBit(std::vector<std::uint64_t>& bits, std::size_t index)
+        {
+            bits[index >> 6] |= 1ull << (index & 63);
+            return;
+        }
+
+        inline void ClearBit(std::vector<std::uint64_t>& bits, std::size_t index)
+        {
+            bits[index >> 6] &= ~(1ull << (index & 63));
+            return;
+        }
+
+        inline bool BoxContainsPoint(const AABB& box, const Vector3d& point)
+        {
+            return
+                (box.min.x <= point.x) && (point.x <= box.max.x) &&
+                (box.min.y <= point.y) && (point.y <= box.max.y) &&
+                (box.min.z <= point.z) && (point.z <= box.max.z);
+        }
+
+        std::size_t CountBits(const std::vector<std::uint64_t>& bits)
+        {
+            std::size_t count = 0;
+            for (std::uint64_t word : bits)
+                count += std::bitset<64>(word).count();
+
+            return count;
+        }
+    }
+
+    OccupancyGrid::OccupancyGrid(const AABB& bounds, double voxelSize)
+        :
+        bounds { bounds },
+        voxelSize { voxelSize }
+    {
+        if (!(voxelSize > 0))
+            throw std::invalid_argument("The voxel size has to be positive!");
+
+        if ((bounds.max.x < bounds.min.x) || (bounds.max.y < bounds.min.y) || (bounds.max.z < bounds.min.z))
+            throw std::invalid_argument("The bounds are inverted!");
+
+        // Round the grid up to whole voxels
+        for (std::size_t i = 0; i < 3; i++)
+        {
+            dimensions[i] = std::max(1, (int)std::ceil((bounds.max[i] - bounds.min[i]) / voxelSize));
+            this->bounds.max[i] = bounds.min[i] + dimensions[i] * voxelSize;
+        }
+
+        const std::size_t voxels = (std::size_t)dimensions.x * dimensions.y * dimensions.z;
+        insideBits.resize((voxels + 63) / 64, 0);
+        boundaryBits.resize((voxels + 63) / 64, 0);
+
+        return;
+    }
+
+    void OccupancyGrid::Add(const TrapazoidalPrismCollider& prism)
+    {
+        prisms.push_back(prism);
+        prismBounds.push_back(prism.GetBounds());
+
+        const AABB& box = prismBounds.back();
+
+        // Prisms entirely outside the grid only take part in exact tests
+        if ((box.max.x < bounds.min.x) || (box.max.y < bounds.min.y) || (box.max.z < bounds.min.z) ||
+            (box.min.x > bounds.max.x) || (box.min.y > bounds.max.y) || (box.min.z > bounds.max.z))
+            return;
+
+        // The voxels overlapped by the prism's bounds, clamped onto the grid
+        Vector3i first = VoxelOf(box.min);
+        Vector3i last = VoxelOf(box.max);
+        for (std::size_t i = 0; i < 3; i++)
+        {
+            first[i] = std::max(first[i], 0);
+            last[i] = std::min(last[i], dimensions[i] - 1);
+        }
+
+        // Face planes, and how far a voxel's corners reach along each normal (its projected radius)
+        std::array<Vector3d, 6> normals;
+        std::array<double, 6> offsets;
+        std::array<double, 6> radii;
+        for (std::size_t f = 0; f < 6; f++)
+        {
+            const TrapazoidalPrismCollider::FACE_NORMALS face = (TrapazoidalPrismCollider::FACE_NORMALS)f;
+            normals[f] = prism.GetFaceNormal(face);
+            offsets[f] = prism.GetFaceOffset(face);
+            radii[f] = 0.5 * voxelSize * (std::abs(normals[f].x) + std::abs(normals[f].y) + std::abs(normals[f].z));
+        }
+
+        for (int z = first.z; z <= last.z; z++)
+            for (int y = first.y; y <= last.y; y++)
+                for (int x = first.x; x <= last.x; x++)
+                {
+                    const Vector3d center(
+                        bounds.min.x + (x + 0.5) * voxelSize,
+                        bounds.min.y + (y + 0.5) * voxelSize,
+                        bounds.min.z + (z + 0.5) * voxelSize
+                    );
+
+                    bool outside = false;
+                    bool partial = false;
+                    for (std::size_t f = 0; f < 6; f++)
+                    {
+                        const double distance = normals[f].x * center.x + normals[f].y * center.y + normals[f].z * center.z + offsets[f];
+
+                        if (distance < -radii[f])
+                        {
+                            outside = true;
+                            break;
+                        }
+
+                        if (distance <= radii[f])
+                            partial = true;
+                    }
+
+                    if (outside)
+                        continue;
+
+                    const std::size_t index = IndexOf(Vector3i(x, y, z));
+                    if (!partial)
+                    {
+                        SetBit(insideBits, index);
+                        ClearBit(boundaryBits, index);
+                    }
+                    else if (!GetBit(insideBits, index))
+                        SetBit(boundaryBits, index);
+                }
+
+        return;
+    }
+
+    void OccupancyGrid::Add(const std::vector<TrapazoidalPrismCollider>& prisms)
+    {
+        this->prisms.reserve(this->prisms.size() + prisms.size());
+        prismBounds.reserve(prismBounds.size() + prisms.size());
+
+        for (const TrapazoidalPrismCollider& prism : prisms)
+            Add(prism);
+
+        return;
+    }
+
+    OccupancyGrid::STATE OccupancyGrid::GetState(const Vector3i& voxel) const
+    {
+        if (!IsInGrid(voxel))
+            throw std::out_of_range("The voxel is not part of the grid!");
+
+        const std::size_t index = IndexOf(voxel);
+
+        if (GetBit(insideBits, index))
+            return STATE::INSIDE;
+
+        if (GetBit(boundaryBits, index))
+            return STATE::BOUNDARY;
+
+        return STATE::OUTSIDE;
+    }
+
+    Vector3i OccupancyGrid::VoxelOf(const Vector3d& point) const
+    {
+        return Vector3i(
+            (int)std::floor((point.x - bounds.min.x) / voxelSize),
+            (int)std::floor((point.y - bounds.min.y) / voxelSize),
+            (int)std::floor((point.z - bounds.min.z) / voxelSize)
+        );
+    }
+
+    bool OccupancyGrid::IsInGrid(const Vector3i& voxel) const
+    {
+        return
+            (voxel.x >= 0) && (voxel.x < dimensions.x) &&
+            (voxel.y >= 0) && (voxel.y < dimensions.y) &&
+            (voxel.z >= 0) && (voxel.z < dimensions.z);
+    }
+
+    bool OccupancyGrid::Contains(const Vector3d& point) const
+    {
+        const Vector3i voxel = VoxelOf(point);
+
+        if (!IsInGrid(voxel))
+            return ContainsExact(point);
+
+        const std::size_t index = IndexOf(voxel);
+
+        if (GetBit(insideBits, index))
+            return true;
+
+        if (!GetBit(boundaryBits, index))
+            return false;
+
+        return ContainsExact(point);
+    }
+
+    void OccupancyGrid::Contains(const std::vector<Vector3d>& points, std::vector<std::size_t>& out) const
+    {
+        for (std::size_t i = 0; i < points.size(); i++)
+            if (Contains(points[i]))
+                out.push_back(i);
+
+        return;
+    }
+
+    const Vector3i& OccupancyGrid::GetDimensions() const
+    {
+        return dimensions;
+    }
+
+    std::size_t OccupancyGrid::Count(STATE state) const
+    {
+        switch (state)
+        {
+        case STATE::INSIDE:
+            return CountBits(insideBits);
+
+        case STATE::BOUNDARY:
+            return CountBits(boundaryBits);
+
+        default:
+            return (std::size_t)dimensions.x * dimensions.y * dimensions.z - CountBits(insideBits) - CountBits(boundaryBits);
+        }
+    }
+
+    bool OccupancyGrid::ContainsExact(const Vector3d& point) const
+    {
+        for (std::size_t i = 0; i < prisms.size(); i++)
+            if (BoxContainsPoint(prismBounds[i], point) && prisms[i].Contains(point))
+                return true;
+
+        return false;
+    }
+
+    std::size_t OccupancyGrid::IndexOf(const Vector3i& voxel) const
+    {
+        return (std::size_t)voxel.x + (std::size_t)dimensions.x * ((std::size_t)voxel.y + (std::size_t)dimensions.y * (std::size_t)voxel.z);
+    }
+}
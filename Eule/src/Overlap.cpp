@@ -0,0 +1,692 @@
+#include "Eule/Overlap.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+
+//#define _EULE_NO_INTRINSICS_
+#ifndef _EULE_NO_INTRINSICS_
+#include <immintrin.h>
+#endif
+
+#include "ClosestOnTriangle.h"
+
+namespace Leonetienne::Eule {
+
+    namespace {
+        /* SAT */
+
+        //! Cross products of edges closer to parallel than this (squared sine) are not used as axes
+        constexpr double PARALLEL_EPSILON = 1e-12;
+
+        //! A prism, prepared for separating axis tests
+        struct SatPrism
+        {
+            // Vertices
+            std::array<double, 8> x;
+            std::array<double, 8> y;
+            std::array<double, 8> z;
+
+            // Edge directions, and their squared lengths
+            std::array<double, 12> ex;
+            std::array<double, 12> ey;
+            std::array<double, 12> ez;
+            std::array<double, 12> el;
+
+            // Face normals
+            std::array<double, 6> nx;
+            std::array<double, 6> ny;
+            std::array<double, 6> nz;
+
+            // Bounding box
+            Vector3d min;
+            Vector3d max;
+        };
+
+        SatPrism PrepareSat(const TrapazoidalPrismCollider& collider)
+        {
+            SatPrism p;
+
+            p.min = collider.GetVertex(0);
+            p.max = collider.GetVertex(0);
+            for (std::size_t i = 0; i < 8; i++)
+            {
+                const Vector3d& v = collider.GetVertex(i);
+                p.x[i] = v.x;
+                p.y[i] = v.y;
+                p.z[i] = v.z;
+
+                p.min = Vector3d(std::min(p.min.x, v.x), std::min(p.min.y, v.y), std::min(p.min.z, v.z));
+                p.max = Vector3d(std::max(p.max.x, v.x), std::max(p.max.y, v.y), std::max(p.max.z, v.z));
+            }
+
+            // Each edge connects two vertices whose identifiers differ in exactly one bit
+            std::size_t e = 0;
+            for (std::size_t i = 0; i < 8; i++)
+                for (std::size_t bit = 1; bit < 8; bit <<= 1)
+                    if (!(i & bit))
+                    {
+                        const Vector3d edge = collider.GetVertex(i | bit) - collider.GetVertex(i);
+                        p.ex[e] = edge.x;
+                        p.ey[e] = edge.y;
+                        p.ez[e] = edge.z;
+                        p.el[e] = edge.DotProduct(edge);
+                        e++;
+                    }
+
+            for (std::size_t i = 0; i < 6; i++)
+            {
+                const Vector3d& n = collider.GetFaceNormal((TrapazoidalPrismCollider::FACE_NORMALS)i);
+                p.nx[i] = n.x;
+                p.ny[i] = n.y;
+                p.nz[i] = n.z;
+            }
+
+            return p;
+        }
+
+        inline bool BoundsOverlap(const SatPrism& a, const SatPrism& b)
+        {
+            return
+                (a.min.x <= b.max.x) && (b.min.x <= a.max.x) &&
+                (a.min.y <= b.max.y) && (b.min.y <= a.max.y) &&
+                (a.min.z <= b.max.z) && (b.min.z <= a.max.z);
+        }
+
+#ifndef _EULE_NO_INTRINSICS_
+
+        //! Will project all vertices of a prism onto four axes at once
+        inline void Project(const SatPrism& p, __m256d __ax, __m256d __ay, __m256d __az, __m256d& __min, __m256d& __max)
+        {
+            __min = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+            __max = _mm256_set1_pd(-std::numeric_limits<double>::infinity());
+
+            for (std::size_t v = 0; v < 8; v++)
+            {
+                __m256d __dot = _mm256_mul_pd(_mm256_set1_pd(p.x[v]), __ax);
+                __dot = _mm256_fmadd_pd(_mm256_set1_pd(p.y[v]), __ay, __dot);
+                __dot = _mm256_fmadd_pd(_mm256_set1_pd(p.z[v]), __az, __dot);
+
+                __min = _mm256_min_pd(__min, __dot);
+                __max = _mm256_max_pd(__max, __dot);
+            }
+
+            return;
+        }
+
+        //! Tests, if any of four axes separates two prisms
+        inline bool Separated(const SatPrism& a, const SatPrism& b, __m256d __ax, __m256d __ay, __m256d __az)
+        {
+            __m256d __minA, __maxA, __minB, __maxB;
+            Project(a, __ax, __ay, __az, __minA, __maxA);
+            Project(b, __ax, __ay, __az, __minB, __maxB);
+
+            const __m256d __separated = _mm256_or_pd(
+                _mm256_cmp_pd(__maxA, __minB, _CMP_LT_OQ),
+                _mm256_cmp_pd(__maxB, __minA, _CMP_LT_OQ)
+            );
+
+            return _mm256_movemask_pd(__separated) != 0;
+        }
+
+        bool SatOverlap(const SatPrism& a, const SatPrism& b)
+        {
+            if (!BoundsOverlap(a, b))
+                return false;
+
+            // Face normals of both prisms, four at a time
+            std::array<double, 12> fx, fy, fz;
+            for (std::size_t i = 0; i < 6; i++)
+            {
+                fx[i] = a.nx[i]; fx[i + 6] = b.nx[i];
+                fy[i] = a.ny[i]; fy[i + 6] = b.ny[i];
+                fz[i] = a.nz[i]; fz[i + 6] = b.nz[i];
+            }
+
+            for (std::size_t i = 0; i < 12; i += 4)
+                if (Separated(a, b, _mm256_loadu_pd(&fx[i]), _mm256_loadu_pd(&fy[i]), _mm256_loadu_pd(&fz[i])))
+                    return false;
+
+            // Each edge of a, crossed with four edges of b at a time
+            const __m256d __epsilon = _mm256_set1_pd(PARALLEL_EPSILON);
+
+            for (std::size_t i = 0; i < 12; i++)
+            {
+                const __m256d __eax = _mm256_set1_pd(a.ex[i]);
+                const __m256d __eay = _mm256_set1_pd(a.ey[i]);
+                const __m256d __eaz = _mm256_set1_pd(a.ez[i]);
+                const __m256d __threshold = _mm256_mul_pd(__epsilon, _mm256_set1_pd(a.el[i]));
+
+                for (std::size_t j = 0; j < 12; j += 4)
+                {
+                    const __m256d __ebx = _mm256_loadu_pd(&b.ex[j]);
+                    const __m256d __eby = _mm256_loadu_pd(&b.ey[j]);
+                    const __m256d __ebz = _mm256_loadu_pd(&b.ez[j]);
+
+                    __m256d __ax = _mm256_fmsub_pd(__eay, __ebz, _mm256_mul_pd(__eaz, __eby));
+                    __m256d __ay = _mm256_fmsub_pd(__eaz, __ebx, _mm256_mul_pd(__eax, __ebz));
+                    __m256d __az = _mm256_fmsub_pd(__eax, __eby, _mm256_mul_pd(__eay, __ebx));
+
+                    // Zero out axes of (nearly) parallel edges. Projections onto them would only be rounding noise
+                    __m256d __length = _mm256_mul_pd(__ax, __ax);
+                    __length = _mm256_fmadd_pd(__ay, __ay, __length);
+                    __length = _mm256_fmadd_pd(__az, __az, __length);
+
+                    const __m256d __usable = _mm256_cmp_pd(
+                        __length,
+                        _mm256_mul_pd(__threshold, _mm256_loadu_pd(&b.el[j])),
+                        _CMP_GT_OQ
+                    );
+
+                    __ax = _mm256_and_pd(__ax, __usable);
+                    __ay = _mm256_and_pd(__ay, __usable);
+                    __az = _mm256_and_pd(__az, __usable);
+
+                    if (Separated(a, b, __ax, __ay, __az))
+                        return false;
+                }
+            }
+
+            return true;
+        }
+
+#else
+
+        //! Tests, if an axis separates two prisms
+        inline bool Separated(const SatPrism& a, const SatPrism& b, double ax, double ay, double az)
+        {
+            double minA = std::numeric_limits<double>::infinity();
+            double maxA = -std::numeric_limits<double>::infinity();
+            double minB = minA;
+            double maxB = maxA;
+
+            for (std::size_t v = 0; v < 8; v++)
+            {
+                const double dotA = a.x[v] * ax + a.y[v] * ay + a.z[v] * az;
+                const double dotB = b.x[v] * ax + b.y[v] * ay + b.z[v] * az;
+
+                minA = std::min(minA, dotA);
+                maxA = std::max(maxA, dotA);
+                minB = std::min(minB, dotB);
+                maxB = std::max(maxB, dotB);
+            }
+
+            return (maxA < minB) || (maxB < minA);
+        }
+
+        bool SatOverlap(const SatPrism& a, const SatPrism& b)
+        {
+            if (!BoundsOverlap(a, b))
+                return false;
+
+            // Face normals of both prisms
+            for (std::size_t i = 0; i < 6; i++)
+                if ((Separated(a, b, a.nx[i], a.ny[i], a.nz[i])) ||
+                    (Separated(a, b, b.nx[i], b.ny[i], b.nz[i])))
+                    return false;
+
+            // Cross products of all edge pairs
+            for (std::size_t i = 0; i < 12; i++)
+                for (std::size_t j = 0; j < 12; j++)
+                {
+                    const double ax = a.ey[i] * b.ez[j] - a.ez[i] * b.ey[j];
+                    const double ay = a.ez[i] * b.ex[j] - a.ex[i] * b.ez[j];
+                    const double az = a.ex[i] * b.ey[j] - a.ey[i] * b.ex[j];
+
+                    // Skip (nearly) parallel edges. Projections onto their cross product would only be rounding noise
+                    if (ax * ax + ay * ay + az * az <= PARALLEL_EPSILON * a.el[i] * b.el[j])
+                        continue;
+
+                    if (Separated(a, b, ax, ay, az))
+                        return false;
+                }
+
+            return true;
+        }
+
+#endif
+
+        /* GJK */
+
+        //! Support point of the minkowski difference a - b
+        inline Vector3d MinkowskiSupport(const Collider& a, const Collider& b, const Vector3d& direction)
+        {
+            return a.SupportPoint(direction) - b.SupportPoint(-direction);
+        }
+
+        //! The simplex of GJK. The most recently added point is at index 0
+        struct Simplex
+        {
+            std::array<Vector3d, 4> points;
+            std::size_t size = 0;
+
+            void PushFront(const Vector3d& point)
+            {
+                points = { point, points[0], points[1], points[2] };
+                size = std::min<std::size_t>(size + 1, 4);
+                return;
+            }
+
+            void Set(std::initializer_list<Vector3d> list)
+            {
+                size = 0;
+                for (const Vector3d& p : list)
+                    points[size++] = p;
+                return;
+            }
+
+            const Vector3d& operator[](std::size_t i) const
+            {
+                return points[i];
+            }
+        };
+
+        /*
+        * BEGIN_REF
+        * Ericson: Real-Time Collision Detection, 5.1.5 and 5.1.6 (closest point on triangle and tetrahedron)
+        * Each of these finds the point of the simplex closest to the origin,
+        * and reduces the simplex to the smallest feature containing that point.
+        */
+
+        Vector3d ClosestOnLine(Simplex& simplex)
+        {
+            const Vector3d a = simplex[0];
+            const Vector3d b = simplex[1];
+            const Vector3d ab = b - a;
+
+            const double t = -a.DotProduct(ab);
+            if (t <= 0)
+            {
+                simplex.Set({ a });
+                return a;
+            }
+
+            const double length = ab.DotProduct(ab);
+            if (t >= length)
+            {
+                simplex.Set({ b });
+                return b;
+            }
+
+            return a + ab * (t / length);
+        }
+
+        Vector3d ClosestOnTriangle(Simplex& simplex)
+        {
+            const Vector3d a = simplex[0];
+            const Vector3d b = simplex[1];
+            const Vector3d c = simplex[2];
+
+            Internal::TRIANGLE_FEATURE feature;
+            const Vector3d closest = Internal::ClosestOnTriangle(Vector3d(0, 0, 0), a, b, c, feature);
+
+            switch (feature)
+            {
+            case Internal::TRIANGLE_FEATURE::A: simplex.Set({ a }); break;
+            case Internal::TRIANGLE_FEATURE::B: simplex.Set({ b }); break;
+            case Internal::TRIANGLE_FEATURE::C: simplex.Set({ c }); break;
+            case Internal::TRIANGLE_FEATURE::AB: simplex.Set({ a, b }); break;
+            case Internal::TRIANGLE_FEATURE::AC: simplex.Set({ a, c }); break;
+            case Internal::TRIANGLE_FEATURE::BC: simplex.Set({ b, c }); break;
+            case Internal::TRIANGLE_FEATURE::FACE: break;
+            }
+
+            return closest;
+        }
+
+        //! Tests, if the origin and d lie on different sides of the plane through a, b and c.
+        //! For a flat tetrahedron, this is true for any face.
+        inline bool OriginOutsideOfPlane(const Vector3d& a, const Vector3d& b, const Vector3d& c, const Vector3d& d)
+        {
+            const Vector3d normal = (b - a).CrossProduct(c - a);
+            return -a.DotProduct(normal) * (d - a).DotProduct(normal) <= 0;
+        }
+
+        Vector3d ClosestOnTetrahedron(Simplex& simplex)
+        {
+            const Vector3d a = simplex[0];
+            const Vector3d b = simplex[1];
+            const Vector3d c = simplex[2];
+            const Vector3d d = simplex[3];
+
+            // Each face, and the vertex opposite of it
+            const std::array<std::array<Vector3d, 4>, 4> faces = {{
+                { a, b, c, d },
+                { a, c, d, b },
+                { a, d, b, c },
+                { b, d, c, a }
+            }};
+
+            Vector3d closest = Vector3d::zero;
+            double closestDistance = std::numeric_limits<double>::infinity();
+            Simplex closestFeature = simplex;
+
+            for (const std::array<Vector3d, 4>& face : faces)
+                if (OriginOutsideOfPlane(face[0], face[1], face[2], face[3]))
+                {
+                    Simplex feature;
+                    feature.Set({ face[0], face[1], face[2] });
+
+                    const Vector3d point = ClosestOnTriangle(feature);
+                    const double distance = point.DotProduct(point);
+                    if (distance < closestDistance)
+                    {
+                        closest = point;
+                        closestDistance = distance;
+                        closestFeature = feature;
+                    }
+                }
+
+            // The origin is inside of all faces. The simplex stays a tetrahedron
+            simplex = closestFeature;
+            return closest;
+        }
+
+        /*
+        * END REF
+        */
+
+        Vector3d ClosestOnSimplex(Simplex& simplex)
+        {
+            switch (simplex.size)
+            {
+            case 2: return ClosestOnLine(simplex);
+            case 3: return ClosestOnTriangle(simplex);
+            case 4: return ClosestOnTetrahedron(simplex);
+            }
+
+            return simplex[0];
+        }
+
+        //! Will run GJK. If a and b overlap, `simplex` will contain the origin (possibly on its boundary)
+        bool RunGjk(const Collider& a, const Collider& b, Simplex& simplex)
+        {
+            // The point of the simplex closest to the origin
+            Vector3d closest = MinkowskiSupport(a, b, Vector3d(1, 0, 0));
+            simplex.Set({ closest });
+
+            for (std::size_t i = 0; i < Overlap::MAX_ITERATIONS; i++)
+            {
+                const double distance = closest.DotProduct(closest);
+
+                // The origin lies on the simplex
+                if (distance == 0)
+                    return true;
+
+                const Vector3d support = MinkowskiSupport(a, b, -closest);
+
+                // Could not get past the origin. This direction separates both shapes
+                if (support.DotProduct(closest) > 0)
+                    return false;
+
+                // Could not get any closer to the origin. It is outside, (barely) out of reach
+                if (distance - support.DotProduct(closest) <= 1e-12 * distance)
+                    return false;
+
+                simplex.PushFront(support);
+                closest = ClosestOnSimplex(simplex);
+
+                if (simplex.size == 4)
+                    return true;
+            }
+
+            // No conclusion. This only happens for (nearly) touching shapes
+            return true;
+        }
+
+        /* EPA */
+
+        //! Tests, if a point is further from the origin than a scale-relative epsilon
+        inline bool IsDistinct(const Vector3d& offset, double scale)
+        {
+            return offset.DotProduct(offset) > 1e-20 * (1 + scale);
+        }
+
+        //! Will grow a GJK simplex that ended early (because the origin lies on it) to a tetrahedron
+        bool CompleteTetrahedron(const Collider& a, const Collider& b, Simplex& simplex)
+        {
+            static const std::array<Vector3d, 6> axes = {
+                Vector3d(1, 0, 0), Vector3d(-1, 0, 0),
+                Vector3d(0, 1, 0), Vector3d(0, -1, 0),
+                Vector3d(0, 0, 1), Vector3d(0, 0, -1)
+            };
+
+            const double scale = simplex[0].DotProduct(simplex[0]);
+
+            if (simplex.size == 1)
+                for (const Vector3d& axis : axes)
+                {
+                    const Vector3d p = MinkowskiSupport(a, b, axis);
+                    if (IsDistinct(p - simplex[0], scale))
+                    {
+                        simplex.Set({ simplex[0], p });
+                        break;
+                    }
+                }
+
+            if (simplex.size == 2)
+            {
+                const Vector3d line = simplex[1] - simplex[0];
+
+                // Search perpendicular to the line, starting off the axis it is least aligned with
+                std::size_t least = 0;
+                if (std::abs(line.y) < std::abs(line[least])) least = 1;
+                if (std::abs(line.z) < std::abs(line[least])) least = 2;
+
+                const Vector3d perpendicularA = line.CrossProduct(axes[least * 2]);
+                const Vector3d perpendicularB = line.CrossProduct(perpendicularA);
+
+                for (const Vector3d& direction : { perpendicularA, -perpendicularA, perpendicularB, -perpendicularB })
+                {
+                    const Vector3d p = MinkowskiSupport(a, b, direction);
+                    if (IsDistinct((p - simplex[0]).CrossProduct(line), scale * line.DotProduct(line)))
+                    {
+                        simplex.Set({ simplex[0], simplex[1], p });
+                        break;
+                    }
+                }
+            }
+
+            if (simplex.size == 3)
+            {
+                const Vector3d normal = (simplex[1] - simplex[0]).CrossProduct(simplex[2] - simplex[0]);
+
+                for (const Vector3d& direction : { normal, -normal })
+                {
+                    const Vector3d p = MinkowskiSupport(a, b, direction);
+                    const double height = (p - simplex[0]).DotProduct(normal);
+                    if (height * height > 1e-20 * (1 + scale) * normal.DotProduct(normal))
+                    {
+                        simplex.Set({ simplex[0], simplex[1], simplex[2], p });
+                        break;
+                    }
+                }
+            }
+
+            return simplex.size == 4;
+        }
+
+        //! A triangle of the EPA polytope
+        struct Face
+        {
+            std::array<std::size_t, 3> indices;
+            Vector3d normal;
+            double distance;
+        };
+
+        //! Will create a face whose normal points away from `inside`
+        Face MakeFace(const std::vector<Vector3d>& polytope, std::size_t i0, std::size_t i1, std::size_t i2, const Vector3d& inside)
+        {
+            Face face;
+            face.indices = { i0, i1, i2 };
+
+            Vector3d normal = (polytope[i1] - polytope[i0]).CrossProduct(polytope[i2] - polytope[i0]);
+            const double length = std::sqrt(normal.DotProduct(normal));
+
+            // Degenerate faces should never be picked as closest
+            if (length == 0)
+            {
+                face.normal = Vector3d::zero;
+                face.distance = std::numeric_limits<double>::infinity();
+                return face;
+            }
+
+            normal *= 1.0 / length;
+            if (normal.DotProduct(polytope[i0] - inside) < 0)
+            {
+                normal = -normal;
+                std::swap(face.indices[1], face.indices[2]);
+            }
+
+            face.normal = normal;
+            face.distance = normal.DotProduct(polytope[i0]);
+
+            return face;
+        }
+    }
+
+    bool Overlap::SAT(const TrapazoidalPrismCollider& a, const TrapazoidalPrismCollider& b)
+    {
+        return SatOverlap(PrepareSat(a), PrepareSat(b));
+    }
+
+    void Overlap::SAT(
+        const std::vector<TrapazoidalPrismCollider>& colliders,
+        const std::vector<std::pair<std::size_t, std::size_t>>& pairs,
+        std::vector<std::size_t>& out)
+    {
+        std::vector<SatPrism> prepared;
+        prepared.reserve(colliders.size());
+        for (const TrapazoidalPrismCollider& collider : colliders)
+            prepared.push_back(PrepareSat(collider));
+
+        for (std::size_t i = 0; i < pairs.size(); i++)
+        {
+            if ((pairs[i].first >= prepared.size()) || (pairs[i].second >= prepared.size()))
+                throw std::out_of_range("Pair references a collider that does not exist!");
+
+            if (SatOverlap(prepared[pairs[i].first], prepared[pairs[i].second]))
+                out.push_back(i);
+        }
+
+        return;
+    }
+
+    bool Overlap::GJK(const Collider& a, const Collider& b)
+    {
+        Simplex simplex;
+        return RunGjk(a, b, simplex);
+    }
+
+    void Overlap::GJK(
+        const std::vector<const Collider*>& colliders,
+        const std::vector<std::pair<std::size_t, std::size_t>>& pairs,
+        std::vector<std::size_t>& out)
+    {
+        for (std::size_t i = 0; i < pairs.size(); i++)
+        {
+            if ((pairs[i].first >= colliders.size()) || (pairs[i].second >= colliders.size()))
+                throw std::out_of_range("Pair references a collider that does not exist!");
+
+            if (GJK(*colliders[pairs[i].first], *colliders[pairs[i].second]))
+                out.push_back(i);
+        }
+
+        return;
+    }
+
+    bool Overlap::EPA(const Collider& a, const Collider& b, Vector3d& normal, double& depth)
+    {
+        Simplex simplex;
+        if (!RunGjk(a, b, simplex))
+            return false;
+
+        // The minkowski difference is flat. The shapes can only touch
+        if (!CompleteTetrahedron(a, b, simplex))
+        {
+            normal = Vector3d(1, 0, 0);
+            depth = 0;
+            return true;
+        }
+
+        std::vector<Vector3d> polytope(simplex.points.begin(), simplex.points.end());
+
+        // Lies within the polytope for as long as it grows, since it is convex
+        const Vector3d inside = (polytope[0] + polytope[1] + polytope[2] + polytope[3]) * 0.25;
+
+        std::vector<Face> faces = {
+            MakeFace(polytope, 0, 1, 2, inside),
+            MakeFace(polytope, 0, 3, 1, inside),
+            MakeFace(polytope, 0, 2, 3, inside),
+            MakeFace(polytope, 1, 3, 2, inside)
+        };
+
+        std::vector<std::pair<std::size_t, std::size_t>> looseEdges;
+
+        std::size_t closest = 0;
+        for (std::size_t i = 1; i < faces.size(); i++)
+            if (faces[i].distance < faces[closest].distance)
+                closest = i;
+
+        for (std::size_t iteration = 0; iteration < MAX_ITERATIONS; iteration++)
+        {
+            const Face face = faces[closest];
+            const Vector3d support = MinkowskiSupport(a, b, face.normal);
+
+            // The closest face is part of the minkowski difference's hull. Done
+            if (face.normal.DotProduct(support) - face.distance <= 1e-10 * (1 + std::abs(face.distance)))
+                break;
+
+            // Remove all faces that can see the new point, keeping track of the hole's rim
+            looseEdges.clear();
+            for (std::size_t i = 0; i < faces.size();)
+            {
+                if (faces[i].normal.DotProduct(support - polytope[faces[i].indices[0]]) > 0)
+                {
+                    for (std::size_t e = 0; e < 3; e++)
+                    {
+                        const std::pair<std::size_t, std::size_t> edge(faces[i].indices[e], faces[i].indices[(e + 1) % 3]);
+
+                        // An edge shared by two removed faces is not part of the rim
+                        bool shared = false;
+                        for (std::size_t l = 0; l < looseEdges.size(); l++)
+                            if ((looseEdges[l].first == edge.second) && (looseEdges[l].second == edge.first))
+                            {
+                                looseEdges.erase(looseEdges.begin() + l);
+                                shared = true;
+                                break;
+                            }
+
+                        if (!shared)
+                            looseEdges.push_back(edge);
+                    }
+
+                    faces.erase(faces.begin() + i);
+                }
+                else
+                    i++;
+            }
+
+            // Numerically stuck. Nothing got removed, so accept the current face
+            if (looseEdges.empty())
+                break;
+
+            // Close the hole with the new point
+            polytope.push_back(support);
+            for (const std::pair<std::size_t, std::size_t>& edge : looseEdges)
+                faces.push_back(MakeFace(polytope, edge.first, edge.second, polytope.size() - 1, inside));
+
+            closest = 0;
+            for (std::size_t i = 1; i < faces.size(); i++)
+                if (faces[i].distance < faces[closest].distance)
+                    closest = i;
+        }
+
+        normal = faces[closest].normal;
+        depth = std::max(0.0, faces[closest].distance);
+
+        return true;
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <cmath>
+
+#ifndef _EULE_NO_INTRINSICS_
+#include <immintrin.h>
+#endif
+
+/* Private to the library sources. Include it after the _EULE_NO_INTRINSICS_ block of a source file.
+*
+* Kernels using these get written once, for any type behaving like a double.
+* With doubles, they process one element. With packs of four doubles, they process four at once. */
+
+namespace Leonetienne::Eule::Internal {
+
+    inline double Sqrt(double x) { return std::sqrt(x); }
+    inline double Abs(double x) { return std::abs(x); }
+    inline double CopySign(double magnitude, double sign) { return std::copysign(magnitude, sign); }
+    inline bool Greater(double a, double b) { return a > b; }
+    inline double Select(bool condition, double a, double b) { return condition ? a : b; }
+
+#ifndef _EULE_NO_INTRINSICS_
+    //! Four doubles, one per element. Comparisons yield packs of all-ones or all-zero lanes
+    struct Pack
+    {
+        Pack() = default;
+        Pack(__m256d v) : v { v } {}
+        Pack(double x) : v { _mm256_set1_pd(x) } {}
+
+        __m256d v;
+    };
+
+    inline Pack operator+(Pack a, Pack b) { return _mm256_add_pd(a.v, b.v); }
+    inline Pack operator-(Pack a, Pack b) { return _mm256_sub_pd(a.v, b.v); }
+    inline Pack operator*(Pack a, Pack b) { return _mm256_mul_pd(a.v, b.v); }
+    inline Pack operator/(Pack a, Pack b) { return _mm256_div_pd(a.v, b.v); }
+    inline Pack operator-(Pack a) { return _mm256_xor_pd(a.v, _mm256_set1_pd(-0.0)); }
+
+    inline Pack Sqrt(Pack x) { return _mm256_sqrt_pd(x.v); }
+    inline Pack Abs(Pack x) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x.v); }
+    inline Pack CopySign(Pack magnitude, Pack sign)
+    {
+        const __m256d __signBit = _mm256_set1_pd(-0.0);
+        return _mm256_or_pd(_mm256_andnot_pd(__signBit, magnitude.v), _mm256_and_pd(__signBit, sign.v));
+    }
+    inline Pack Greater(Pack a, Pack b) { return _mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ); }
+    inline Pack Select(Pack condition, Pack a, Pack b) { return _mm256_blendv_pd(b.v, a.v, condition.v); }
+#endif
+}
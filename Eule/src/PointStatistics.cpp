@@ -0,0 +1,295 @@
+#include "Eule/PointStatistics.h"
+#include "Eule/Parallel.h"
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+//#define _EULE_NO_INTRINSICS_
+#ifndef _EULE_NO_INTRINSICS_
+#include <immintrin.h>
+#endif
+
+namespace Leonetienne::Eule {
+
+    namespace {
+        // Batches read points as a flat array of doubles
+        static_assert(sizeof(Vector3d) == 3 * sizeof(double), "Vector3d has to be tightly packed");
+
+        //! Count, mean and sum of squared deviations from the mean of a set of points
+        struct Moments
+        {
+            double count = 0;
+            Vector3d mean;
+            // xx, xy, xz, yy, yz, zz
+            std::array<double, 6> m2 {};
+        };
+
+#ifndef _EULE_NO_INTRINSICS_
+        //! Will load four points, and transpose them into one register per component
+        inline void Load4(const Vector3d* p, __m256d& __x, __m256d& __y, __m256d& __z)
+        {
+            const double* d = &p->x;
+
+            // x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+            const __m256d __a = _mm256_loadu_pd(d);
+            const __m256d __b = _mm256_loadu_pd(d + 4);
+            const __m256d __c = _mm256_loadu_pd(d + 8);
+
+            // x0 x3 x2 x1
+            __x = _mm256_blend_pd(_mm256_blend_pd(__a, __b, 0b0100), __c, 0b0010);
+            __x = _mm256_permute4x64_pd(__x, 0b01101100);
+
+            // y1 y0 y3 y2
+            __y = _mm256_blend_pd(_mm256_blend_pd(__a, __b, 0b1001), __c, 0b0100);
+            __y = _mm256_permute_pd(__y, 0b0101);
+
+            // z2 z1 z0 z3
+            __z = _mm256_blend_pd(_mm256_blend_pd(__a, __b, 0b0010), __c, 0b1001);
+            __z = _mm256_permute4x64_pd(__z, 0b11000110);
+
+            return;
+        }
+
+        //! Will sum up the lanes of a register, in a fixed order
+        inline double SumLanes(__m256d __v)
+        {
+            alignas(32) double lanes[4];
+            _mm256_store_pd(lanes, __v);
+            return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+        }
+
+        inline double MinLanes(__m256d __v)
+        {
+            alignas(32) double lanes[4];
+            _mm256_store_pd(lanes, __v);
+            return std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+        }
+
+        inline double MaxLanes(__m256d __v)
+        {
+            alignas(32) double lanes[4];
+            _mm256_store_pd(lanes, __v);
+            return std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+        }
+#endif
+
+        AABB BlockBounds(const Vector3d* p, std::size_t count)
+        {
+            AABB box { p[0], p[0] };
+            std::size_t i = 0;
+
+#ifndef _EULE_NO_INTRINSICS_
+            if (count >= 4)
+            {
+                __m256d __minx, __miny, __minz;
+                Load4(p, __minx, __miny, __minz);
+                __m256d __maxx = __minx, __maxy = __miny, __maxz = __minz;
+
+                for (i = 4; i + 4 <= count; i += 4)
+                {
+                    __m256d __x, __y, __z;
+                    Load4(p + i, __x, __y, __z);
+                    __minx = _mm256_min_pd(__minx, __x);
+                    __miny = _mm256_min_pd(__miny, __y);
+                    __minz = _mm256_min_pd(__minz, __z);
+                    __maxx = _mm256_max_pd(__maxx, __x);
+                    __maxy = _mm256_max_pd(__maxy, __y);
+                    __maxz = _mm256_max_pd(__maxz, __z);
+                }
+
+                box.min = Vector3d(MinLanes(__minx), MinLanes(__miny), MinLanes(__minz));
+                box.max = Vector3d(MaxLanes(__maxx), MaxLanes(__maxy), MaxLanes(__maxz));
+            }
+#endif
+
+            for (; i < count; i++)
+                for (std::size_t j = 0; j < 3; j++)
+                {
+                    box.min[j] = std::min(box.min[j], p[i][j]);
+                    box.max[j] = std::max(box.max[j], p[i][j]);
+                }
+
+            return box;
+        }
+
+        Vector3d BlockSum(const Vector3d* p, std::size_t count)
+        {
+            Vector3d sum;
+            std::size_t i = 0;
+
+#ifndef _EULE_NO_INTRINSICS_
+            __m256d __sumx = _mm256_setzero_pd();
+            __m256d __sumy = _mm256_setzero_pd();
+            __m256d __sumz = _mm256_setzero_pd();
+
+            for (; i + 4 <= count; i += 4)
+            {
+                __m256d __x, __y, __z;
+                Load4(p + i, __x, __y, __z);
+                __sumx = _mm256_add_pd(__sumx, __x);
+                __sumy = _mm256_add_pd(__sumy, __y);
+                __sumz = _mm256_add_pd(__sumz, __z);
+            }
+
+            sum = Vector3d(SumLanes(__sumx), SumLanes(__sumy), SumLanes(__sumz));
+#endif
+
+            for (; i < count; i++)
+                sum += p[i];
+
+            return sum;
+        }
+
+        //! Two passes over a block: its mean first, then the deviations from it
+        Moments BlockMoments(const Vector3d* p, std::size_t count)
+        {
+            Moments moments;
+            moments.count = (double)count;
+            moments.mean = BlockSum(p, count) / (double)count;
+
+            const Vector3d& mean = moments.mean;
+            std::array<double, 6>& m2 = moments.m2;
+            std::size_t i = 0;
+
+#ifndef _EULE_NO_INTRINSICS_
+            const __m256d __meanx = _mm256_set1_pd(mean.x);
+            const __m256d __meany = _mm256_set1_pd(mean.y);
+            const __m256d __meanz = _mm256_set1_pd(mean.z);
+
+            __m256d __xx = _mm256_setzero_pd();
+            __m256d __xy = _mm256_setzero_pd();
+            __m256d __xz = _mm256_setzero_pd();
+            __m256d __yy = _mm256_setzero_pd();
+            __m256d __yz = _mm256_setzero_pd();
+            __m256d __zz = _mm256_setzero_pd();
+
+            for (; i + 4 <= count; i += 4)
+            {
+                __m256d __x, __y, __z;
+                Load4(p + i, __x, __y, __z);
+                __x = _mm256_sub_pd(__x, __meanx);
+                __y = _mm256_sub_pd(__y, __meany);
+                __z = _mm256_sub_pd(__z, __meanz);
+
+                __xx = _mm256_add_pd(__xx, _mm256_mul_pd(__x, __x));
+                __xy = _mm256_add_pd(__xy, _mm256_mul_pd(__x, __y));
+                __xz = _mm256_add_pd(__xz, _mm256_mul_pd(__x, __z));
+                __yy = _mm256_add_pd(__yy, _mm256_mul_pd(__y, __y));
+                __yz = _mm256_add_pd(__yz, _mm256_mul_pd(__y, __z));
+                __zz = _mm256_add_pd(__zz, _mm256_mul_pd(__z, __z));
+            }
+
+            m2 = { SumLanes(__xx), SumLanes(__xy), SumLanes(__xz), SumLanes(__yy), SumLanes(__yz), SumLanes(__zz) };
+#endif
+
+            for (; i < count; i++)
+            {
+                const Vector3d d = p[i] - mean;
+                m2[0] += d.x * d.x;
+                m2[1] += d.x * d.y;
+                m2[2] += d.x * d.z;
+                m2[3] += d.y * d.y;
+                m2[4] += d.y * d.z;
+                m2[5] += d.z * d.z;
+            }
+
+            return moments;
+        }
+
+        //! Will merge the moments of two disjoint sets of points
+        Moments Merge(const Moments& a, const Moments& b)
+        {
+            Moments merged;
+            merged.count = a.count + b.count;
+
+            const Vector3d d = b.mean - a.mean;
+            merged.mean = a.mean + d * (b.count / merged.count);
+
+            const double weight = a.count * b.count / merged.count;
+            const std::array<double, 6> products = { d.x * d.x, d.x * d.y, d.x * d.z, d.y * d.y, d.y * d.z, d.z * d.z };
+            for (std::size_t i = 0; i < 6; i++)
+                merged.m2[i] = a.m2[i] + b.m2[i] + products[i] * weight;
+
+            return merged;
+        }
+
+        //! Will combine the results of [begin, end) by halving the range recursively, so the order only depends on the amount of blocks
+        template <typename T, typename Combine>
+        T CombinePairwise(const std::vector<T>& results, std::size_t begin, std::size_t end, Combine combine)
+        {
+            if (end - begin == 1)
+                return results[begin];
+
+            const std::size_t middle = begin + (end - begin) / 2;
+            return combine(CombinePairwise(results, begin, middle, combine), CombinePairwise(results, middle, end, combine));
+        }
+
+        //! Will reduce each block of points with `reduce(first, count)`, and combine the blocks' results
+        template <typename T, typename Reduce, typename Combine>
+        T ReduceBlocks(const std::vector<Vector3d>& points, std::size_t threadCount, Reduce reduce, Combine combine)
+        {
+            if (points.empty())
+                throw std::invalid_argument("There are no points!");
+
+            const std::size_t blocks = (points.size() + PointStatistics::BLOCK_SIZE - 1) / PointStatistics::BLOCK_SIZE;
+            std::vector<T> results(blocks);
+
+            Parallel::For(blocks, threadCount, PointStatistics::MIN_BLOCKS_PER_THREAD, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t b = begin; b < end; b++)
+                {
+                    const std::size_t first = b * PointStatistics::BLOCK_SIZE;
+                    results[b] = reduce(points.data() + first, std::min(PointStatistics::BLOCK_SIZE, points.size() - first));
+                }
+            });
+
+            return CombinePairwise(results, 0, blocks, combine);
+        }
+    }
+
+    AABB PointStatistics::Bounds(const std::vector<Vector3d>& points, std::size_t threadCount)
+    {
+        return ReduceBlocks<AABB>(points, threadCount, BlockBounds, [](const AABB& a, const AABB& b) {
+            return AABB {
+                Vector3d(std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z)),
+                Vector3d(std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z))
+            };
+        });
+    }
+
+    Vector3d PointStatistics::Centroid(const std::vector<Vector3d>& points, std::size_t threadCount)
+    {
+        const Vector3d sum = ReduceBlocks<Vector3d>(points, threadCount, BlockSum, [](const Vector3d& a, const Vector3d& b) {
+            return a + b;
+        });
+
+        return sum / (double)points.size();
+    }
+
+    Matrix4x4 PointStatistics::Covariance(const std::vector<Vector3d>& points, std::size_t threadCount)
+    {
+        Vector3d centroid;
+        return Covariance(points, centroid, threadCount);
+    }
+
+    Matrix4x4 PointStatistics::Covariance(const std::vector<Vector3d>& points, Vector3d& centroid, std::size_t threadCount)
+    {
+        const Moments moments = ReduceBlocks<Moments>(points, threadCount, BlockMoments, Merge);
+        centroid = moments.mean;
+
+        const std::array<double, 6>& m2 = moments.m2;
+
+        Matrix4x4 covariance;
+        covariance[0][0] = m2[0];
+        covariance[0][1] = covariance[1][0] = m2[1];
+        covariance[0][2] = covariance[2][0] = m2[2];
+        covariance[1][1] = m2[3];
+        covariance[1][2] = covariance[2][1] = m2[4];
+        covariance[2][2] = m2[5];
+
+        for (std::size_t y = 0; y < 3; y++)
+            for (std::size_t x = 0; x < 3; x++)
+                covariance[y][x] /= moments.count;
+
+        return covariance;
+    }
+}
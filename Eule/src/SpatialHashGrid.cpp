@@ -0,0 +1,276 @@
+#include "Eule/SpatialHashGrid.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+
+namespace Leonetienne::Eule {
+
+    namespace {
+        inline double SqrDistanceToBox(const Vector3d& point, const AABB& box)
+        {
+            double sqrDistance = 0;
+            for (std::size_t i = 0; i < 3; i++)
+            {
+                const double d = std::max(std::max(box.min[i] - point[i], point[i] - box.max[i]), 0.0);
+                sqrDistance += d * d;
+            }
+
+            return sqrDistance;
+        }
+
+        //! Will return the cell coordinate of `x`, clamped into the grid's range
+        inline double ClampedCellCoordinate(double x, double cellSize)
+        {
+            constexpr double limit = SpatialHashGrid::MAX_CELL_COORDINATE;
+            return std::min(std::max(std::floor(x / cellSize), -limit), limit);
+        }
+
+        inline bool InRange(const Vector3i& cell, const Vector3i& min, const Vector3i& max)
+        {
+            return
+                (min.x <= cell.x) && (cell.x <= max.x) &&
+                (min.y <= cell.y) && (cell.y <= max.y) &&
+                (min.z <= cell.z) && (cell.z <= max.z);
+        }
+    }
+
+    SpatialHashGrid::SpatialHashGrid(double cellSize)
+        :
+        cellSize { cellSize }
+    {
+        if (!(cellSize > 0))
+            throw std::invalid_argument("The cell size has to be positive!");
+
+        return;
+    }
+
+    void SpatialHashGrid::Insert(const Vector3d& point, std::size_t id)
+    {
+        const Vector3i cell = CellOf(point);
+        InsertItem(Item { AABB { point, point }, cell, cell, id });
+
+        return;
+    }
+
+    void SpatialHashGrid::Insert(const AABB& bounds, std::size_t id)
+    {
+        const Vector3i minCell = CellOf(bounds.min);
+        const Vector3i maxCell = CellOf(bounds.max);
+
+        const double cells =
+            std::max((double)maxCell.x - minCell.x + 1, 0.0) *
+            std::max((double)maxCell.y - minCell.y + 1, 0.0) *
+            std::max((double)maxCell.z - minCell.z + 1, 0.0);
+
+        if (cells > (double)MAX_CELLS_PER_BOX)
+            throw std::invalid_argument("The box covers too many cells!");
+
+        InsertItem(Item { bounds, minCell, maxCell, id });
+
+        return;
+    }
+
+    void SpatialHashGrid::Insert(const std::vector<Vector3d>& points, std::size_t firstId)
+    {
+        Reserve(items.size() + points.size());
+
+        for (std::size_t i = 0; i < points.size(); i++)
+            Insert(points[i], firstId + i);
+
+        return;
+    }
+
+    void SpatialHashGrid::Reserve(std::size_t count)
+    {
+        items.reserve(count);
+        entries.reserve(count);
+
+        // Keep the load factor at or below one half
+        std::size_t capacity = std::max<std::size_t>(slots.size(), 16);
+        while (capacity < count * 2)
+            capacity *= 2;
+
+        if (capacity > slots.size())
+            Rehash(capacity);
+
+        return;
+    }
+
+    void SpatialHashGrid::QueryCells(const Vector3i& minCell, const Vector3i& maxCell, std::vector<std::size_t>& out) const
+    {
+        // Nothing lies outside of the grid's range
+        const Vector3i limit(MAX_CELL_COORDINATE, MAX_CELL_COORDINATE, MAX_CELL_COORDINATE);
+        const Vector3i clampedMin(std::max(minCell.x, -limit.x), std::max(minCell.y, -limit.y), std::max(minCell.z, -limit.z));
+        const Vector3i clampedMax(std::min(maxCell.x, limit.x), std::min(maxCell.y, limit.y), std::min(maxCell.z, limit.z));
+
+        ForEachItem(clampedMin, clampedMax, [&out](const Item& item) {
+            out.push_back(item.id);
+        });
+
+        return;
+    }
+
+    void SpatialHashGrid::QueryRadius(const Vector3d& center, double radius, std::vector<std::size_t>& out) const
+    {
+        const Vector3d extent(radius, radius, radius);
+        const double sqrRadius = radius * radius;
+
+        ForEachItem(ClampedCellOf(center - extent), ClampedCellOf(center + extent), [&](const Item& item) {
+            if (SqrDistanceToBox(center, item.bounds) <= sqrRadius)
+                out.push_back(item.id);
+        });
+
+        return;
+    }
+
+    Vector3i SpatialHashGrid::CellOf(const Vector3d& point) const
+    {
+        const double limit = MAX_CELL_COORDINATE;
+        for (std::size_t i = 0; i < 3; i++)
+        {
+            // Also catches NaN
+            const double cell = std::floor(point[i] / cellSize);
+            if (!((cell >= -limit) && (cell <= limit)))
+                throw std::invalid_argument("The point lies outside of the grid's range!");
+        }
+
+        return ClampedCellOf(point);
+    }
+
+    Vector3i SpatialHashGrid::ClampedCellOf(const Vector3d& point) const
+    {
+        if (std::isnan(point.x) || std::isnan(point.y) || std::isnan(point.z))
+            throw std::invalid_argument("The point is not a number!");
+
+        return Vector3i(
+            (int)ClampedCellCoordinate(point.x, cellSize),
+            (int)ClampedCellCoordinate(point.y, cellSize),
+            (int)ClampedCellCoordinate(point.z, cellSize)
+        );
+    }
+
+    double SpatialHashGrid::GetCellSize() const
+    {
+        return cellSize;
+    }
+
+    std::size_t SpatialHashGrid::Size() const
+    {
+        return items.size();
+    }
+
+    std::size_t SpatialHashGrid::CellCount() const
+    {
+        return occupiedSlots;
+    }
+
+    void SpatialHashGrid::Clear()
+    {
+        slots.clear();
+        entries.clear();
+        items.clear();
+        occupiedSlots = 0;
+
+        return;
+    }
+
+    void SpatialHashGrid::InsertItem(const Item& item)
+    {
+        const std::uint32_t itemIndex = (std::uint32_t)items.size();
+        items.push_back(item);
+
+        for (int x = item.minCell.x; x <= item.maxCell.x; x++)
+            for (int y = item.minCell.y; y <= item.maxCell.y; y++)
+                for (int z = item.minCell.z; z <= item.maxCell.z; z++)
+                {
+                    // Keep the load factor at or below one half
+                    if ((occupiedSlots + 1) * 2 > slots.size())
+                        Rehash(std::max<std::size_t>(slots.size() * 2, 16));
+
+                    const Vector3i cell(x, y, z);
+                    Slot& slot = slots[FindSlot(cell)];
+
+                    if (slot.head == NULL_ENTRY)
+                    {
+                        slot.cell = cell;
+                        occupiedSlots++;
+                    }
+
+                    // Prepend to the cell's list
+                    entries.push_back(Entry { itemIndex, slot.head });
+                    slot.head = (std::uint32_t)(entries.size() - 1);
+                }
+
+        return;
+    }
+
+    std::size_t SpatialHashGrid::FindSlot(const Vector3i& cell) const
+    {
+        const std::size_t mask = slots.size() - 1;
+
+        std::size_t i = std::hash<Vector3i>()(cell) & mask;
+        while ((slots[i].head != NULL_ENTRY) && (slots[i].cell != cell))
+            i = (i + 1) & mask;
+
+        return i;
+    }
+
+    void SpatialHashGrid::Rehash(std::size_t capacity)
+    {
+        std::vector<Slot> old(capacity);
+        std::swap(old, slots);
+
+        for (const Slot& slot : old)
+            if (slot.head != NULL_ENTRY)
+                slots[FindSlot(slot.cell)] = slot;
+
+        return;
+    }
+
+    template <typename Visit>
+    void SpatialHashGrid::ForEachItem(const Vector3i& minCell, const Vector3i& maxCell, Visit visit) const
+    {
+        if (occupiedSlots == 0)
+            return;
+
+        // A box covering multiple cells gets visited in the first cell it shares with the range only
+        const auto visitCell = [&](const Slot& slot) {
+            for (std::uint32_t e = slot.head; e != NULL_ENTRY; e = entries[e].next)
+            {
+                const Item& item = items[entries[e].item];
+
+                if ((slot.cell.x == std::max(item.minCell.x, minCell.x)) &&
+                    (slot.cell.y == std::max(item.minCell.y, minCell.y)) &&
+                    (slot.cell.z == std::max(item.minCell.z, minCell.z)))
+                    visit(item);
+            }
+        };
+
+        const double rangeCells =
+            ((double)maxCell.x - minCell.x + 1) *
+            ((double)maxCell.y - minCell.y + 1) *
+            ((double)maxCell.z - minCell.z + 1);
+
+        // Large ranges are cheaper to answer by scanning the whole table, than by looking up each cell
+        if (rangeCells > (double)slots.size())
+        {
+            for (const Slot& slot : slots)
+                if ((slot.head != NULL_ENTRY) && InRange(slot.cell, minCell, maxCell))
+                    visitCell(slot);
+
+            return;
+        }
+
+        for (int x = minCell.x; x <= maxCell.x; x++)
+            for (int y = minCell.y; y <= maxCell.y; y++)
+                for (int z = minCell.z; z <= maxCell.z; z++)
+                {
+                    const Slot& slot = slots[FindSlot(Vector3i(x, y, z))];
+                    if (slot.head != NULL_ENTRY)
+                        visitCell(slot);
+                }
+
+        return;
+    }
+}
@@ -0,0 +1,166 @@
+#include "Eule/SweepAndPrune.h"
+#include "Eule/Overlap.h"
+#include "Eule/Parallel.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Leonetienne::Eule {
+
+    std::size_t SweepAndPrune::Add(const TrapazoidalPrismCollider& collider)
+    {
+        std::size_t handle;
+        if (!freeHandles.empty())
+        {
+            handle = freeHandles.back();
+            freeHandles.pop_back();
+        }
+        else
+        {
+            handle = proxies.size();
+            proxies.emplace_back();
+        }
+
+        Proxy& proxy = proxies[handle];
+        proxy.collider = &collider;
+        proxy.bounds = collider.GetBounds();
+
+        endpoints.push_back(Endpoint { proxy.bounds.min.x, handle, true });
+        SiftDown(endpoints.size() - 1);
+        endpoints.push_back(Endpoint { proxy.bounds.max.x, handle, false });
+        SiftDown(endpoints.size() - 1);
+
+        return handle;
+    }
+
+    void SweepAndPrune::Remove(std::size_t handle)
+    {
+        CheckHandle(handle);
+
+        endpoints.erase(
+            std::remove_if(endpoints.begin(), endpoints.end(), [handle](const Endpoint& e) { return e.proxy == handle; }),
+            endpoints.end()
+        );
+
+        proxies[handle] = Proxy();
+        freeHandles.push_back(handle);
+
+        return;
+    }
+
+    std::size_t SweepAndPrune::Update()
+    {
+        for (Proxy& proxy : proxies)
+            if (proxy.collider)
+                proxy.bounds = proxy.collider->GetBounds();
+
+        for (Endpoint& e : endpoints)
+        {
+            const AABB& bounds = proxies[e.proxy].bounds;
+            e.value = e.isMin ? bounds.min.x : bounds.max.x;
+        }
+
+        // Insertion sort. Close to linear, as long as the order barely changed since the last update
+        std::size_t swaps = 0;
+        for (std::size_t i = 1; i < endpoints.size(); i++)
+            swaps += SiftDown(i);
+
+        return swaps;
+    }
+
+    const AABB& SweepAndPrune::GetBounds(std::size_t handle) const
+    {
+        CheckHandle(handle);
+        return proxies[handle].bounds;
+    }
+
+    std::size_t SweepAndPrune::Size() const
+    {
+        return proxies.size() - freeHandles.size();
+    }
+
+    void SweepAndPrune::Clear()
+    {
+        proxies.clear();
+        freeHandles.clear();
+        endpoints.clear();
+
+        return;
+    }
+
+    void SweepAndPrune::FindOverlappingPairs(std::vector<std::pair<std::size_t, std::size_t>>& out) const
+    {
+        // Proxies whose x interval contains the current sweep position
+        std::vector<std::size_t> active;
+
+        for (const Endpoint& e : endpoints)
+        {
+            if (!e.isMin)
+            {
+                // Order within the active list doesn't matter
+                std::vector<std::size_t>::iterator it = std::find(active.begin(), active.end(), e.proxy);
+                *it = active.back();
+                active.pop_back();
+                continue;
+            }
+
+            // All active intervals overlap this one in x. Only y and z are left to test
+            const AABB& a = proxies[e.proxy].bounds;
+            for (const std::size_t other : active)
+            {
+                const AABB& b = proxies[other].bounds;
+
+                if ((a.min.y <= b.max.y) && (b.min.y <= a.max.y) &&
+                    (a.min.z <= b.max.z) && (b.min.z <= a.max.z))
+                    out.emplace_back(std::min(e.proxy, other), std::max(e.proxy, other));
+            }
+
+            active.push_back(e.proxy);
+        }
+
+        return;
+    }
+
+    void SweepAndPrune::FindCollidingPairs(std::vector<std::pair<std::size_t, std::size_t>>& out, std::size_t threadCount) const
+    {
+        std::vector<std::pair<std::size_t, std::size_t>> candidates;
+        FindOverlappingPairs(candidates);
+
+        // Each thread flags its own contiguous range of candidates. Keeping the order of candidates keeps the result deterministic
+        std::vector<char> colliding(candidates.size(), 0);
+
+        Parallel::For(candidates.size(), threadCount, MIN_PAIRS_PER_THREAD, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++)
+                colliding[i] = Overlap::SAT(*proxies[candidates[i].first].collider, *proxies[candidates[i].second].collider);
+        });
+
+        for (std::size_t i = 0; i < candidates.size(); i++)
+            if (colliding[i])
+                out.push_back(candidates[i]);
+
+        return;
+    }
+
+    std::size_t SweepAndPrune::SiftDown(std::size_t index)
+    {
+        const Endpoint e = endpoints[index];
+
+        std::size_t i = index;
+        while ((i > 0) && (e < endpoints[i - 1]))
+        {
+            endpoints[i] = endpoints[i - 1];
+            i--;
+        }
+
+        endpoints[i] = e;
+
+        return index - i;
+    }
+
+    void SweepAndPrune::CheckHandle(std::size_t handle) const
+    {
+        if ((handle >= proxies.size()) || (!proxies[handle].collider))
+            throw std::out_of_range("No collider with this handle!");
+
+        return;
+    }
+}
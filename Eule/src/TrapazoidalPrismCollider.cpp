@@ -1,4 +1,16 @@
 #include "Eule/TrapazoidalPrismCollider.h"
+#include "Eule/Math.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+//#define _EULE_NO_INTRINSICS_
+#ifndef _EULE_NO_INTRINSICS_
+#include <immintrin.h>
+#endif
+
+#include "ClosestOnTriangle.h"
 
 using namespace Leonetienne::Eule;
 
@@ -28,75 +40,192 @@ const Vector3d& TrapazoidalPrismCollider::GetVertex(std::size_t index) const
 	return vertices[index];
 }
 
+AABB TrapazoidalPrismCollider::GetBounds() const
+{
+	AABB bounds { vertices[0], vertices[0] };
+
+	for (std::size_t i = 1; i < 8; i++)
+		for (std::size_t j = 0; j < 3; j++)
+		{
+			bounds.min[j] = std::min(bounds.min[j], vertices[i][j]);
+			bounds.max[j] = std::max(bounds.max[j], vertices[i][j]);
+		}
+
+	return bounds;
+}
+
 void TrapazoidalPrismCollider::SetVertex(std::size_t index, const Vector3d value)
 {
 	vertices[index] = value;
+
+	// Each vertex lies on exactly three faces. The normals of the other three don't depend on it
+	GenerateFaceNormal((index & RIGHT) ? FACE_NORMALS::RIGHT : FACE_NORMALS::LEFT);
+	GenerateFaceNormal((index & TOP) ? FACE_NORMALS::TOP : FACE_NORMALS::BOTTOM);
+	GenerateFaceNormal((index & FRONT) ? FACE_NORMALS::FRONT : FACE_NORMALS::BACK);
+
+	return;
+}
+
+void TrapazoidalPrismCollider::SetVertices(const std::array<Vector3d, 8>& values)
+{
+	vertices = values;
 	GenerateNormalsFromVertices();
 	return;
 }
 
-void TrapazoidalPrismCollider::GenerateNormalsFromVertices()
+void TrapazoidalPrismCollider::TransformBy(const Matrix4x4& transform)
+{
+	TransformBy(PrepareTransform(transform));
+	return;
+}
+
+void TrapazoidalPrismCollider::TransformBy(std::vector<TrapazoidalPrismCollider>& colliders, const Matrix4x4& transform)
 {
-	faceNormals[(std::size_t)FACE_NORMALS::LEFT] =
-		(vertices[BACK|LEFT|BOTTOM] - vertices[FRONT|LEFT|BOTTOM])
-		.CrossProduct(vertices[FRONT|LEFT|TOP] - vertices[FRONT|LEFT|BOTTOM]);
-	
-	faceNormals[(std::size_t)FACE_NORMALS::RIGHT] =
-		(vertices[FRONT|RIGHT|TOP] - vertices[FRONT|RIGHT|BOTTOM])
-		.CrossProduct(vertices[BACK|RIGHT|BOTTOM] - vertices[FRONT|RIGHT|BOTTOM]);
+	const PreparedTransform prepared = PrepareTransform(transform);
 
-	faceNormals[(std::size_t)FACE_NORMALS::FRONT] =
-		(vertices[FRONT|LEFT|TOP] - vertices[FRONT|LEFT|BOTTOM])
-		.CrossProduct(vertices[FRONT|RIGHT|BOTTOM] - vertices[FRONT|LEFT|BOTTOM]);
+	for (TrapazoidalPrismCollider& collider : colliders)
+		collider.TransformBy(prepared);
 
-	faceNormals[(std::size_t)FACE_NORMALS::BACK] =
-		(vertices[BACK|RIGHT|BOTTOM] - vertices[BACK|LEFT|BOTTOM])
-		.CrossProduct(vertices[BACK|LEFT|TOP] - vertices[BACK|LEFT|BOTTOM]);
+	return;
+}
 
-	faceNormals[(std::size_t)FACE_NORMALS::TOP] =
-		(vertices[BACK|LEFT|TOP] - vertices[FRONT|LEFT|TOP])
-		.CrossProduct(vertices[FRONT|RIGHT|TOP] - vertices[FRONT|LEFT|TOP]);
+void TrapazoidalPrismCollider::TransformBy(std::vector<TrapazoidalPrismCollider>& colliders, const std::vector<Matrix4x4>& transforms)
+{
+	if (colliders.size() != transforms.size())
+		throw std::invalid_argument("Every collider needs exactly one transform!");
 
-	faceNormals[(std::size_t)FACE_NORMALS::BOTTOM] =
-		(vertices[FRONT|RIGHT|BOTTOM] - vertices[FRONT|LEFT|BOTTOM])
-		.CrossProduct(vertices[BACK|LEFT|BOTTOM] - vertices[FRONT|LEFT|BOTTOM]);
+	for (std::size_t i = 0; i < colliders.size(); i++)
+		colliders[i].TransformBy(PrepareTransform(transforms[i]));
 
 	return;
 }
 
-double TrapazoidalPrismCollider::FaceDot(FACE_NORMALS face, const Vector3d& point) const
+TrapazoidalPrismCollider::PreparedTransform TrapazoidalPrismCollider::PrepareTransform(const Matrix4x4& transform)
+{
+	PreparedTransform prepared;
+
+	for (std::size_t column = 0; column < 4; column++)
+	{
+		for (std::size_t row = 0; row < 3; row++)
+			prepared.affine[column * 4 + row] = transform[row][column];
+		prepared.affine[column * 4 + 3] = 0;
+	}
+
+	// Each row of the cofactor matrix is the cross product of the other two rows
+	const std::array<double, 4>& r0 = transform[0];
+	const std::array<double, 4>& r1 = transform[1];
+	const std::array<double, 4>& r2 = transform[2];
+
+	const std::array<std::array<double, 3>, 3> cofactor = {{
+		{ r1[1] * r2[2] - r1[2] * r2[1], r1[2] * r2[0] - r1[0] * r2[2], r1[0] * r2[1] - r1[1] * r2[0] },
+		{ r2[1] * r0[2] - r2[2] * r0[1], r2[2] * r0[0] - r2[0] * r0[2], r2[0] * r0[1] - r2[1] * r0[0] },
+		{ r0[1] * r1[2] - r0[2] * r1[1], r0[2] * r1[0] - r0[0] * r1[2], r0[0] * r1[1] - r0[1] * r1[0] }
+	}};
+
+	for (std::size_t column = 0; column < 3; column++)
+	{
+		for (std::size_t row = 0; row < 3; row++)
+			prepared.cofactor[column * 4 + row] = cofactor[row][column];
+		prepared.cofactor[column * 4 + 3] = 0;
+	}
+
+	return prepared;
+}
+
+void TrapazoidalPrismCollider::TransformBy(const PreparedTransform& transform)
 {
-	// This vertex is the one being used twice to calculate the normals
-	std::size_t coreVertexIdx;
-	switch (face)
-	{
-	case FACE_NORMALS::LEFT:
-		coreVertexIdx = FRONT|LEFT|BOTTOM;
-		break;
-
-	case FACE_NORMALS::RIGHT:
-		coreVertexIdx = FRONT|RIGHT|BOTTOM;
-		break;
-	
-	case FACE_NORMALS::FRONT:
-		coreVertexIdx = FRONT|LEFT|BOTTOM;
-		break;
-	
-	case FACE_NORMALS::BACK:
-		coreVertexIdx = BACK|LEFT|BOTTOM;
-		break;
-	
-	case FACE_NORMALS::TOP:
-		coreVertexIdx = FRONT|LEFT|TOP;
-		break;
-	
-	case FACE_NORMALS::BOTTOM:
-		coreVertexIdx = FRONT|LEFT|BOTTOM;
-		break;
+#ifndef _EULE_NO_INTRINSICS_
+
+	const __m256d __a0 = _mm256_load_pd(&transform.affine[0]);
+	const __m256d __a1 = _mm256_load_pd(&transform.affine[4]);
+	const __m256d __a2 = _mm256_load_pd(&transform.affine[8]);
+	const __m256d __a3 = _mm256_load_pd(&transform.affine[12]);
+
+	alignas(32) double result[4];
+
+	// One vector per register: column0 * x + column1 * y + column2 * z (+ column3)
+	for (Vector3d& v : vertices)
+	{
+		__m256d __v = _mm256_fmadd_pd(__a2, _mm256_set1_pd(v.z), __a3);
+		__v = _mm256_fmadd_pd(__a1, _mm256_set1_pd(v.y), __v);
+		__v = _mm256_fmadd_pd(__a0, _mm256_set1_pd(v.x), __v);
+
+		_mm256_store_pd(result, __v);
+		v = Vector3d(result[0], result[1], result[2]);
 	}
 
+	const __m256d __c0 = _mm256_load_pd(&transform.cofactor[0]);
+	const __m256d __c1 = _mm256_load_pd(&transform.cofactor[4]);
+	const __m256d __c2 = _mm256_load_pd(&transform.cofactor[8]);
+
+	for (Vector3d& n : faceNormals)
+	{
+		__m256d __n = _mm256_mul_pd(__c2, _mm256_set1_pd(n.z));
+		__n = _mm256_fmadd_pd(__c1, _mm256_set1_pd(n.y), __n);
+		__n = _mm256_fmadd_pd(__c0, _mm256_set1_pd(n.x), __n);
+
+		_mm256_store_pd(result, __n);
+		n = Vector3d(result[0], result[1], result[2]);
+	}
+
+#else
+
+	const std::array<double, 16>& a = transform.affine;
+	for (Vector3d& v : vertices)
+		v = Vector3d(
+			a[0] * v.x + a[4] * v.y + a[8]  * v.z + a[12],
+			a[1] * v.x + a[5] * v.y + a[9]  * v.z + a[13],
+			a[2] * v.x + a[6] * v.y + a[10] * v.z + a[14]
+		);
+
+	const std::array<double, 12>& c = transform.cofactor;
+	for (Vector3d& n : faceNormals)
+		n = Vector3d(
+			c[0] * n.x + c[4] * n.y + c[8]  * n.z,
+			c[1] * n.x + c[5] * n.y + c[9]  * n.z,
+			c[2] * n.x + c[6] * n.y + c[10] * n.z
+		);
+
+#endif
+
+	return;
+}
+
+const Vector3d& TrapazoidalPrismCollider::GetFaceNormal(FACE_NORMALS face) const
+{
+	return faceNormals[(std::size_t)face];
+}
+
+double TrapazoidalPrismCollider::GetFaceOffset(FACE_NORMALS face) const
+{
+	const Vector3d& n = faceNormals[(std::size_t)face];
+	const Vector3d& core = vertices[faceCoreVertices[(std::size_t)face]];
+
+	return -(n.x * core.x + n.y * core.y + n.z * core.z);
+}
+
+void TrapazoidalPrismCollider::GenerateNormalsFromVertices()
+{
+	for (std::size_t i = 0; i < 6; i++)
+		GenerateFaceNormal((FACE_NORMALS)i);
+
+	return;
+}
+
+void TrapazoidalPrismCollider::GenerateFaceNormal(FACE_NORMALS face)
+{
+	const Vector3d& core = vertices[faceCoreVertices[(std::size_t)face]];
+	const std::array<std::size_t, 2>& span = faceSpanVertices[(std::size_t)face];
+
+	faceNormals[(std::size_t)face] = (vertices[span[0]] - core).CrossProduct(vertices[span[1]] - core);
+
+	return;
+}
+
+double TrapazoidalPrismCollider::FaceDot(FACE_NORMALS face, const Vector3d& point) const
+{
 	if ((std::size_t)face < 6)
-		return faceNormals[(std::size_t)face].DotProduct(point - vertices[coreVertexIdx]);
+		return faceNormals[(std::size_t)face].DotProduct(point - vertices[faceCoreVertices[(std::size_t)face]]);
 	return 1;
 }
 
@@ -108,3 +237,539 @@ bool TrapazoidalPrismCollider::Contains(const Vector3d& point) const
 
 	return true;
 }
+
+Vector3d TrapazoidalPrismCollider::SupportPoint(const Vector3d& direction) const
+{
+	std::size_t best = 0;
+	double bestDot = -std::numeric_limits<double>::infinity();
+
+	for (std::size_t i = 0; i < 8; i++)
+	{
+		const double dot = vertices[i].x * direction.x + vertices[i].y * direction.y + vertices[i].z * direction.z;
+		if (dot > bestDot)
+		{
+			bestDot = dot;
+			best = i;
+		}
+	}
+
+	return vertices[best];
+}
+
+void TrapazoidalPrismCollider::Contains(
+	const std::vector<TrapazoidalPrismCollider>& colliders,
+	const Vector3d& point,
+	std::vector<std::size_t>& out)
+{
+	const std::size_t count = colliders.size();
+	std::size_t i = 0;
+
+#ifndef _EULE_NO_INTRINSICS_
+
+	const __m256d __px = _mm256_set1_pd(point.x);
+	const __m256d __py = _mm256_set1_pd(point.y);
+	const __m256d __pz = _mm256_set1_pd(point.z);
+
+	// Four colliders per iteration. Every register holds one component of four colliders
+	for (; i + 4 <= count; i += 4)
+	{
+		const TrapazoidalPrismCollider* c = &colliders[i];
+
+		int outside = 0;
+
+		for (std::size_t f = 0; (f < 6) && (outside != 0xF); f++)
+		{
+			const std::size_t core = faceCoreVertices[f];
+
+			const __m256d __nx = _mm256_set_pd(c[3].faceNormals[f].x, c[2].faceNormals[f].x, c[1].faceNormals[f].x, c[0].faceNormals[f].x);
+			const __m256d __ny = _mm256_set_pd(c[3].faceNormals[f].y, c[2].faceNormals[f].y, c[1].faceNormals[f].y, c[0].faceNormals[f].y);
+			const __m256d __nz = _mm256_set_pd(c[3].faceNormals[f].z, c[2].faceNormals[f].z, c[1].faceNormals[f].z, c[0].faceNormals[f].z);
+
+			// Point relative to the face's core vertex
+			const __m256d __rx = _mm256_sub_pd(__px, _mm256_set_pd(c[3].vertices[core].x, c[2].vertices[core].x, c[1].vertices[core].x, c[0].vertices[core].x));
+			const __m256d __ry = _mm256_sub_pd(__py, _mm256_set_pd(c[3].vertices[core].y, c[2].vertices[core].y, c[1].vertices[core].y, c[0].vertices[core].y));
+			const __m256d __rz = _mm256_sub_pd(__pz, _mm256_set_pd(c[3].vertices[core].z, c[2].vertices[core].z, c[1].vertices[core].z, c[0].vertices[core].z));
+
+			__m256d __dot = _mm256_mul_pd(__nx, __rx);
+			__dot = _mm256_fmadd_pd(__ny, __ry, __dot);
+			__dot = _mm256_fmadd_pd(__nz, __rz, __dot);
+
+			outside |= _mm256_movemask_pd(_mm256_cmp_pd(__dot, _mm256_setzero_pd(), _CMP_LT_OQ));
+		}
+
+		for (std::size_t j = 0; j < 4; j++)
+			if (!(outside & (1 << j)))
+				out.push_back(i + j);
+	}
+
+#endif
+
+	// Remaining colliders (or all of them, without intrinsics). Qualified, to skip the virtual dispatch
+	for (; i < count; i++)
+		if (colliders[i].TrapazoidalPrismCollider::Contains(point))
+			out.push_back(i);
+
+	return;
+}
+
+bool TrapazoidalPrismCollider::Raycast(const Vector3d& origin, const Vector3d& direction, double maxT, RaycastHit& hit) const
+{
+	// The ray is inside of a face's plane, where a + b*t >= 0.
+	// Clip the interval [tEnter, tExit] against each face
+	double tEnter = -std::numeric_limits<double>::infinity();
+	double tExit = maxT;
+	std::size_t enterFace = 0;
+
+	for (std::size_t i = 0; i < 6; i++)
+	{
+		const Vector3d& n = faceNormals[i];
+		const double a = n.DotProduct(origin - vertices[faceCoreVertices[i]]);
+		const double b = n.DotProduct(direction);
+
+		// Parallel to this face. Either always inside, or never
+		if (b == 0)
+		{
+			if (a < 0)
+				return false;
+			continue;
+		}
+
+		const double t = -a / b;
+
+		// Entering through this face
+		if (b > 0)
+		{
+			if (t > tEnter)
+			{
+				tEnter = t;
+				enterFace = i;
+			}
+		}
+		// Exiting through this face
+		else if (t < tExit)
+			tExit = t;
+	}
+
+	const double t = Math::Max(tEnter, 0);
+	if (t > tExit)
+		return false;
+
+	FillRaycastHit(origin, direction, t, enterFace, hit);
+	return true;
+}
+
+bool TrapazoidalPrismCollider::Linecast(const Vector3d& from, const Vector3d& to, RaycastHit& hit) const
+{
+	return Raycast(from, to - from, 1, hit);
+}
+
+void TrapazoidalPrismCollider::FillRaycastHit(const Vector3d& origin, const Vector3d& direction, double t, std::size_t face, RaycastHit& hit) const
+{
+	hit.t = t;
+	hit.point = origin + direction * t;
+	hit.normal = -faceNormals[face].Normalize();
+	hit.face = face;
+
+	return;
+}
+
+namespace {
+	//! Will fill in a miss
+	void FillRaycastMiss(RaycastHit& hit)
+	{
+		hit.t = std::numeric_limits<double>::infinity();
+		hit.point = Vector3d();
+		hit.normal = Vector3d();
+		hit.face = 0;
+
+		return;
+	}
+
+#ifndef _EULE_NO_INTRINSICS_
+	//! Will clip four ray intervals [tEnter, tExit] against one face plane each, where a + b*t >= 0 is inside
+	inline void ClipAgainstFace(
+		__m256d __a,
+		__m256d __b,
+		double faceIdx,
+		__m256d& __tEnter,
+		__m256d& __tExit,
+		__m256d& __enterFace,
+		__m256d& __miss)
+	{
+		const __m256d __zero = _mm256_setzero_pd();
+
+		// Parallel, and outside
+		__miss = _mm256_or_pd(__miss, _mm256_and_pd(
+			_mm256_cmp_pd(__b, __zero, _CMP_EQ_OQ),
+			_mm256_cmp_pd(__a, __zero, _CMP_LT_OQ)
+		));
+
+		// Division by zero only happens on masked-out lanes
+		const __m256d __t = _mm256_div_pd(_mm256_sub_pd(__zero, __a), __b);
+
+		// Entering
+		const __m256d __isLater = _mm256_and_pd(
+			_mm256_cmp_pd(__b, __zero, _CMP_GT_OQ),
+			_mm256_cmp_pd(__t, __tEnter, _CMP_GT_OQ)
+		);
+		__tEnter = _mm256_blendv_pd(__tEnter, __t, __isLater);
+		__enterFace = _mm256_blendv_pd(__enterFace, _mm256_set1_pd(faceIdx), __isLater);
+
+		// Exiting
+		const __m256d __isEarlier = _mm256_and_pd(
+			_mm256_cmp_pd(__b, __zero, _CMP_LT_OQ),
+			_mm256_cmp_pd(__t, __tExit, _CMP_LT_OQ)
+		);
+		__tExit = _mm256_blendv_pd(__tExit, __t, __isEarlier);
+
+		return;
+	}
+
+	//! Will return a hit-mask, and the clamped t values, of four clipped ray intervals
+	inline int ResolveClippedRays(__m256d __tEnter, __m256d __tExit, __m256d __miss, __m256d& __t)
+	{
+		__t = _mm256_max_pd(__tEnter, _mm256_setzero_pd());
+
+		return _mm256_movemask_pd(_mm256_andnot_pd(__miss, _mm256_cmp_pd(__t, __tExit, _CMP_LE_OQ)));
+	}
+#endif
+}
+
+void TrapazoidalPrismCollider::Raycast(
+	const std::vector<Vector3d>& origins,
+	const std::vector<Vector3d>& directions,
+	double maxT,
+	std::vector<RaycastHit>& hits) const
+{
+	if (origins.size() != directions.size())
+		throw std::invalid_argument("Every ray needs exactly one origin and one direction!");
+
+	const std::size_t count = origins.size();
+	hits.resize(count);
+
+	std::size_t i = 0;
+
+#ifndef _EULE_NO_INTRINSICS_
+
+	const std::array<Vector3d, 6>& normals = faceNormals;
+
+	// Precompute the plane offsets. A point p is inside a face, if normal.p - offset >= 0
+	std::array<double, 6> offsets;
+	for (std::size_t f = 0; f < 6; f++)
+	{
+		const Vector3d& n = normals[f];
+		const Vector3d& core = vertices[faceCoreVertices[f]];
+		offsets[f] = n.x * core.x + n.y * core.y + n.z * core.z;
+	}
+
+	// Four rays per iteration. Every register holds one component of four rays
+	for (; i + 4 <= count; i += 4)
+	{
+		const Vector3d* o = &origins[i];
+		const Vector3d* dir = &directions[i];
+
+		const __m256d __ox = _mm256_set_pd(o[3].x, o[2].x, o[1].x, o[0].x);
+		const __m256d __oy = _mm256_set_pd(o[3].y, o[2].y, o[1].y, o[0].y);
+		const __m256d __oz = _mm256_set_pd(o[3].z, o[2].z, o[1].z, o[0].z);
+		const __m256d __dx = _mm256_set_pd(dir[3].x, dir[2].x, dir[1].x, dir[0].x);
+		const __m256d __dy = _mm256_set_pd(dir[3].y, dir[2].y, dir[1].y, dir[0].y);
+		const __m256d __dz = _mm256_set_pd(dir[3].z, dir[2].z, dir[1].z, dir[0].z);
+
+		__m256d __tEnter = _mm256_set1_pd(-std::numeric_limits<double>::infinity());
+		__m256d __tExit = _mm256_set1_pd(maxT);
+		__m256d __enterFace = _mm256_setzero_pd();
+		__m256d __miss = _mm256_setzero_pd();
+
+		for (std::size_t f = 0; f < 6; f++)
+		{
+			const __m256d __nx = _mm256_set1_pd(normals[f].x);
+			const __m256d __ny = _mm256_set1_pd(normals[f].y);
+			const __m256d __nz = _mm256_set1_pd(normals[f].z);
+
+			__m256d __a = _mm256_fmsub_pd(__nx, __ox, _mm256_set1_pd(offsets[f]));
+			__a = _mm256_fmadd_pd(__ny, __oy, __a);
+			__a = _mm256_fmadd_pd(__nz, __oz, __a);
+
+			__m256d __b = _mm256_mul_pd(__nx, __dx);
+			__b = _mm256_fmadd_pd(__ny, __dy, __b);
+			__b = _mm256_fmadd_pd(__nz, __dz, __b);
+
+			ClipAgainstFace(__a, __b, (double)f, __tEnter, __tExit, __enterFace, __miss);
+		}
+
+		// Retrieve results
+		__m256d __t;
+		const int hitMask = ResolveClippedRays(__tEnter, __tExit, __miss, __t);
+
+		double t[4];
+		double face[4];
+		_mm256_storeu_pd(t, __t);
+		_mm256_storeu_pd(face, __enterFace);
+
+		for (std::size_t j = 0; j < 4; j++)
+		{
+			if (hitMask & (1 << j))
+				FillRaycastHit(o[j], dir[j], t[j], (std::size_t)face[j], hits[i + j]);
+			else
+				FillRaycastMiss(hits[i + j]);
+		}
+	}
+
+#endif
+
+	// Remaining rays (or all of them, without intrinsics)
+	for (; i < count; i++)
+		if (!Raycast(origins[i], directions[i], maxT, hits[i]))
+			FillRaycastMiss(hits[i]);
+
+	return;
+}
+
+void TrapazoidalPrismCollider::Raycast(
+	const std::vector<TrapazoidalPrismCollider>& colliders,
+	const Vector3d& origin,
+	const Vector3d& direction,
+	double maxT,
+	std::vector<RaycastHit>& hits)
+{
+	const std::size_t count = colliders.size();
+	hits.resize(count);
+
+	std::size_t i = 0;
+
+#ifndef _EULE_NO_INTRINSICS_
+
+	const __m256d __ox = _mm256_set1_pd(origin.x);
+	const __m256d __oy = _mm256_set1_pd(origin.y);
+	const __m256d __oz = _mm256_set1_pd(origin.z);
+	const __m256d __dx = _mm256_set1_pd(direction.x);
+	const __m256d __dy = _mm256_set1_pd(direction.y);
+	const __m256d __dz = _mm256_set1_pd(direction.z);
+
+	// Four colliders per iteration. Every register holds one component of four colliders
+	for (; i + 4 <= count; i += 4)
+	{
+		const TrapazoidalPrismCollider* c = &colliders[i];
+
+		__m256d __tEnter = _mm256_set1_pd(-std::numeric_limits<double>::infinity());
+		__m256d __tExit = _mm256_set1_pd(maxT);
+		__m256d __enterFace = _mm256_setzero_pd();
+		__m256d __miss = _mm256_setzero_pd();
+
+		for (std::size_t f = 0; f < 6; f++)
+		{
+			const std::size_t core = faceCoreVertices[f];
+
+			const __m256d __nx = _mm256_set_pd(c[3].faceNormals[f].x, c[2].faceNormals[f].x, c[1].faceNormals[f].x, c[0].faceNormals[f].x);
+			const __m256d __ny = _mm256_set_pd(c[3].faceNormals[f].y, c[2].faceNormals[f].y, c[1].faceNormals[f].y, c[0].faceNormals[f].y);
+			const __m256d __nz = _mm256_set_pd(c[3].faceNormals[f].z, c[2].faceNormals[f].z, c[1].faceNormals[f].z, c[0].faceNormals[f].z);
+
+			// Origin relative to the face's core vertex
+			const __m256d __rx = _mm256_sub_pd(__ox, _mm256_set_pd(c[3].vertices[core].x, c[2].vertices[core].x, c[1].vertices[core].x, c[0].vertices[core].x));
+			const __m256d __ry = _mm256_sub_pd(__oy, _mm256_set_pd(c[3].vertices[core].y, c[2].vertices[core].y, c[1].vertices[core].y, c[0].vertices[core].y));
+			const __m256d __rz = _mm256_sub_pd(__oz, _mm256_set_pd(c[3].vertices[core].z, c[2].vertices[core].z, c[1].vertices[core].z, c[0].vertices[core].z));
+
+			__m256d __a = _mm256_mul_pd(__nx, __rx);
+			__a = _mm256_fmadd_pd(__ny, __ry, __a);
+			__a = _mm256_fmadd_pd(__nz, __rz, __a);
+
+			__m256d __b = _mm256_mul_pd(__nx, __dx);
+			__b = _mm256_fmadd_pd(__ny, __dy, __b);
+			__b = _mm256_fmadd_pd(__nz, __dz, __b);
+
+			ClipAgainstFace(__a, __b, (double)f, __tEnter, __tExit, __enterFace, __miss);
+		}
+
+		// Retrieve results
+		__m256d __t;
+		const int hitMask = ResolveClippedRays(__tEnter, __tExit, __miss, __t);
+
+		double t[4];
+		double face[4];
+		_mm256_storeu_pd(t, __t);
+		_mm256_storeu_pd(face, __enterFace);
+
+		for (std::size_t j = 0; j < 4; j++)
+		{
+			if (hitMask & (1 << j))
+				c[j].FillRaycastHit(origin, direction, t[j], (std::size_t)face[j], hits[i + j]);
+			else
+				FillRaycastMiss(hits[i + j]);
+		}
+	}
+
+#endif
+
+	// Remaining colliders (or all of them, without intrinsics)
+	for (; i < count; i++)
+		if (!colliders[i].Raycast(origin, direction, maxT, hits[i]))
+			FillRaycastMiss(hits[i]);
+
+	return;
+}
+
+namespace {
+	//! The six face planes of a prism, normalized. A point p is inside a plane if `nx*p.x + ny*p.y + nz*p.z + d >= 0`
+	struct FacePlanes
+	{
+		std::array<double, 6> nx;
+		std::array<double, 6> ny;
+		std::array<double, 6> nz;
+		std::array<double, 6> d;
+	};
+
+	FacePlanes NormalizedFacePlanes(const TrapazoidalPrismCollider& collider)
+	{
+		FacePlanes planes;
+
+		for (std::size_t i = 0; i < 6; i++)
+		{
+			const TrapazoidalPrismCollider::FACE_NORMALS face = (TrapazoidalPrismCollider::FACE_NORMALS)i;
+			const Vector3d& n = collider.GetFaceNormal(face);
+			const double length = sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+			const double scale = (length == 0) ? 0 : 1.0 / length;
+
+			planes.nx[i] = n.x * scale;
+			planes.ny[i] = n.y * scale;
+			planes.nz[i] = n.z * scale;
+			planes.d[i] = collider.GetFaceOffset(face) * scale;
+		}
+
+		return planes;
+	}
+
+	//! Will return how far a point lies beyond the face plane it is the furthest outside of. Negative, if it is inside all of them
+	inline double MaxPlaneDistance(const FacePlanes& planes, const Vector3d& point)
+	{
+		double distance = -std::numeric_limits<double>::infinity();
+		for (std::size_t i = 0; i < 6; i++)
+			distance = std::max(distance, -(planes.nx[i] * point.x + planes.ny[i] * point.y + planes.nz[i] * point.z + planes.d[i]));
+
+		return distance;
+	}
+
+	using TPC = TrapazoidalPrismCollider;
+
+	//! The vertices of each face, in order around it
+	constexpr std::array<std::array<std::size_t, 4>, 6> faceQuads = {{
+		{ TPC::BACK|TPC::LEFT|TPC::BOTTOM, TPC::BACK|TPC::LEFT|TPC::TOP, TPC::FRONT|TPC::LEFT|TPC::TOP, TPC::FRONT|TPC::LEFT|TPC::BOTTOM },	// LEFT
+		{ TPC::BACK|TPC::RIGHT|TPC::BOTTOM, TPC::BACK|TPC::RIGHT|TPC::TOP, TPC::FRONT|TPC::RIGHT|TPC::TOP, TPC::FRONT|TPC::RIGHT|TPC::BOTTOM },	// RIGHT
+		{ TPC::FRONT|TPC::LEFT|TPC::BOTTOM, TPC::FRONT|TPC::LEFT|TPC::TOP, TPC::FRONT|TPC::RIGHT|TPC::TOP, TPC::FRONT|TPC::RIGHT|TPC::BOTTOM },	// FRONT
+		{ TPC::BACK|TPC::LEFT|TPC::BOTTOM, TPC::BACK|TPC::LEFT|TPC::TOP, TPC::BACK|TPC::RIGHT|TPC::TOP, TPC::BACK|TPC::RIGHT|TPC::BOTTOM },	// BACK
+		{ TPC::BACK|TPC::LEFT|TPC::TOP, TPC::FRONT|TPC::LEFT|TPC::TOP, TPC::FRONT|TPC::RIGHT|TPC::TOP, TPC::BACK|TPC::RIGHT|TPC::TOP },	// TOP
+		{ TPC::BACK|TPC::LEFT|TPC::BOTTOM, TPC::FRONT|TPC::LEFT|TPC::BOTTOM, TPC::FRONT|TPC::RIGHT|TPC::BOTTOM, TPC::BACK|TPC::RIGHT|TPC::BOTTOM }	// BOTTOM
+	}};
+
+	//! Will find the closest point on the surface, for a point outside of the prism.
+	//! The closest point lies on a face whose plane the point is outside of, so only these faces get searched.
+	Vector3d ClosestOutsidePoint(const TrapazoidalPrismCollider& collider, const FacePlanes& planes, const Vector3d& point)
+	{
+		Vector3d closest = point;
+		double closestDistance = std::numeric_limits<double>::infinity();
+
+		for (std::size_t i = 0; i < 6; i++)
+		{
+			if (planes.nx[i] * point.x + planes.ny[i] * point.y + planes.nz[i] * point.z + planes.d[i] >= 0)
+				continue;
+
+			const Vector3d& a = collider.GetVertex(faceQuads[i][0]);
+			const Vector3d& b = collider.GetVertex(faceQuads[i][1]);
+			const Vector3d& c = collider.GetVertex(faceQuads[i][2]);
+			const Vector3d& d = collider.GetVertex(faceQuads[i][3]);
+
+			for (const Vector3d& candidate : { Internal::ClosestOnTriangle(point, a, b, c), Internal::ClosestOnTriangle(point, a, c, d) })
+			{
+				const double distance = (candidate - point).SqrMagnitude();
+				if (distance < closestDistance)
+				{
+					closest = candidate;
+					closestDistance = distance;
+				}
+			}
+		}
+
+		return closest;
+	}
+}
+
+double TrapazoidalPrismCollider::SignedDistance(const Vector3d& point) const
+{
+	const FacePlanes planes = NormalizedFacePlanes(*this);
+
+	// Inside, the distance to the closest face plane is exact, since the prism is convex
+	const double planeDistance = MaxPlaneDistance(planes, point);
+	if (planeDistance <= 0)
+		return planeDistance;
+
+	const Vector3d offset = ClosestOutsidePoint(*this, planes, point) - point;
+	return sqrt(offset.x * offset.x + offset.y * offset.y + offset.z * offset.z);
+}
+
+Vector3d TrapazoidalPrismCollider::ClosestPoint(const Vector3d& point) const
+{
+	const FacePlanes planes = NormalizedFacePlanes(*this);
+
+	if (MaxPlaneDistance(planes, point) <= 0)
+		return point;
+
+	return ClosestOutsidePoint(*this, planes, point);
+}
+
+void TrapazoidalPrismCollider::SignedDistance(const std::vector<Vector3d>& points, std::vector<double>& out) const
+{
+	const FacePlanes planes = NormalizedFacePlanes(*this);
+	const std::size_t count = points.size();
+	out.resize(count);
+
+	std::size_t i = 0;
+
+#ifndef _EULE_NO_INTRINSICS_
+
+	for (; i + 4 <= count; i += 4)
+	{
+		const Vector3d* p = &points[i];
+
+		const __m256d __px = _mm256_set_pd(p[3].x, p[2].x, p[1].x, p[0].x);
+		const __m256d __py = _mm256_set_pd(p[3].y, p[2].y, p[1].y, p[0].y);
+		const __m256d __pz = _mm256_set_pd(p[3].z, p[2].z, p[1].z, p[0].z);
+
+		// Negated plane equation of each face, keeping the maximum
+		__m256d __distance = _mm256_set1_pd(-std::numeric_limits<double>::infinity());
+		for (std::size_t f = 0; f < 6; f++)
+		{
+			__m256d __dot = _mm256_fmadd_pd(_mm256_set1_pd(planes.nx[f]), __px, _mm256_set1_pd(planes.d[f]));
+			__dot = _mm256_fmadd_pd(_mm256_set1_pd(planes.ny[f]), __py, __dot);
+			__dot = _mm256_fmadd_pd(_mm256_set1_pd(planes.nz[f]), __pz, __dot);
+
+			__distance = _mm256_max_pd(__distance, _mm256_sub_pd(_mm256_setzero_pd(), __dot));
+		}
+
+		_mm256_storeu_pd(&out[i], __distance);
+
+		// Points outside need their closest point on the surface
+		int outside = _mm256_movemask_pd(_mm256_cmp_pd(__distance, _mm256_setzero_pd(), _CMP_GT_OQ));
+		for (std::size_t j = 0; outside != 0; j++, outside >>= 1)
+			if (outside & 1)
+			{
+				const Vector3d offset = ClosestOutsidePoint(*this, planes, p[j]) - p[j];
+				out[i + j] = sqrt(offset.x * offset.x + offset.y * offset.y + offset.z * offset.z);
+			}
+	}
+
+#endif
+
+	// Remaining points (or all of them, without intrinsics)
+	for (; i < count; i++)
+	{
+		const double planeDistance = MaxPlaneDistance(planes, points[i]);
+		if (planeDistance <= 0)
+			out[i] = planeDistance;
+		else
+		{
+			const Vector3d offset = ClosestOutsidePoint(*this, planes, points[i]) - points[i];
+			out[i] = sqrt(offset.x * offset.x + offset.y * offset.y + offset.z * offset.z);
+		}
+	}
+
+	return;
+}
@@ -0,0 +1,420 @@
+#include "Eule/TriangleMesh.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+//#define _EULE_NO_INTRINSICS_
+#ifndef _EULE_NO_INTRINSICS_
+#include <immintrin.h>
+#endif
+
+namespace Leonetienne::Eule {
+
+    namespace {
+        // Möller-Trumbore. Returns the t a ray hits a triangle at, or infinity if it misses, or hits outside [0, maxT].
+        // Needs no epsilon: rays parallel to the triangle and degenerate triangles have det = 0, and the resulting
+        // infinities and NaNs fail the ordered comparisons below.
+        double IntersectTriangle(
+            const Vector3d& origin,
+            const Vector3d& direction,
+            double maxT,
+            double ax, double ay, double az,
+            double e1x, double e1y, double e1z,
+            double e2x, double e2y, double e2z)
+        {
+            const double px = direction.y * e2z - direction.z * e2y;
+            const double py = direction.z * e2x - direction.x * e2z;
+            const double pz = direction.x * e2y - direction.y * e2x;
+            const double inverseDet = 1.0 / (e1x * px + e1y * py + e1z * pz);
+
+            const double sx = origin.x - ax;
+            const double sy = origin.y - ay;
+            const double sz = origin.z - az;
+            const double u = (sx * px + sy * py + sz * pz) * inverseDet;
+
+            const double qx = sy * e1z - sz * e1y;
+            const double qy = sz * e1x - sx * e1z;
+            const double qz = sx * e1y - sy * e1x;
+            const double v = (direction.x * qx + direction.y * qy + direction.z * qz) * inverseDet;
+            const double t = (e2x * qx + e2y * qy + e2z * qz) * inverseDet;
+
+            if ((u >= 0) && (v >= 0) && (u + v <= 1) && (t >= 0) && (t <= maxT))
+                return t;
+
+            return std::numeric_limits<double>::infinity();
+        }
+
+#ifndef _EULE_NO_INTRINSICS_
+
+        //! A ray, broadcast to all four lanes
+        struct RayPack
+        {
+            __m256d __ox, __oy, __oz;
+            __m256d __dx, __dy, __dz;
+            __m256d __maxT;
+        };
+
+        //! Four triangles, one per lane
+        struct TrianglePack
+        {
+            __m256d __ax, __ay, __az;
+            __m256d __e1x, __e1y, __e1z;
+            __m256d __e2x, __e2y, __e2z;
+        };
+
+        // IntersectTriangle(), for four triangles at once
+        __m256d IntersectTriangles(const RayPack& ray, const TrianglePack& tri)
+        {
+            const __m256d __px = _mm256_sub_pd(_mm256_mul_pd(ray.__dy, tri.__e2z), _mm256_mul_pd(ray.__dz, tri.__e2y));
+            const __m256d __py = _mm256_sub_pd(_mm256_mul_pd(ray.__dz, tri.__e2x), _mm256_mul_pd(ray.__dx, tri.__e2z));
+            const __m256d __pz = _mm256_sub_pd(_mm256_mul_pd(ray.__dx, tri.__e2y), _mm256_mul_pd(ray.__dy, tri.__e2x));
+
+            __m256d __det = _mm256_mul_pd(tri.__e1z, __pz);
+            __det = _mm256_fmadd_pd(tri.__e1y, __py, __det);
+            __det = _mm256_fmadd_pd(tri.__e1x, __px, __det);
+            const __m256d __inverseDet = _mm256_div_pd(_mm256_set1_pd(1.0), __det);
+
+            const __m256d __sx = _mm256_sub_pd(ray.__ox, tri.__ax);
+            const __m256d __sy = _mm256_sub_pd(ray.__oy, tri.__ay);
+            const __m256d __sz = _mm256_sub_pd(ray.__oz, tri.__az);
+
+            __m256d __u = _mm256_mul_pd(__sz, __pz);
+            __u = _mm256_fmadd_pd(__sy, __py, __u);
+            __u = _mm256_fmadd_pd(__sx, __px, __u);
+            __u = _mm256_mul_pd(__u, __inverseDet);
+
+            const __m256d __qx = _mm256_sub_pd(_mm256_mul_pd(__sy, tri.__e1z), _mm256_mul_pd(__sz, tri.__e1y));
+            const __m256d __qy = _mm256_sub_pd(_mm256_mul_pd(__sz, tri.__e1x), _mm256_mul_pd(__sx, tri.__e1z));
+            const __m256d __qz = _mm256_sub_pd(_mm256_mul_pd(__sx, tri.__e1y), _mm256_mul_pd(__sy, tri.__e1x));
+
+            __m256d __v = _mm256_mul_pd(ray.__dz, __qz);
+            __v = _mm256_fmadd_pd(ray.__dy, __qy, __v);
+            __v = _mm256_fmadd_pd(ray.__dx, __qx, __v);
+            __v = _mm256_mul_pd(__v, __inverseDet);
+
+            __m256d __t = _mm256_mul_pd(tri.__e2z, __qz);
+            __t = _mm256_fmadd_pd(tri.__e2y, __qy, __t);
+            __t = _mm256_fmadd_pd(tri.__e2x, __qx, __t);
+            __t = _mm256_mul_pd(__t, __inverseDet);
+
+            const __m256d __zero = _mm256_setzero_pd();
+            __m256d __hit = _mm256_cmp_pd(__u, __zero, _CMP_GE_OQ);
+            __hit = _mm256_and_pd(__hit, _mm256_cmp_pd(__v, __zero, _CMP_GE_OQ));
+            __hit = _mm256_and_pd(__hit, _mm256_cmp_pd(_mm256_add_pd(__u, __v), _mm256_set1_pd(1.0), _CMP_LE_OQ));
+            __hit = _mm256_and_pd(__hit, _mm256_cmp_pd(__t, __zero, _CMP_GE_OQ));
+            __hit = _mm256_and_pd(__hit, _mm256_cmp_pd(__t, ray.__maxT, _CMP_LE_OQ));
+
+            return _mm256_blendv_pd(_mm256_set1_pd(std::numeric_limits<double>::infinity()), __t, __hit);
+        }
+
+        RayPack BroadcastRay(const Vector3d& origin, const Vector3d& direction, double maxT)
+        {
+            return RayPack {
+                _mm256_set1_pd(origin.x), _mm256_set1_pd(origin.y), _mm256_set1_pd(origin.z),
+                _mm256_set1_pd(direction.x), _mm256_set1_pd(direction.y), _mm256_set1_pd(direction.z),
+                _mm256_set1_pd(maxT)
+            };
+        }
+
+#endif
+    }
+
+    TriangleMesh::TriangleMesh()
+    {
+        return;
+    }
+
+    TriangleMesh::TriangleMesh(const std::vector<Vector3d>& vertices, const std::vector<std::array<std::size_t, 3>>& triangles)
+        :
+        triangles { triangles }
+    {
+        vx.reserve(vertices.size());
+        vy.reserve(vertices.size());
+        vz.reserve(vertices.size());
+
+        for (const Vector3d& v : vertices)
+        {
+            vx.push_back(v.x);
+            vy.push_back(v.y);
+            vz.push_back(v.z);
+        }
+
+        // Padding triangles are all zero, so they are degenerate, and never get hit
+        const std::size_t padded = (triangles.size() + TRIANGLE_BLOCK_WIDTH - 1) / TRIANGLE_BLOCK_WIDTH * TRIANGLE_BLOCK_WIDTH;
+        for (std::vector<double>* component : { &ax, &ay, &az, &e1x, &e1y, &e1z, &e2x, &e2y, &e2z })
+            component->resize(padded, 0);
+
+        for (std::size_t i = 0; i < triangles.size(); i++)
+        {
+            const std::array<std::size_t, 3>& triangle = triangles[i];
+            if ((triangle[0] >= vertices.size()) || (triangle[1] >= vertices.size()) || (triangle[2] >= vertices.size()))
+                throw std::out_of_range("Triangle references a vertex that does not exist!");
+
+            const Vector3d& a = vertices[triangle[0]];
+            const Vector3d& b = vertices[triangle[1]];
+            const Vector3d& c = vertices[triangle[2]];
+
+            ax[i] = a.x;
+            ay[i] = a.y;
+            az[i] = a.z;
+            e1x[i] = b.x - a.x;
+            e1y[i] = b.y - a.y;
+            e1z[i] = b.z - a.z;
+            e2x[i] = c.x - a.x;
+            e2y[i] = c.y - a.y;
+            e2z[i] = c.z - a.z;
+        }
+
+        return;
+    }
+
+    std::size_t TriangleMesh::GetVertexCount() const
+    {
+        return vx.size();
+    }
+
+    Vector3d TriangleMesh::GetVertex(std::size_t index) const
+    {
+        return Vector3d(vx[index], vy[index], vz[index]);
+    }
+
+    std::size_t TriangleMesh::GetTriangleCount() const
+    {
+        return triangles.size();
+    }
+
+    const std::array<std::size_t, 3>& TriangleMesh::GetTriangle(std::size_t index) const
+    {
+        return triangles[index];
+    }
+
+    const std::vector<std::array<std::size_t, 3>>& TriangleMesh::GetTriangles() const
+    {
+        return triangles;
+    }
+
+    Vector3d TriangleMesh::GetFaceNormal(std::size_t index) const
+    {
+        const Vector3d e1(e1x[index], e1y[index], e1z[index]);
+        const Vector3d e2(e2x[index], e2y[index], e2z[index]);
+        const Vector3d normal = e1.CrossProduct(e2);
+
+        return normal / normal.Magnitude();
+    }
+
+    void TriangleMesh::GetFaceNormals(std::vector<Vector3d>& out) const
+    {
+        out.resize(triangles.size());
+        std::size_t i = 0;
+
+#ifndef _EULE_NO_INTRINSICS_
+
+        alignas(32) double x[4];
+        alignas(32) double y[4];
+        alignas(32) double z[4];
+
+        // Four cross products per iteration. Stops before the padding
+        for (; i + 4 <= triangles.size(); i += 4)
+        {
+            const __m256d __e1x = _mm256_loadu_pd(&e1x[i]);
+            const __m256d __e1y = _mm256_loadu_pd(&e1y[i]);
+            const __m256d __e1z = _mm256_loadu_pd(&e1z[i]);
+            const __m256d __e2x = _mm256_loadu_pd(&e2x[i]);
+            const __m256d __e2y = _mm256_loadu_pd(&e2y[i]);
+            const __m256d __e2z = _mm256_loadu_pd(&e2z[i]);
+
+            const __m256d __nx = _mm256_sub_pd(_mm256_mul_pd(__e1y, __e2z), _mm256_mul_pd(__e1z, __e2y));
+            const __m256d __ny = _mm256_sub_pd(_mm256_mul_pd(__e1z, __e2x), _mm256_mul_pd(__e1x, __e2z));
+            const __m256d __nz = _mm256_sub_pd(_mm256_mul_pd(__e1x, __e2y), _mm256_mul_pd(__e1y, __e2x));
+
+            __m256d __length = _mm256_mul_pd(__nz, __nz);
+            __length = _mm256_fmadd_pd(__ny, __ny, __length);
+            __length = _mm256_fmadd_pd(__nx, __nx, __length);
+            const __m256d __inverseLength = _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(__length));
+
+            _mm256_store_pd(x, _mm256_mul_pd(__nx, __inverseLength));
+            _mm256_store_pd(y, _mm256_mul_pd(__ny, __inverseLength));
+            _mm256_store_pd(z, _mm256_mul_pd(__nz, __inverseLength));
+
+            for (std::size_t j = 0; j < 4; j++)
+                out[i + j] = Vector3d(x[j], y[j], z[j]);
+        }
+
+#endif
+
+        for (; i < triangles.size(); i++)
+            out[i] = GetFaceNormal(i);
+
+        return;
+    }
+
+    AABB TriangleMesh::GetBounds() const
+    {
+        if (vx.empty())
+            throw std::logic_error("The mesh has no vertices!");
+
+        AABB bounds { GetVertex(0), GetVertex(0) };
+
+        for (std::size_t i = 1; i < vx.size(); i++)
+        {
+            bounds.min.x = std::min(bounds.min.x, vx[i]);
+            bounds.min.y = std::min(bounds.min.y, vy[i]);
+            bounds.min.z = std::min(bounds.min.z, vz[i]);
+            bounds.max.x = std::max(bounds.max.x, vx[i]);
+            bounds.max.y = std::max(bounds.max.y, vy[i]);
+            bounds.max.z = std::max(bounds.max.z, vz[i]);
+        }
+
+        return bounds;
+    }
+
+    AABB TriangleMesh::GetTriangleBounds(std::size_t index) const
+    {
+        const std::array<std::size_t, 3>& triangle = triangles[index];
+        AABB bounds { GetVertex(triangle[0]), GetVertex(triangle[0]) };
+
+        for (std::size_t k = 1; k < 3; k++)
+        {
+            const Vector3d v = GetVertex(triangle[k]);
+            for (std::size_t j = 0; j < 3; j++)
+            {
+                bounds.min[j] = std::min(bounds.min[j], v[j]);
+                bounds.max[j] = std::max(bounds.max[j], v[j]);
+            }
+        }
+
+        return bounds;
+    }
+
+    bool TriangleMesh::Raycast(const Vector3d& origin, const Vector3d& direction, double maxT, RaycastHit& hit) const
+    {
+        double bestT = std::numeric_limits<double>::infinity();
+        std::size_t best = 0;
+
+#ifndef _EULE_NO_INTRINSICS_
+
+        const RayPack ray = BroadcastRay(origin, direction, maxT);
+        alignas(32) double t[4];
+
+        // The padding makes up full blocks
+        for (std::size_t i = 0; i < ax.size(); i += 4)
+        {
+            const TrianglePack tri {
+                _mm256_loadu_pd(&ax[i]), _mm256_loadu_pd(&ay[i]), _mm256_loadu_pd(&az[i]),
+                _mm256_loadu_pd(&e1x[i]), _mm256_loadu_pd(&e1y[i]), _mm256_loadu_pd(&e1z[i]),
+                _mm256_loadu_pd(&e2x[i]), _mm256_loadu_pd(&e2y[i]), _mm256_loadu_pd(&e2z[i])
+            };
+
+            const __m256d __t = IntersectTriangles(ray, tri);
+
+            // Only look at the lanes if any of them improves on the best hit
+            if (!_mm256_movemask_pd(_mm256_cmp_pd(__t, _mm256_set1_pd(bestT), _CMP_LT_OQ)))
+                continue;
+
+            _mm256_store_pd(t, __t);
+            for (std::size_t j = 0; j < 4; j++)
+                if (t[j] < bestT)
+                {
+                    bestT = t[j];
+                    best = i + j;
+                }
+        }
+
+#else
+
+        for (std::size_t i = 0; i < triangles.size(); i++)
+        {
+            const double t = IntersectTriangle(origin, direction, maxT, ax[i], ay[i], az[i], e1x[i], e1y[i], e1z[i], e2x[i], e2y[i], e2z[i]);
+            if (t < bestT)
+            {
+                bestT = t;
+                best = i;
+            }
+        }
+
+#endif
+
+        if (bestT == std::numeric_limits<double>::infinity())
+            return false;
+
+        FillRaycastHit(origin, direction, bestT, best, hit);
+
+        return true;
+    }
+
+    bool TriangleMesh::Raycast(
+        const Vector3d& origin,
+        const Vector3d& direction,
+        double maxT,
+        const std::vector<std::size_t>& candidates,
+        RaycastHit& hit) const
+    {
+        double bestT = std::numeric_limits<double>::infinity();
+        std::size_t best = 0;
+        std::size_t i = 0;
+
+#ifndef _EULE_NO_INTRINSICS_
+
+        const RayPack ray = BroadcastRay(origin, direction, maxT);
+        alignas(32) double t[4];
+
+        // Four listed triangles per iteration, gathered into the lanes
+        for (; i + 4 <= candidates.size(); i += 4)
+        {
+            const std::size_t* tr = &candidates[i];
+            const TrianglePack tri {
+                _mm256_set_pd(ax[tr[3]], ax[tr[2]], ax[tr[1]], ax[tr[0]]),
+                _mm256_set_pd(ay[tr[3]], ay[tr[2]], ay[tr[1]], ay[tr[0]]),
+                _mm256_set_pd(az[tr[3]], az[tr[2]], az[tr[1]], az[tr[0]]),
+                _mm256_set_pd(e1x[tr[3]], e1x[tr[2]], e1x[tr[1]], e1x[tr[0]]),
+                _mm256_set_pd(e1y[tr[3]], e1y[tr[2]], e1y[tr[1]], e1y[tr[0]]),
+                _mm256_set_pd(e1z[tr[3]], e1z[tr[2]], e1z[tr[1]], e1z[tr[0]]),
+                _mm256_set_pd(e2x[tr[3]], e2x[tr[2]], e2x[tr[1]], e2x[tr[0]]),
+                _mm256_set_pd(e2y[tr[3]], e2y[tr[2]], e2y[tr[1]], e2y[tr[0]]),
+                _mm256_set_pd(e2z[tr[3]], e2z[tr[2]], e2z[tr[1]], e2z[tr[0]])
+            };
+
+            const __m256d __t = IntersectTriangles(ray, tri);
+            if (!_mm256_movemask_pd(_mm256_cmp_pd(__t, _mm256_set1_pd(bestT), _CMP_LT_OQ)))
+                continue;
+
+            _mm256_store_pd(t, __t);
+            for (std::size_t j = 0; j < 4; j++)
+                if (t[j] < bestT)
+                {
+                    bestT = t[j];
+                    best = tr[j];
+                }
+        }
+
+#endif
+
+        for (; i < candidates.size(); i++)
+        {
+            const std::size_t k = candidates[i];
+            const double t = IntersectTriangle(origin, direction, maxT, ax[k], ay[k], az[k], e1x[k], e1y[k], e1z[k], e2x[k], e2y[k], e2z[k]);
+            if (t < bestT)
+            {
+                bestT = t;
+                best = k;
+            }
+        }
+
+        if (bestT == std::numeric_limits<double>::infinity())
+            return false;
+
+        FillRaycastHit(origin, direction, bestT, best, hit);
+
+        return true;
+    }
+
+    void TriangleMesh::FillRaycastHit(const Vector3d& origin, const Vector3d& direction, double t, std::size_t triangle, RaycastHit& hit) const
+    {
+        hit.t = t;
+        hit.point = origin + direction * t;
+        hit.normal = GetFaceNormal(triangle);
+        hit.face = triangle;
+
+        return;
+    }
+}
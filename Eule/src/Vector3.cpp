@@ -36,27 +36,11 @@ namespace Leonetienne::Eule {
     template<>
     double Vector3<double>::DotProduct(const Vector3<double>& other) const
     {
-#ifndef _EULE_NO_INTRINSICS_
-
-        // Move vector components into registers
-	__m256 __vector_self  = _mm256_set_ps(0,0,0,0,0, (float)z, (float)y, (float)x);
-	__m256 __vector_other = _mm256_set_ps(0,0,0,0,0, (float)other.z, (float)other.y, (float)other.x);
-
-	// Define bitmask, and execute computation
-	const int mask = 0x71; // -> 0111 1000 -> use positions 0111 (last 3) of the vectors supplied, and place them in 1000 (first only) element of __dot
-	__m256 __dot = _mm256_dp_ps(__vector_self, __vector_other, mask);
-
-	// Retrieve result, and return it
-	float result[8];
-	_mm256_storeu_ps(result, __dot);
-
-	return result[0];
-
-#else
+        // Stays in double precision, even with intrinsics enabled. Going through floats would lose
+        // most of the precision geometric predicates, like those of ConvexHull and Overlap, rely on
         return (x * other.x) +
                (y * other.y) +
                (z * other.z);
-#endif
     }
 
 // Slow, lame version for intcels
@@ -0,0 +1,257 @@
+#include "Eule/VertexWelder.h"
+#include "Eule/VoxelGridFilter.h"
+#include "Eule/Parallel.h"
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+namespace Leonetienne::Eule {
+
+    namespace {
+        //! The points within each occupied cell, as ranges of one array of point indices, in ascending order.
+        //! A flat hash table (open addressing, keyed by std::hash<Vector3i>) finds the range of a cell.
+        struct CellTable
+        {
+            //! Everything about a cell in one place, so that looking it up touches a single cache line
+            struct Slot
+            {
+                Vector3i cell;
+                std::size_t begin = 0;
+                // Zero marks an empty slot
+                std::size_t count = 0;
+            };
+
+            std::vector<Slot> slots;
+            std::vector<std::size_t> members;
+            std::size_t occupied = 0;
+
+            //! Will sort points into their cells. `indices` have to be ascending
+            void Build(const std::vector<std::size_t>& indices, const std::vector<Vector3i>& cellOf, const std::vector<std::size_t>& hashOf)
+            {
+                slots.resize(16);
+
+                for (const std::size_t i : indices)
+                    Insert(cellOf[i], hashOf[i], 1);
+
+                std::size_t begin = 0;
+                for (Slot& slot : slots)
+                {
+                    slot.begin = begin;
+                    begin += slot.count;
+                }
+
+                // Placing the points in order keeps each range ascending. Slots get their begin back afterwards
+                members.resize(indices.size());
+                for (const std::size_t i : indices)
+                    members[slots[SlotOf(cellOf[i], hashOf[i])].begin++] = i;
+
+                for (Slot& slot : slots)
+                    slot.begin -= slot.count;
+
+                return;
+            }
+
+            //! Will return the slot of a cell, or nullptr
+            const Slot* Find(const Vector3i& cell, std::size_t hash) const
+            {
+                const std::size_t i = SlotOf(cell, hash);
+                return (i == NOT_FOUND) ? nullptr : &slots[i];
+            }
+
+        private:
+            static constexpr std::size_t NOT_FOUND = SIZE_MAX;
+
+            //! Will return the index of the slot of a cell, or NOT_FOUND
+            std::size_t SlotOf(const Vector3i& cell, std::size_t hash) const
+            {
+                const std::size_t mask = slots.size() - 1;
+                for (std::size_t i = hash & mask; slots[i].count != 0; i = (i + 1) & mask)
+                    if (slots[i].cell == cell)
+                        return i;
+
+                return NOT_FOUND;
+            }
+
+            //! Will add `count` points to a cell
+            void Insert(const Vector3i& cell, std::size_t hash, std::size_t count)
+            {
+                // Keep the load factor at or below one half
+                if ((occupied + 1) * 2 > slots.size())
+                    Grow();
+
+                const std::size_t mask = slots.size() - 1;
+                std::size_t i = hash & mask;
+                while ((slots[i].count != 0) && (slots[i].cell != cell))
+                    i = (i + 1) & mask;
+
+                if (slots[i].count == 0)
+                {
+                    slots[i].cell = cell;
+                    occupied++;
+                }
+
+                slots[i].count += count;
+
+                return;
+            }
+
+            //! Will double the capacity, and re-insert all occupied slots
+            void Grow()
+            {
+                std::vector<Slot> old(slots.size() * 2);
+                std::swap(old, slots);
+                occupied = 0;
+
+                const std::hash<Vector3i> hash;
+                for (const Slot& slot : old)
+                    if (slot.count != 0)
+                        Insert(slot.cell, hash(slot.cell), slot.count);
+
+                return;
+            }
+        };
+
+        //! Which partition a cell belongs to. Uses the upper bits of the hash, as the tables index by the lower ones
+        inline std::size_t PartitionOf(std::size_t hash, std::size_t partitions)
+        {
+            return (std::size_t)(((std::uint64_t)hash >> 40) % partitions);
+        }
+
+        //! The hash grid, split into partitions of disjoint cells
+        struct Grid
+        {
+            const std::vector<Vector3d>& points;
+            const std::vector<Vector3i>& cellOf;
+            double epsilon;
+            double cellSize;
+            std::vector<CellTable> tables;
+
+            //! Will return the smallest index j < i, with points[j] similar to points[i] and `accept(j)`. Returns i if there is none
+            template <typename Accept>
+            std::size_t FirstSimilar(std::size_t i, Accept accept) const
+            {
+                const std::hash<Vector3i> hash;
+                std::size_t first = i;
+
+                // Cells are twice as large as epsilon, so similar points lie in at most two cells per axis, usually.
+                // The range gets widened a little, so that rounding can't make it miss any point Similar() accepts
+                const Vector3i low = VoxelGridFilter::VoxelOf(points[i] - Vector3d(1, 1, 1) * (epsilon * 1.01), cellSize);
+                const Vector3i high = VoxelGridFilter::VoxelOf(points[i] + Vector3d(1, 1, 1) * (epsilon * 1.01), cellSize);
+
+                for (int x = low.x; x <= high.x; x++)
+                    for (int y = low.y; y <= high.y; y++)
+                        for (int z = low.z; z <= high.z; z++)
+                        {
+                            const Vector3i cell(x, y, z);
+                            const std::size_t h = hash(cell);
+                            const CellTable& table = tables[PartitionOf(h, tables.size())];
+
+                            const CellTable::Slot* slot = table.Find(cell, h);
+                            if (slot == nullptr)
+                                continue;
+
+                            // Members are ascending, so the first match is the smallest in this cell
+                            for (std::size_t k = slot->begin; k < slot->begin + slot->count; k++)
+                            {
+                                const std::size_t j = table.members[k];
+                                if (j >= first)
+                                    break;
+
+                                if (accept(j) && points[j].Similar(points[i], epsilon))
+                                {
+                                    first = j;
+                                    break;
+                                }
+                            }
+                        }
+
+                return first;
+            }
+        };
+    }
+
+    void VertexWelder::Weld(
+        const std::vector<Vector3d>& points,
+        double epsilon,
+        std::vector<std::size_t>& remap,
+        std::vector<Vector3d>& welded,
+        std::size_t threadCount)
+    {
+        if (!(epsilon > 0))
+            throw std::invalid_argument("The epsilon has to be positive!");
+
+        const std::size_t chunks = Parallel::ChunkCount(points.size(), threadCount, MIN_POINTS_PER_THREAD);
+        const std::size_t chunkSize = (points.size() + chunks - 1) / chunks;
+        const std::size_t partitions = chunks;
+
+        const double cellSize = epsilon * 2;
+        std::vector<Vector3i> cellOf(points.size());
+        std::vector<std::size_t> hashOf(points.size());
+
+        // Indexed [chunk][partition]
+        std::vector<std::vector<std::vector<std::size_t>>> buckets(chunks, std::vector<std::vector<std::size_t>>(partitions));
+
+        Parallel::For(chunks, chunks, 1, [&](std::size_t beginChunk, std::size_t endChunk) {
+            const std::hash<Vector3i> hash;
+
+            for (std::size_t c = beginChunk; c < endChunk; c++)
+                for (std::size_t i = c * chunkSize; i < std::min((c + 1) * chunkSize, points.size()); i++)
+                {
+                    cellOf[i] = VoxelGridFilter::VoxelOf(points[i], cellSize);
+                    hashOf[i] = hash(cellOf[i]);
+                    buckets[c][PartitionOf(hashOf[i], partitions)].push_back(i);
+                }
+        });
+
+        // Each partition gets its own table. Concatenating the chunks in order keeps the indices ascending
+        Grid grid { points, cellOf, epsilon, cellSize, std::vector<CellTable>(partitions) };
+
+        Parallel::For(partitions, partitions, 1, [&](std::size_t beginPartition, std::size_t endPartition) {
+            for (std::size_t p = beginPartition; p < endPartition; p++)
+            {
+                std::vector<std::size_t> indices;
+                for (std::size_t c = 0; c < chunks; c++)
+                {
+                    indices.insert(indices.end(), buckets[c][p].begin(), buckets[c][p].end());
+                    buckets[c][p] = std::vector<std::size_t>();
+                }
+
+                grid.tables[p].Build(indices, cellOf, hashOf);
+            }
+        });
+
+        // The bulk of the work: find the first earlier point similar to each point
+        std::vector<std::size_t> firstSimilar(points.size());
+
+        Parallel::For(points.size(), chunks, MIN_POINTS_PER_THREAD, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++)
+                firstSimilar[i] = grid.FirstSimilar(i, [](std::size_t) { return true; });
+        });
+
+        // Which points start a welded vertex depends on all points before them, so this pass is sequential.
+        // If the first similar point started a welded vertex, no earlier one did. Otherwise, the grid has to be searched again.
+        std::vector<std::size_t> firstPoints;
+        remap.resize(points.size());
+        welded.clear();
+
+        const auto startsWeldedVertex = [&](std::size_t j) { return firstPoints[remap[j]] == j; };
+
+        for (std::size_t i = 0; i < points.size(); i++)
+        {
+            std::size_t j = firstSimilar[i];
+            if ((j != i) && !startsWeldedVertex(j))
+                j = grid.FirstSimilar(i, startsWeldedVertex);
+
+            if (j == i)
+            {
+                remap[i] = welded.size();
+                welded.push_back(points[i]);
+                firstPoints.push_back(i);
+            }
+            else
+                remap[i] = remap[j];
+        }
+
+        return;
+    }
+}
@@ -0,0 +1,166 @@
+#include "Eule/VoxelGridFilter.h"
+#include "Eule/Parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+
+namespace Leonetienne::Eule {
+
+    namespace {
+        //! A flat hash table, summing up the points of each voxel
+        struct VoxelTable
+        {
+            std::vector<Vector3i> voxels;
+            std::vector<Vector3d> sums;
+            // Zero marks an empty slot
+            std::vector<std::size_t> counts;
+            std::size_t occupied = 0;
+
+            //! Will add `count` points summing up to `sum` to a voxel
+            void Add(const Vector3i& voxel, std::size_t hash, const Vector3d& sum, std::size_t count)
+            {
+                // Keep the load factor at or below one half
+                if ((occupied + 1) * 2 > counts.size())
+                    Grow();
+
+                const std::size_t mask = counts.size() - 1;
+                std::size_t i = hash & mask;
+                while ((counts[i] != 0) && (voxels[i] != voxel))
+                    i = (i + 1) & mask;
+
+                if (counts[i] == 0)
+                {
+                    voxels[i] = voxel;
+                    occupied++;
+                }
+
+                sums[i] += sum;
+                counts[i] += count;
+
+                return;
+            }
+
+            //! Will double the capacity, and re-insert all occupied slots
+            void Grow()
+            {
+                VoxelTable grown;
+                const std::size_t capacity = std::max<std::size_t>(counts.size() * 2, 64);
+                grown.voxels.resize(capacity);
+                grown.sums.resize(capacity);
+                grown.counts.resize(capacity, 0);
+
+                const std::hash<Vector3i> hash;
+                for (std::size_t i = 0; i < counts.size(); i++)
+                    if (counts[i] != 0)
+                        grown.Add(voxels[i], hash(voxels[i]), sums[i], counts[i]);
+
+                *this = std::move(grown);
+
+                return;
+            }
+        };
+
+        //! Which partition a voxel belongs to. Uses the upper bits of the hash, as the tables index by the lower ones
+        inline std::size_t PartitionOf(std::size_t hash, std::size_t partitions)
+        {
+            return (std::size_t)(((std::uint64_t)hash >> 40) % partitions);
+        }
+
+        inline bool VoxelLess(const Vector3i& a, const Vector3i& b)
+        {
+            if (a.x != b.x) return a.x < b.x;
+            if (a.y != b.y) return a.y < b.y;
+            return a.z < b.z;
+        }
+    }
+
+    void VoxelGridFilter::Downsample(
+        const std::vector<Vector3d>& points,
+        double voxelSize,
+        std::vector<Vector3d>& centroids,
+        std::size_t threadCount)
+    {
+        std::vector<Vector3i> voxels;
+        Downsample(points, voxelSize, centroids, voxels, threadCount);
+
+        return;
+    }
+
+    void VoxelGridFilter::Downsample(
+        const std::vector<Vector3d>& points,
+        double voxelSize,
+        std::vector<Vector3d>& centroids,
+        std::vector<Vector3i>& voxels,
+        std::size_t threadCount)
+    {
+        if (!(voxelSize > 0))
+            throw std::invalid_argument("The voxel size has to be positive!");
+
+        const std::size_t chunks = Parallel::ChunkCount(points.size(), threadCount, MIN_POINTS_PER_THREAD);
+        const std::size_t chunkSize = (points.size() + chunks - 1) / chunks;
+        const std::size_t partitions = chunks;
+
+        // Indexed [chunk][partition]
+        std::vector<std::vector<VoxelTable>> local(chunks, std::vector<VoxelTable>(partitions));
+
+        Parallel::For(chunks, chunks, 1, [&](std::size_t beginChunk, std::size_t endChunk) {
+            const std::hash<Vector3i> hash;
+
+            for (std::size_t c = beginChunk; c < endChunk; c++)
+                for (std::size_t i = c * chunkSize; i < std::min((c + 1) * chunkSize, points.size()); i++)
+                {
+                    const Vector3i voxel = VoxelOf(points[i], voxelSize);
+                    const std::size_t h = hash(voxel);
+                    local[c][PartitionOf(h, partitions)].Add(voxel, h, points[i], 1);
+                }
+        });
+
+        // Merge each partition of all chunks into the first chunk's table. Partitions hold disjoint voxels, so they merge independently
+        Parallel::For(partitions, partitions, 1, [&](std::size_t beginPartition, std::size_t endPartition) {
+            const std::hash<Vector3i> hash;
+
+            for (std::size_t p = beginPartition; p < endPartition; p++)
+                for (std::size_t c = 1; c < chunks; c++)
+                {
+                    VoxelTable& table = local[c][p];
+                    for (std::size_t i = 0; i < table.counts.size(); i++)
+                        if (table.counts[i] != 0)
+                            local[0][p].Add(table.voxels[i], hash(table.voxels[i]), table.sums[i], table.counts[i]);
+
+                    table = VoxelTable();
+                }
+        });
+
+        // Collect the occupied voxels, and order them
+        std::vector<std::pair<std::size_t, std::size_t>> slots;
+        for (std::size_t p = 0; p < partitions; p++)
+            for (std::size_t i = 0; i < local[0][p].counts.size(); i++)
+                if (local[0][p].counts[i] != 0)
+                    slots.emplace_back(p, i);
+
+        std::sort(slots.begin(), slots.end(), [&](const std::pair<std::size_t, std::size_t>& a, const std::pair<std::size_t, std::size_t>& b) {
+            return VoxelLess(local[0][a.first].voxels[a.second], local[0][b.first].voxels[b.second]);
+        });
+
+        centroids.resize(slots.size());
+        voxels.resize(slots.size());
+        for (std::size_t i = 0; i < slots.size(); i++)
+        {
+            const VoxelTable& table = local[0][slots[i].first];
+            voxels[i] = table.voxels[slots[i].second];
+            centroids[i] = table.sums[slots[i].second] / (double)table.counts[slots[i].second];
+        }
+
+        return;
+    }
+
+    Vector3i VoxelGridFilter::VoxelOf(const Vector3d& point, double voxelSize)
+    {
+        return Vector3i(
+            (int)std::floor(point.x / voxelSize),
+            (int)std::floor(point.y / voxelSize),
+            (int)std::floor(point.z / voxelSize)
+        );
+    }
+}
@@ -0,0 +1,81 @@
+#include "Eule/VoxelRay.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace Leonetienne::Eule {
+
+    VoxelRay::VoxelRay(const Vector3d& origin, const Vector3d& direction, double voxelSize, const Vector3d& gridOrigin)
+    {
+        if (!(voxelSize > 0))
+            throw std::invalid_argument("The voxel size has to be positive!");
+
+        if ((direction.x == 0) && (direction.y == 0) && (direction.z == 0))
+            throw std::invalid_argument("The direction must not be zero!");
+
+        for (std::size_t i = 0; i < 3; i++)
+        {
+            voxel[i] = (int)std::floor((origin[i] - gridOrigin[i]) / voxelSize);
+
+            if (direction[i] > 0)
+            {
+                step[i] = 1;
+                tMax[i] = (gridOrigin[i] + (voxel[i] + 1) * voxelSize - origin[i]) / direction[i];
+                tDelta[i] = voxelSize / direction[i];
+            }
+            else if (direction[i] < 0)
+            {
+                step[i] = -1;
+                tMax[i] = (gridOrigin[i] + voxel[i] * voxelSize - origin[i]) / direction[i];
+                tDelta[i] = -voxelSize / direction[i];
+            }
+            else
+            {
+                // Never crosses a boundary along this axis
+                step[i] = 0;
+                tMax[i] = std::numeric_limits<double>::infinity();
+                tDelta[i] = std::numeric_limits<double>::infinity();
+            }
+        }
+
+        return;
+    }
+
+    void VoxelRay::Step()
+    {
+        // Cross whichever boundary comes first
+        std::size_t axis;
+        if (tMax.x < tMax.y)
+            axis = (tMax.x < tMax.z) ? 0 : 2;
+        else
+            axis = (tMax.y < tMax.z) ? 1 : 2;
+
+        entryT = tMax[axis];
+        entryAxis = axis;
+        voxel[axis] += step[axis];
+        tMax[axis] += tDelta[axis];
+
+        return;
+    }
+
+    const Vector3i& VoxelRay::GetVoxel() const
+    {
+        return voxel;
+    }
+
+    double VoxelRay::GetEntryT() const
+    {
+        return entryT;
+    }
+
+    double VoxelRay::GetExitT() const
+    {
+        return std::min(tMax.x, std::min(tMax.y, tMax.z));
+    }
+
+    std::size_t VoxelRay::GetEntryAxis() const
+    {
+        return entryAxis;
+    }
+}
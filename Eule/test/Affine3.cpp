@@ -0,0 +1,123 @@
+#include "Catch2.h"
+#include <Eule/Affine3.h>
+#include <Eule/Quaternion.h>
+#include "TestingUtilities/Fixtures.h"
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+}
+
+// Tests that a new transformation is the identity, and that it is smaller than a matrix
+TEST_CASE(__FILE__"/Default_Is_Identity", "[Affine3]")
+{
+    const Affine3 identity;
+    REQUIRE(identity.ToMatrix4x4() == Matrix4x4());
+
+    REQUIRE(sizeof(Affine3) == 12 * sizeof(double));
+    REQUIRE(alignof(Affine3) == 32);
+    REQUIRE(sizeof(Affine3) < sizeof(Matrix4x4));
+
+    return;
+}
+
+// Tests that converting to and from Matrix4x4 loses nothing
+TEST_CASE(__FILE__"/Matrix4x4_Round_Trip", "[Affine3]")
+{
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        const Matrix4x4 m = RandomAffineMatrix(rng, 10);
+        const Affine3 affine(m);
+
+        for (std::size_t y = 0; y < 3; y++)
+            for (std::size_t x = 0; x < 4; x++)
+                REQUIRE(affine[y][x] == m[y][x]);
+
+        REQUIRE(affine.ToMatrix4x4() == m);
+        REQUIRE(affine.GetTranslationComponent() == m.GetTranslationComponent());
+    }
+
+    return;
+}
+
+// Tests that composing transformations behaves exactly like Matrix4x4::operator*
+TEST_CASE(__FILE__"/Compose_Matches_Matrix4x4", "[Affine3]")
+{
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const Matrix4x4 a = RandomAffineMatrix(rng, 10);
+        const Matrix4x4 b = RandomAffineMatrix(rng, 10);
+
+        REQUIRE((Affine3(a) * Affine3(b)).Similar(Affine3(a * b), 1e-9));
+
+        Affine3 c(a);
+        c *= Affine3(b);
+        REQUIRE(c == Affine3(a) * Affine3(b));
+    }
+
+    return;
+}
+
+// Tests that inverting behaves exactly like Matrix4x4::Inverse3x3()
+TEST_CASE(__FILE__"/Inverse_Matches_Matrix4x4", "[Affine3]")
+{
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const Matrix4x4 m = RandomAffineMatrix(rng, 10);
+        const Affine3 affine(m);
+
+        REQUIRE(affine.Determinant3x3() == Approx(m.Determinant(3)).margin(1e-9));
+
+        // Nearly singular matrices have huge inverses, which round too much for a fixed epsilon
+        if (std::abs(affine.Determinant3x3()) < 1)
+            continue;
+
+        REQUIRE(affine.IsInversible3x3());
+        REQUIRE(affine.Inverse3x3().Similar(Affine3(m.Inverse3x3()), 1e-9));
+
+        // The 3x3 components cancel out
+        const Affine3 product = affine * affine.Inverse3x3();
+        for (std::size_t y = 0; y < 3; y++)
+            for (std::size_t x = 0; x < 3; x++)
+                REQUIRE(product[y][x] == Approx(double(x == y)).margin(1e-9));
+    }
+
+    // Singular
+    Affine3 flat;
+    flat[2][2] = 0;
+    REQUIRE_FALSE(flat.IsInversible3x3());
+    REQUIRE_THROWS_AS(flat.Inverse3x3(), std::runtime_error);
+
+    return;
+}
+
+// Tests that transforming points matches multiplying them with a Matrix4x4, one by one and batched
+TEST_CASE(__FILE__"/Transform_Points", "[Affine3]")
+{
+    Matrix4x4 m = RandomRotation(rng).ToRotationMatrix();
+    m.SetTranslationComponent(Vector3d(RandomDouble(rng, 10), RandomDouble(rng, 10), RandomDouble(rng, 10)));
+    const Affine3 affine(m);
+
+    // Not a multiple of four, to cover the tail
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 103; i++)
+        points.push_back(Vector3d(RandomDouble(rng, 100), RandomDouble(rng, 100), RandomDouble(rng, 100)));
+
+    std::vector<Vector3d> transformed;
+    affine.TransformPoints(points, transformed);
+    REQUIRE(transformed.size() == points.size());
+
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        const Vector3d expected = points[i] * m;
+        REQUIRE(affine.TransformPoint(points[i]).Similar(expected, 1e-9));
+        REQUIRE(transformed[i].Similar(expected, 1e-9));
+    }
+
+    return;
+}
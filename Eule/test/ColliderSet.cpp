@@ -0,0 +1,192 @@
+#include "Catch2.h"
+#include <Eule/ColliderSet.h>
+#include <Eule/Quaternion.h>
+#include "TestingUtilities/HandyMacros.h"
+#include "TestingUtilities/Fixtures.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+using TPC = TrapazoidalPrismCollider;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+
+    // A collider type the set does not know about
+    class SphereCollider : public Collider
+    {
+    public:
+        SphereCollider(const Vector3d& center, double radius) : center(center), radius(radius) {}
+
+        bool Contains(const Vector3d& point) const override
+        {
+            return (point - center).SqrMagnitude() <= radius * radius;
+        }
+
+        Vector3d center;
+        double radius;
+    };
+
+    // Creates a frustum that is an axis-aligned box with a given center and half-size
+    Frustum MakeFrustum(const Vector3d& center, double halfSize)
+    {
+        // Maps the box onto [-1, 1]^3
+        Matrix4x4 m;
+        m[0][0] = m[1][1] = m[2][2] = 1.0 / halfSize;
+        m.SetTranslationComponent(-center / halfSize);
+
+        return Frustum(m);
+    }
+}
+
+// Tests that the batched static Contains() equals calling Contains() on each collider
+TEST_CASE(__FILE__"/Prism_Batch_Contains", "[ColliderSet][TrapazoidalPrismCollider][Collider]")
+{
+    std::vector<TPC> colliders;
+    for (std::size_t i = 0; i < 203; i++)
+        colliders.push_back(MakeBox(RandomVector(rng, 20), 10, RandomRotation(rng)));
+
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        const Vector3d point = RandomVector(rng, 30);
+
+        std::vector<std::size_t> expected;
+        for (std::size_t j = 0; j < colliders.size(); j++)
+            if (colliders[j].Contains(point))
+                expected.push_back(j);
+
+        std::vector<std::size_t> actual;
+        TPC::Contains(colliders, point, actual);
+
+        REQUIRE(actual == expected);
+    }
+
+    return;
+}
+
+// Tests that a set with mixed collider types finds the same colliders as querying them one by one
+TEST_CASE(__FILE__"/Find_Containing_Equals_Brute_Force", "[ColliderSet]")
+{
+    std::vector<SphereCollider> spheres;
+    for (std::size_t i = 0; i < 50; i++)
+        spheres.emplace_back(RandomVector(rng, 20), 8);
+
+    ColliderSet set;
+    std::vector<const Collider*> all; // Indexed by handle
+    std::vector<TPC> prisms;
+    std::vector<Frustum> frustums;
+    prisms.reserve(100);
+    frustums.reserve(100);
+
+    // Interleave all types, so that handles and group indices differ
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        prisms.push_back(MakeBox(RandomVector(rng, 20), 10, RandomRotation(rng)));
+        REQUIRE(set.Add(prisms.back()) == all.size());
+        all.push_back(&prisms.back());
+
+        frustums.push_back(MakeFrustum(RandomVector(rng, 20), 7));
+        REQUIRE(set.Add(frustums.back()) == all.size());
+        all.push_back(&frustums.back());
+
+        if (i < spheres.size())
+        {
+            REQUIRE(set.Add(&spheres[i]) == all.size());
+            all.push_back(&spheres[i]);
+        }
+    }
+
+    REQUIRE(set.Size() == all.size());
+
+    for (std::size_t i = 0; i < 200; i++)
+    {
+        const Vector3d point = RandomVector(rng, 30);
+
+        std::vector<std::size_t> expected;
+        for (std::size_t j = 0; j < all.size(); j++)
+            if (all[j]->Contains(point))
+                expected.push_back(j);
+
+        std::vector<std::size_t> actual = set.FindContaining(point);
+        std::sort(actual.begin(), actual.end());
+
+        REQUIRE(actual == expected);
+        REQUIRE(set.AnyContains(point) == !expected.empty());
+
+        // Same thing, as bitset
+        std::vector<std::uint64_t> bits;
+        set.FindContainingMask(point, bits);
+        REQUIRE(bits.size() == (all.size() + 63) / 64);
+
+        std::vector<std::size_t> fromBits;
+        for (std::size_t j = 0; j < all.size(); j++)
+            if (bits[j / 64] & (std::uint64_t(1) << (j % 64)))
+                fromBits.push_back(j);
+
+        REQUIRE(fromBits == expected);
+    }
+
+    return;
+}
+
+// Tests that a set of prisms only (not filling the last block) equals querying them one by one
+TEST_CASE(__FILE__"/Prism_Blocks_Equal_Brute_Force", "[ColliderSet][TrapazoidalPrismCollider]")
+{
+    for (std::size_t count = 1; count < 11; count++)
+    {
+        ColliderSet set;
+        std::vector<TPC> prisms;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            prisms.push_back(MakeBox(RandomVector(rng, 5), 10, RandomRotation(rng)));
+            set.Add(prisms.back());
+        }
+
+        for (std::size_t i = 0; i < 100; i++)
+        {
+            const Vector3d point = RandomVector(rng, 20);
+
+            std::vector<std::size_t> expected;
+            for (std::size_t j = 0; j < prisms.size(); j++)
+                if (prisms[j].Contains(point))
+                    expected.push_back(j);
+
+            REQUIRE(set.FindContaining(point) == expected);
+        }
+    }
+
+    return;
+}
+
+// Tests that FindContaining() appends, instead of overwriting
+TEST_CASE(__FILE__"/Find_Containing_Appends", "[ColliderSet]")
+{
+    ColliderSet set;
+    set.Add(MakeBox(Vector3d(0, 0, 0), 10, Quaternion()));
+
+    std::vector<std::size_t> out = { 99 };
+    set.FindContaining(Vector3d(0, 0, 0), out);
+
+    REQUIRE(out == std::vector<std::size_t>({ 99, 0 }));
+
+    return;
+}
+
+// Tests that clearing a set empties it, and resets the handles
+TEST_CASE(__FILE__"/Clear", "[ColliderSet]")
+{
+    ColliderSet set;
+    set.Add(MakeBox(Vector3d(0, 0, 0), 10, Quaternion()));
+    set.Add(MakeFrustum(Vector3d(0, 0, 0), 10));
+
+    set.Clear();
+    REQUIRE(set.Size() == 0);
+    REQUIRE_FALSE(set.AnyContains(Vector3d(0, 0, 0)));
+    REQUIRE(set.FindContaining(Vector3d(0, 0, 0)).empty());
+
+    REQUIRE(set.Add(MakeFrustum(Vector3d(0, 0, 0), 10)) == 0);
+
+    return;
+}
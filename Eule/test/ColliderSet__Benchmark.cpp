@@ -0,0 +1,84 @@
+#include "Catch2.h"
+#include <Eule/ColliderSet.h>
+#include <Eule/Quaternion.h>
+#include "TestingUtilities/Fixtures.h"
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+using TPC = TrapazoidalPrismCollider;
+
+/*
+    Benchmarks are hidden by default. Run them with:
+    ./Eule_tests "[benchmark]"
+*/
+
+namespace {
+    static std::mt19937 rng = std::mt19937(1337);
+}
+
+// Compares querying prisms through Collider pointers, through the static batch call on the colliders themselves,
+// and through a ColliderSet (which stores their planes as structure-of-arrays)
+TEST_CASE(__FILE__"/Virtual_vs_Devirtualized_Contains", "[.][benchmark][ColliderSet]")
+{
+    constexpr std::size_t numColliders = 4096;
+    constexpr std::size_t numPoints = 64;
+
+    std::vector<std::unique_ptr<Collider>> owned;
+    std::vector<const Collider*> pointers;
+    std::vector<TPC> prisms;
+    ColliderSet set;
+
+    for (std::size_t i = 0; i < numColliders; i++)
+    {
+        const TPC tpc = MakeBox(RandomVector(rng, 100), 10, RandomRotation(rng));
+
+        owned.emplace_back(new TPC(tpc));
+        pointers.push_back(owned.back().get());
+        prisms.push_back(tpc);
+        set.Add(tpc);
+    }
+
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < numPoints; i++)
+        points.push_back(RandomVector(rng, 100));
+
+    std::vector<std::size_t> out;
+    out.reserve(numColliders);
+
+    BENCHMARK("Virtual Collider::Contains()")
+    {
+        std::size_t found = 0;
+        for (const Vector3d& p : points)
+            for (const Collider* c : pointers)
+                found += c->Contains(p);
+        return found;
+    };
+
+    BENCHMARK("Static TrapazoidalPrismCollider::Contains() batch")
+    {
+        std::size_t found = 0;
+        for (const Vector3d& p : points)
+        {
+            out.clear();
+            TPC::Contains(prisms, p, out);
+            found += out.size();
+        }
+        return found;
+    };
+
+    BENCHMARK("ColliderSet::FindContaining()")
+    {
+        std::size_t found = 0;
+        for (const Vector3d& p : points)
+        {
+            out.clear();
+            set.FindContaining(p, out);
+            found += out.size();
+        }
+        return found;
+    };
+
+    return;
+}
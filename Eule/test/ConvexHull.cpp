@@ -0,0 +1,191 @@
+#include "Catch2.h"
+#include <Eule/ConvexHull.h>
+#include "TestingUtilities/Fixtures.h"
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+
+    // Points within a ball, so that most of them end up inside the hull
+    std::vector<Vector3d> RandomBall(std::size_t count, double radius)
+    {
+        std::vector<Vector3d> points;
+        while (points.size() < count)
+        {
+            const Vector3d p = RandomVector(rng, radius);
+            if (p.x * p.x + p.y * p.y + p.z * p.z <= radius * radius)
+                points.push_back(p);
+        }
+
+        return points;
+    }
+
+    // Tests that the hull is a closed, consistently oriented mesh, with all points behind each of its triangles
+    void CheckHull(const ConvexHull& hull, const std::vector<Vector3d>& points)
+    {
+        const std::vector<Vector3d>& vertices = hull.GetVertices();
+        const auto& triangles = hull.GetTriangles();
+
+        // Euler characteristic of a closed triangle mesh of genus 0
+        REQUIRE(triangles.size() == 2 * vertices.size() - 4);
+
+        // Each directed edge appears exactly once, and so does its opposite
+        std::map<std::pair<std::size_t, std::size_t>, std::size_t> directedEdges;
+        for (const auto& triangle : triangles)
+            for (std::size_t k = 0; k < 3; k++)
+                directedEdges[{ triangle[k], triangle[(k + 1) % 3] }]++;
+
+        for (const auto& edge : directedEdges)
+        {
+            REQUIRE(edge.second == 1);
+            REQUIRE(directedEdges.count({ edge.first.second, edge.first.first }) == 1);
+        }
+
+        for (std::size_t i = 0; i < vertices.size(); i++)
+            REQUIRE(vertices[i] == points[hull.GetSourceIndices()[i]]);
+
+        for (const auto& triangle : triangles)
+        {
+            const Vector3d& a = vertices[triangle[0]];
+            Vector3d normal = (vertices[triangle[1]] - a).CrossProduct(vertices[triangle[2]] - a);
+            normal = normal / std::sqrt(normal.DotProduct(normal));
+
+            for (const Vector3d& p : points)
+                REQUIRE(normal.DotProduct(p - a) <= 1e-9);
+        }
+
+        return;
+    }
+}
+
+// Tests that point sets without volume throw
+TEST_CASE(__FILE__"/Degenerate", "[ConvexHull]")
+{
+    REQUIRE_THROWS_AS(ConvexHull(std::vector<Vector3d>(3, Vector3d(1, 2, 3))), std::invalid_argument);
+    REQUIRE_THROWS_AS(ConvexHull(std::vector<Vector3d>(10, Vector3d(1, 2, 3))), std::invalid_argument);
+
+    // Collinear
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 10; i++)
+        points.push_back(Vector3d(1, 2, 3) * (double)i);
+    REQUIRE_THROWS_AS(ConvexHull(points), std::invalid_argument);
+
+    // Coplanar
+    points.clear();
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        const Vector3d p = RandomVector(rng, 10);
+        points.push_back(Vector3d(p.x, p.y, 2 * p.x - p.y));
+    }
+    REQUIRE_THROWS_AS(ConvexHull(points), std::invalid_argument);
+
+    return;
+}
+
+// Tests the hull of a cube, with points inside and on its faces
+TEST_CASE(__FILE__"/Cube", "[ConvexHull]")
+{
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 1000; i++)
+        points.push_back(RandomVector(rng, 0.99));
+
+    // Points on the faces. As coplanar faces don't get merged, these may become vertices
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        Vector3d p = RandomVector(rng, 0.9);
+        p[i % 3] = (i % 2) ? 1 : -1;
+        points.push_back(p);
+    }
+
+    for (std::size_t i = 0; i < 8; i++)
+        points.push_back(Vector3d((i & 1) ? 1 : -1, (i & 2) ? 1 : -1, (i & 4) ? 1 : -1));
+
+    const ConvexHull hull(points);
+
+    CheckHull(hull, points);
+
+    // All corners are vertices, and all vertices lie on the surface
+    for (std::size_t i = 0; i < 8; i++)
+        REQUIRE(std::find(hull.GetVertices().begin(), hull.GetVertices().end(), points[points.size() - 8 + i]) != hull.GetVertices().end());
+
+    for (const Vector3d& v : hull.GetVertices())
+        REQUIRE(std::max(std::abs(v.x), std::max(std::abs(v.y), std::abs(v.z))) == 1);
+
+    // Without the points on the faces, only the corners remain
+    const std::vector<Vector3d> corners(points.end() - 8, points.end());
+    std::vector<Vector3d> inner(points.begin(), points.begin() + 1000);
+    inner.insert(inner.end(), corners.begin(), corners.end());
+
+    const ConvexHull cornerHull(inner);
+    REQUIRE(cornerHull.GetVertices().size() == 8);
+    REQUIRE(cornerHull.GetTriangles().size() == 12);
+    CheckHull(cornerHull, inner);
+
+    return;
+}
+
+// Tests the hulls of random point clouds
+TEST_CASE(__FILE__"/Random_Ball", "[ConvexHull]")
+{
+    for (std::size_t count : { 4, 5, 20, 1000 })
+    {
+        const std::vector<Vector3d> points = RandomBall(count, 10);
+
+        // Four random points may happen to be coplanar
+        if (count == 4)
+        {
+            const Vector3d normal = (points[1] - points[0]).CrossProduct(points[2] - points[0]);
+            if (std::abs(normal.DotProduct(points[3] - points[0])) < 1e-6)
+                continue;
+        }
+
+        const ConvexHull hull(points);
+        CheckHull(hull, points);
+    }
+
+    return;
+}
+
+// Tests that all points of a sphere's surface end up as vertices
+TEST_CASE(__FILE__"/Sphere_Surface", "[ConvexHull]")
+{
+    std::vector<Vector3d> points;
+    for (const Vector3d& p : RandomBall(2000, 1))
+    {
+        const double length = std::sqrt(p.DotProduct(p));
+        if (length > 0.1)
+            points.push_back(p / length * 5.0);
+    }
+
+    const ConvexHull hull(points);
+
+    REQUIRE(hull.GetVertices().size() == points.size());
+    CheckHull(hull, points);
+
+    return;
+}
+
+// Tests that the hull does not depend on the amount of threads
+TEST_CASE(__FILE__"/Deterministic_Across_Threads", "[ConvexHull]")
+{
+    const std::vector<Vector3d> points = RandomBall(100000, 100);
+
+    const ConvexHull hull(points, 1);
+
+    for (std::size_t threads : { 2, 4 })
+    {
+        const ConvexHull other(points, threads);
+        REQUIRE(other.GetSourceIndices() == hull.GetSourceIndices());
+        REQUIRE(other.GetTriangles() == hull.GetTriangles());
+    }
+
+    return;
+}
@@ -0,0 +1,195 @@
+#include "Catch2.h"
+#include <Eule/ConvexPolyhedronCollider.h>
+#include <Eule/OBB.h>
+#include <Eule/Frustum.h>
+#include <Eule/Quaternion.h>
+#include "TestingUtilities/Fixtures.h"
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+}
+
+// Tests the default cube
+TEST_CASE(__FILE__"/Default_Cube", "[ConvexPolyhedronCollider]")
+{
+    const ConvexPolyhedronCollider cube;
+
+    REQUIRE(cube.GetPlaneCount() == 6);
+    REQUIRE(cube.GetVertices().size() == 8);
+
+    REQUIRE(cube.Contains(Vector3d(0, 0, 0)));
+    REQUIRE(cube.Contains(Vector3d(1, -1, 1)));
+    REQUIRE(cube.Contains(Vector3d(0.99, 0.5, -0.99)));
+    REQUIRE_FALSE(cube.Contains(Vector3d(1.01, 0, 0)));
+    REQUIRE_FALSE(cube.Contains(Vector3d(0, -1.01, 0)));
+
+    REQUIRE(cube.SupportPoint(Vector3d(1, -2, 0.5)) == Vector3d(1, -1, 1));
+
+    return;
+}
+
+// Tests that the hull of a box's corners contains the same points as the box
+TEST_CASE(__FILE__"/Hull_Of_Box", "[ConvexPolyhedronCollider]")
+{
+    for (std::size_t i = 0; i < 20; i++)
+    {
+        const OBB box(RandomVector(rng, 10), Vector3d(1, 2, 3), RandomRotation(rng).ToRotationMatrix());
+
+        std::vector<Vector3d> corners;
+        for (std::size_t j = 0; j < 8; j++)
+            corners.push_back(box.GetCorner(j));
+
+        const ConvexPolyhedronCollider polyhedron(corners);
+        REQUIRE(polyhedron.GetPlaneCount() == 12);
+
+        for (std::size_t j = 0; j < 1000; j++)
+        {
+            const Vector3d point = box.GetCenter() + RandomVector(rng, 4);
+
+            // Skip points right on the surface, which may round either way
+            if (std::abs(box.SignedDistance(point)) < 1e-9)
+                continue;
+
+            REQUIRE(polyhedron.Contains(point) == box.Contains(point));
+        }
+    }
+
+    return;
+}
+
+// Tests the planes and support points of the hull of a point cloud
+TEST_CASE(__FILE__"/Hull_Of_Points", "[ConvexPolyhedronCollider]")
+{
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 2000; i++)
+        points.push_back(RandomVector(rng, 5));
+
+    const ConvexPolyhedronCollider polyhedron(points);
+
+    for (std::size_t i = 0; i < polyhedron.GetPlaneCount(); i++)
+    {
+        const Vector3d normal = polyhedron.GetPlaneNormal(i);
+        REQUIRE(normal.DotProduct(normal) == Approx(1));
+
+        // All points lie on the inner side, up to rounding
+        for (const Vector3d& p : points)
+            REQUIRE(normal.DotProduct(p) + polyhedron.GetPlaneOffset(i) >= -polyhedron.GetTolerance());
+    }
+
+    // Including its own vertices
+    for (const Vector3d& p : points)
+        REQUIRE(polyhedron.Contains(p));
+
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        const Vector3d direction = RandomVector(rng, 1);
+
+        double furthest = -INFINITY;
+        for (const Vector3d& p : points)
+            furthest = std::max(furthest, p.DotProduct(direction));
+
+        REQUIRE(polyhedron.SupportPoint(direction).DotProduct(direction) == furthest);
+    }
+
+    // The centroid lies inside, points far away don't
+    REQUIRE(polyhedron.Contains(Vector3d(0, 0, 0)));
+    REQUIRE_FALSE(polyhedron.Contains(Vector3d(5.1, 0, 0)));
+
+    return;
+}
+
+// Tests that the hull of a rotated lattice contains all of its points, even though many of them lie exactly on its faces
+TEST_CASE(__FILE__"/Hull_Of_Lattice_Contains_Its_Points", "[ConvexPolyhedronCollider]")
+{
+    for (std::size_t i = 0; i < 20; i++)
+    {
+        const Quaternion rotation = RandomRotation(rng);
+        const Vector3d offset = RandomVector(rng, 100);
+
+        std::vector<Vector3d> points;
+        for (std::size_t x = 0; x < 8; x++)
+            for (std::size_t y = 0; y < 8; y++)
+                for (std::size_t z = 0; z < 8; z++)
+                    points.push_back(rotation * Vector3d((double)x, (double)y, (double)z) + offset);
+
+        const ConvexPolyhedronCollider polyhedron(points);
+        REQUIRE(polyhedron.GetTolerance() > 0);
+
+        for (const Vector3d& p : points)
+            REQUIRE(polyhedron.Contains(p));
+
+        // Beyond the corners
+        REQUIRE_FALSE(polyhedron.Contains(rotation * Vector3d(-0.1, -0.1, -0.1) + offset));
+        REQUIRE_FALSE(polyhedron.Contains(rotation * Vector3d(7.1, 7.1, 7.1) + offset));
+    }
+
+    return;
+}
+
+// Tests that polyhedra built from boxes and their prisms contain the same points as the boxes
+TEST_CASE(__FILE__"/From_OBB_And_Prism", "[ConvexPolyhedronCollider]")
+{
+    for (std::size_t i = 0; i < 20; i++)
+    {
+        const OBB box(RandomVector(rng, 10), Vector3d(1, 2, 3), RandomRotation(rng).ToRotationMatrix());
+        const ConvexPolyhedronCollider fromBox(box);
+        const ConvexPolyhedronCollider fromPrism(box.ToPrism());
+
+        REQUIRE(fromBox.GetPlaneCount() == 6);
+        REQUIRE(fromPrism.GetPlaneCount() == 6);
+        REQUIRE(fromBox.GetVertices().size() == 8);
+
+        for (std::size_t j = 0; j < 6; j++)
+            REQUIRE(fromPrism.GetPlaneNormal(j).DotProduct(fromPrism.GetPlaneNormal(j)) == Approx(1));
+
+        for (std::size_t j = 0; j < 1000; j++)
+        {
+            const Vector3d point = box.GetCenter() + RandomVector(rng, 4);
+
+            // Skip points right on the surface, which may round either way
+            if (std::abs(box.SignedDistance(point)) < 1e-9)
+                continue;
+
+            REQUIRE(fromBox.Contains(point) == box.Contains(point));
+            REQUIRE(fromPrism.Contains(point) == box.Contains(point));
+        }
+    }
+
+    return;
+}
+
+// Tests that a polyhedron built from a frustum contains the same points as the frustum
+TEST_CASE(__FILE__"/From_Frustum", "[ConvexPolyhedronCollider]")
+{
+    const Frustum frustum(Perspective());
+    const ConvexPolyhedronCollider polyhedron(frustum);
+
+    REQUIRE(polyhedron.GetPlaneCount() == 6);
+
+    for (std::size_t i = 0; i < 8; i++)
+        REQUIRE(polyhedron.GetVertices()[i] == frustum.GetCorner(i));
+
+    for (std::size_t i = 0; i < 10000; i++)
+    {
+        const Vector3d point = RandomVector(rng, 100);
+
+        // Skip points right on a plane, which may round either way. These lie on a grid, so they hit the planes often
+        bool onPlane = false;
+        for (std::size_t j = 0; j < 6; j++)
+            if (std::abs(frustum.GetPlaneNormal(j).DotProduct(point) + frustum.GetPlaneOffset(j)) < 1e-9)
+                onPlane = true;
+
+        if (onPlane)
+            continue;
+
+        REQUIRE(polyhedron.Contains(point) == frustum.Contains(point));
+    }
+
+    return;
+}
@@ -0,0 +1,269 @@
+#include "Catch2.h"
+#include <Eule/DualQuaternion.h>
+#include <Eule/Quaternion.h>
+#include "TestingUtilities/HandyMacros.h"
+#include <random>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+
+    Vector3d RandomEuler()
+    {
+        return Vector3d(rng() % 360, rng() % 360, rng() % 360);
+    }
+
+    Vector3d RandomPoint()
+    {
+        return Vector3d(LARGE_RAND_DOUBLE, LARGE_RAND_DOUBLE, LARGE_RAND_DOUBLE) * 0.01;
+    }
+}
+
+// Tests that the default constructor yields the identity transformation
+TEST_CASE(__FILE__"/Default_Constructor_Is_Identity", "[DualQuaternion]")
+{
+    const DualQuaternion dq;
+
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        const Vector3d p = RandomPoint();
+        REQUIRE(p.Similar(dq * p));
+    }
+
+    return;
+}
+
+// Tests that transforming a point equals rotating it by the Quaternion, and then translating it
+TEST_CASE(__FILE__"/Transform_Equals_Rotation_Then_Translation", "[DualQuaternion]")
+{
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const Quaternion rot(RandomEuler());
+        const Vector3d trans = RandomPoint();
+        const Vector3d p = RandomPoint();
+
+        const DualQuaternion dq(rot, trans);
+
+        INFO("Actual: " << dq * p << "  Expected: " << (rot * p) + trans);
+        REQUIRE(((rot * p) + trans).Similar(dq * p, 0.0001));
+        REQUIRE((rot * p).Similar(dq.TransformDirection(p), 0.0001));
+    }
+
+    return;
+}
+
+// Tests that the rotation and translation can be retrieved again
+TEST_CASE(__FILE__"/Get_Rotation_And_Translation", "[DualQuaternion]")
+{
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const Quaternion rot(RandomEuler());
+        const Vector3d trans = RandomPoint();
+
+        const DualQuaternion dq(rot, trans);
+
+        REQUIRE(dq.GetRotation() == rot);
+        REQUIRE(dq.GetTranslation().Similar(trans, 0.0001));
+    }
+
+    return;
+}
+
+// Tests that converting from and to a Matrix4x4 preserves the transformation
+TEST_CASE(__FILE__"/Matrix_Conversion", "[DualQuaternion]")
+{
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const Quaternion rot(RandomEuler());
+        Matrix4x4 mat = rot.ToRotationMatrix();
+        mat.SetTranslationComponent(RandomPoint());
+
+        const DualQuaternion dq(mat);
+        const Vector3d p = RandomPoint();
+
+        INFO("Matrix: " << mat << "DualQuaternion: " << dq);
+        REQUIRE((p * mat).Similar(dq * p, 0.0001));
+        REQUIRE(dq.ToMatrix().Similar(mat, 0.0001));
+    }
+
+    return;
+}
+
+// Tests that concatenating applies the left hand side first, just like Quaternions do
+TEST_CASE(__FILE__"/Concatenation_Order", "[DualQuaternion]")
+{
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const DualQuaternion a(Quaternion(RandomEuler()), RandomPoint());
+        const DualQuaternion b(Quaternion(RandomEuler()), RandomPoint());
+        const Vector3d p = RandomPoint();
+
+        REQUIRE((b * (a * p)).Similar((a * b) * p, 0.0001));
+    }
+
+    return;
+}
+
+// Tests that a transformation followed by its inverse is the identity
+TEST_CASE(__FILE__"/Inverse", "[DualQuaternion]")
+{
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const DualQuaternion dq(Quaternion(RandomEuler()), RandomPoint());
+        const Vector3d p = RandomPoint();
+
+        REQUIRE(p.Similar(dq.Inverse() * (dq * p), 0.0001));
+        REQUIRE((dq * dq.Inverse()) == DualQuaternion());
+    }
+
+    return;
+}
+
+// Tests that lerping between two pure translations lerps the translation
+TEST_CASE(__FILE__"/Lerp_Translations", "[DualQuaternion]")
+{
+    const DualQuaternion a(Quaternion(), Vector3d(0, 0, 0));
+    const DualQuaternion b(Quaternion(), Vector3d(10, -20, 30));
+
+    REQUIRE(a.Lerp(b, 0.5).GetTranslation().Similar(Vector3d(5, -10, 15)));
+    REQUIRE(a.Lerp(b, 0).GetTranslation().Similar(Vector3d(0, 0, 0)));
+    REQUIRE(a.Lerp(b, 1).GetTranslation().Similar(Vector3d(10, -20, 30)));
+
+    return;
+}
+
+// Tests that skinning with a single full weight equals the plain transformation, for any batch size
+TEST_CASE(__FILE__"/Skin_Single_Bone", "[DualQuaternion][Skinning]")
+{
+    std::vector<DualQuaternion> palette;
+    for (std::size_t i = 0; i < 8; i++)
+        palette.emplace_back(Quaternion(RandomEuler()), RandomPoint());
+
+    // Odd count, to exercise the tail
+    std::vector<Vector3d> vertices;
+    std::vector<DualQuaternion::BoneInfluence> influences;
+    for (std::size_t i = 0; i < 103; i++)
+    {
+        vertices.push_back(RandomPoint());
+
+        DualQuaternion::BoneInfluence inf;
+        inf.bones = { rng() % palette.size(), rng() % palette.size(), 0, 0 };
+        inf.weights = { 1, 0, 0, 0 };
+        influences.push_back(inf);
+    }
+
+    std::vector<Vector3d> skinned;
+    DualQuaternion::Skin(vertices, influences, palette, skinned);
+
+    REQUIRE(skinned.size() == vertices.size());
+    for (std::size_t i = 0; i < vertices.size(); i++)
+        REQUIRE((palette[influences[i].bones[0]] * vertices[i]).Similar(skinned[i], 0.0001));
+
+    return;
+}
+
+// Tests that skinning with multiple weights equals the normalized blend of the bones
+TEST_CASE(__FILE__"/Skin_Blended_Bones", "[DualQuaternion][Skinning]")
+{
+    std::vector<DualQuaternion> palette;
+    for (std::size_t i = 0; i < 8; i++)
+        palette.emplace_back(Quaternion(RandomEuler()), RandomPoint());
+
+    std::vector<Vector3d> vertices;
+    std::vector<DualQuaternion::BoneInfluence> influences;
+    for (std::size_t i = 0; i < 66; i++)
+    {
+        vertices.push_back(RandomPoint());
+
+        DualQuaternion::BoneInfluence inf;
+        inf.bones = { rng() % palette.size(), rng() % palette.size(), 0, 0 };
+        inf.weights = { 0.25, 0.75, 0, 0 };
+        influences.push_back(inf);
+    }
+
+    std::vector<Vector3d> skinned;
+    DualQuaternion::Skin(vertices, influences, palette, skinned);
+
+    for (std::size_t i = 0; i < vertices.size(); i++)
+    {
+        const DualQuaternion& a = palette[influences[i].bones[0]];
+        const DualQuaternion& b = palette[influences[i].bones[1]];
+
+        REQUIRE((a.Lerp(b, 0.75) * vertices[i]).Similar(skinned[i], 0.0001));
+    }
+
+    return;
+}
+
+// Tests that blending two pure translations with equal weights places a vertex in between
+TEST_CASE(__FILE__"/Skin_Translations", "[DualQuaternion][Skinning]")
+{
+    const std::vector<DualQuaternion> palette = {
+        DualQuaternion(Quaternion(), Vector3d(0, 10, 0)),
+        DualQuaternion(Quaternion(), Vector3d(0, 0, 10)),
+    };
+
+    DualQuaternion::BoneInfluence inf;
+    inf.bones = { 0, 1, 0, 0 };
+    inf.weights = { 0.5, 0.5, 0, 0 };
+
+    const std::vector<Vector3d> vertices(5, Vector3d(1, 2, 3));
+    const std::vector<DualQuaternion::BoneInfluence> influences(5, inf);
+
+    std::vector<Vector3d> skinned;
+    DualQuaternion::Skin(vertices, influences, palette, skinned);
+
+    for (const Vector3d& v : skinned)
+        REQUIRE(v.Similar(Vector3d(1, 7, 8)));
+
+    return;
+}
+
+// Tests that vertices without any weight are left unchanged, instead of becoming NaN
+TEST_CASE(__FILE__"/Skin_Unweighted_Vertices", "[DualQuaternion][Skinning]")
+{
+    std::vector<DualQuaternion> palette;
+    for (std::size_t i = 0; i < 4; i++)
+        palette.emplace_back(Quaternion(RandomEuler()), RandomPoint());
+
+    // Odd count, to exercise the tail. Every third vertex has no weight
+    std::vector<Vector3d> vertices;
+    std::vector<DualQuaternion::BoneInfluence> influences;
+    for (std::size_t i = 0; i < 11; i++)
+    {
+        vertices.push_back(RandomPoint());
+
+        DualQuaternion::BoneInfluence inf;
+        inf.bones = { rng() % palette.size(), 0, 0, 0 };
+        inf.weights = { (i % 3) ? 1.0 : 0.0, 0, 0, 0 };
+        influences.push_back(inf);
+    }
+
+    std::vector<Vector3d> skinned;
+    DualQuaternion::Skin(vertices, influences, palette, skinned);
+
+    for (std::size_t i = 0; i < vertices.size(); i++)
+    {
+        if (i % 3)
+            REQUIRE((palette[influences[i].bones[0]] * vertices[i]).Similar(skinned[i], 0.0001));
+        else
+            REQUIRE(skinned[i] == vertices[i]);
+    }
+
+    return;
+}
+
+// Tests that mismatching vertex and influence counts throw
+TEST_CASE(__FILE__"/Skin_Mismatching_Sizes_Throw", "[DualQuaternion][Skinning]")
+{
+    const std::vector<DualQuaternion> palette(1);
+    const std::vector<Vector3d> vertices(3);
+    const std::vector<DualQuaternion::BoneInfluence> influences(2);
+    std::vector<Vector3d> skinned;
+
+    REQUIRE_THROWS_AS(DualQuaternion::Skin(vertices, influences, palette, skinned), std::invalid_argument);
+
+    return;
+}
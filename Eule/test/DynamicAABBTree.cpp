@@ -0,0 +1,268 @@
+#include "Catch2.h"
+#include <Eule/DynamicAABBTree.h>
+#include <Eule/TrapazoidalPrismCollider.h>
+#include "TestingUtilities/Fixtures.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+using TPC = TrapazoidalPrismCollider;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+
+    AABB RandomBox(double scale)
+    {
+        const Vector3d center = RandomVector(rng, scale);
+        const Vector3d halfSize = Vector3d(0.5, 0.5, 0.5) + Vector3d(rng() % 100, rng() % 100, rng() % 100) * 0.02;
+
+        return AABB { center - halfSize, center + halfSize };
+    }
+}
+
+// Tests that fat boxes enclose the inserted bounds by the margin
+TEST_CASE(__FILE__"/Insert_Fattens_Bounds", "[DynamicAABBTree]")
+{
+    DynamicAABBTree tree(0.5);
+    const std::size_t handle = tree.Insert(AABB { Vector3d(0, 0, 0), Vector3d(1, 2, 3) });
+
+    REQUIRE(tree.Size() == 1);
+    REQUIRE(tree.GetHeight() == 0);
+    REQUIRE(tree.GetFatBounds(handle).min.Similar(Vector3d(-0.5, -0.5, -0.5)));
+    REQUIRE(tree.GetFatBounds(handle).max.Similar(Vector3d(1.5, 2.5, 3.5)));
+    REQUIRE(tree.GetCollider(handle) == nullptr);
+
+    return;
+}
+
+// Tests that box queries equal brute force, while inserting and removing
+TEST_CASE(__FILE__"/Query_Equals_Brute_Force", "[DynamicAABBTree]")
+{
+    DynamicAABBTree tree;
+    std::vector<std::size_t> handles;
+
+    for (std::size_t i = 0; i < 500; i++)
+        handles.push_back(tree.Insert(RandomBox(50)));
+
+    // Remove every third leaf
+    std::vector<std::size_t> alive;
+    for (std::size_t i = 0; i < handles.size(); i++)
+    {
+        if (i % 3 == 0)
+            tree.Remove(handles[i]);
+        else
+            alive.push_back(handles[i]);
+    }
+
+    REQUIRE(tree.Size() == alive.size());
+
+    for (std::size_t i = 0; i < 200; i++)
+    {
+        const AABB query = RandomBox(50);
+
+        std::vector<std::size_t> expected;
+        for (std::size_t handle : alive)
+            if (Overlaps(tree.GetFatBounds(handle), query))
+                expected.push_back(handle);
+
+        std::vector<std::size_t> found;
+        tree.Query(query, found);
+
+        REQUIRE(Sorted(found) == Sorted(expected));
+    }
+
+    return;
+}
+
+// Tests that moving leaves keeps queries correct, and only re-inserts leaves that left their fat box
+TEST_CASE(__FILE__"/Move", "[DynamicAABBTree]")
+{
+    DynamicAABBTree tree(1);
+    std::vector<std::size_t> handles;
+    std::vector<AABB> boxes;
+
+    for (std::size_t i = 0; i < 300; i++)
+    {
+        boxes.push_back(RandomBox(30));
+        handles.push_back(tree.Insert(boxes.back()));
+    }
+
+    // Small moves stay within the margin
+    const Vector3d nudge(0.5, -0.5, 0.25);
+    REQUIRE_FALSE(tree.Move(handles[0], AABB { boxes[0].min + nudge, boxes[0].max + nudge }));
+
+    // Large moves don't
+    const Vector3d jump(10, 0, 0);
+    REQUIRE(tree.Move(handles[0], AABB { boxes[0].min + jump, boxes[0].max + jump }, jump));
+    REQUIRE(tree.GetFatBounds(handles[0]).max.x >= boxes[0].max.x + 2 * jump.x);
+    boxes[0] = AABB { boxes[0].min + jump, boxes[0].max + jump };
+
+    for (std::size_t step = 0; step < 20; step++)
+    {
+        for (std::size_t i = 0; i < boxes.size(); i++)
+        {
+            const Vector3d displacement = RandomVector(rng, 2);
+            boxes[i] = AABB { boxes[i].min + displacement, boxes[i].max + displacement };
+            tree.Move(handles[i], boxes[i], displacement);
+
+            // Fat boxes always enclose the actual bounds
+            const AABB& fat = tree.GetFatBounds(handles[i]);
+            REQUIRE(fat.min.x <= boxes[i].min.x);
+            REQUIRE(fat.max.z >= boxes[i].max.z);
+        }
+
+        const AABB query = RandomBox(30);
+
+        std::vector<std::size_t> expected;
+        for (std::size_t handle : handles)
+            if (Overlaps(tree.GetFatBounds(handle), query))
+                expected.push_back(handle);
+
+        std::vector<std::size_t> found;
+        tree.Query(query, found);
+
+        REQUIRE(Sorted(found) == Sorted(expected));
+    }
+
+    return;
+}
+
+// Tests that inserting sorted boxes, the worst case for an unbalanced tree, still yields a shallow tree
+TEST_CASE(__FILE__"/Stays_Balanced", "[DynamicAABBTree]")
+{
+    DynamicAABBTree tree(0);
+
+    for (std::size_t i = 0; i < 1024; i++)
+        tree.Insert(AABB { Vector3d(i * 2.0, 0, 0), Vector3d(i * 2.0 + 1, 1, 1) });
+
+    INFO("Height: " << tree.GetHeight());
+    REQUIRE(tree.GetHeight() <= 20);
+
+    return;
+}
+
+// Tests that pairs of overlapping fat boxes equal brute force
+TEST_CASE(__FILE__"/Overlapping_Pairs", "[DynamicAABBTree]")
+{
+    DynamicAABBTree tree(0.1);
+    std::vector<std::size_t> handles;
+
+    for (std::size_t i = 0; i < 300; i++)
+        handles.push_back(tree.Insert(RandomBox(20)));
+
+    std::vector<std::pair<std::size_t, std::size_t>> expected;
+    for (std::size_t i = 0; i < handles.size(); i++)
+        for (std::size_t j = 0; j < handles.size(); j++)
+            if ((handles[i] < handles[j]) && Overlaps(tree.GetFatBounds(handles[i]), tree.GetFatBounds(handles[j])))
+                expected.emplace_back(handles[i], handles[j]);
+
+    std::vector<std::pair<std::size_t, std::size_t>> pairs;
+    tree.FindOverlappingPairs(pairs);
+
+    std::sort(expected.begin(), expected.end());
+    std::sort(pairs.begin(), pairs.end());
+
+    REQUIRE(pairs.size() > 0);
+    REQUIRE(pairs == expected);
+
+    return;
+}
+
+// Tests that point queries test attached colliders exactly
+TEST_CASE(__FILE__"/Find_Containing", "[DynamicAABBTree][Collider]")
+{
+    DynamicAABBTree tree(2);
+
+    std::vector<TPC> colliders;
+    std::vector<AABB> boxes;
+    for (std::size_t i = 0; i < 200; i++)
+    {
+        boxes.push_back(RandomBox(20));
+        colliders.push_back(MakeBox(boxes.back()));
+    }
+
+    // Only every other leaf gets a collider
+    std::vector<std::size_t> handles;
+    for (std::size_t i = 0; i < colliders.size(); i++)
+        handles.push_back(tree.Insert(boxes[i], (i % 2) ? &colliders[i] : nullptr));
+
+    for (std::size_t i = 0; i < 500; i++)
+    {
+        const Vector3d point = RandomVector(rng, 22);
+
+        std::vector<std::size_t> expected;
+        for (std::size_t j = 0; j < handles.size(); j++)
+        {
+            const AABB& fat = tree.GetFatBounds(handles[j]);
+            const bool inFat =
+                (fat.min.x <= point.x) && (point.x <= fat.max.x) &&
+                (fat.min.y <= point.y) && (point.y <= fat.max.y) &&
+                (fat.min.z <= point.z) && (point.z <= fat.max.z);
+
+            if ((j % 2) ? (inFat && colliders[j].Contains(point)) : inFat)
+                expected.push_back(handles[j]);
+        }
+
+        std::vector<std::size_t> found;
+        tree.FindContaining(point, found);
+
+        REQUIRE(Sorted(found) == Sorted(expected));
+    }
+
+    return;
+}
+
+// Tests that ray queries find every fat box the ray passes through
+TEST_CASE(__FILE__"/Raycast", "[DynamicAABBTree][Raycast]")
+{
+    DynamicAABBTree tree(0);
+
+    const std::size_t hit = tree.Insert(AABB { Vector3d(10, -1, -1), Vector3d(12, 1, 1) });
+    const std::size_t behind = tree.Insert(AABB { Vector3d(-12, -1, -1), Vector3d(-10, 1, 1) });
+    const std::size_t tooFar = tree.Insert(AABB { Vector3d(100, -1, -1), Vector3d(102, 1, 1) });
+    const std::size_t aside = tree.Insert(AABB { Vector3d(10, 5, -1), Vector3d(12, 7, 1) });
+
+    std::vector<std::size_t> found;
+    tree.Raycast(Vector3d(0, 0, 0), Vector3d(1, 0, 0), 50, found);
+    REQUIRE(found == std::vector<std::size_t>{ hit });
+
+    found.clear();
+    tree.Raycast(Vector3d(0, 0, 0), Vector3d(1, 0, 0), 1000, found);
+    REQUIRE(Sorted(found) == Sorted(std::vector<std::size_t>{ hit, tooFar }));
+
+    found.clear();
+    tree.Raycast(Vector3d(0, 0, 0), Vector3d(-1, 0, 0), 1000, found);
+    REQUIRE(found == std::vector<std::size_t>{ behind });
+
+    found.clear();
+    tree.Raycast(Vector3d(0, 0, 0), Vector3d(11, 6, 0), 1, found);
+    REQUIRE(found == std::vector<std::size_t>{ aside });
+
+    return;
+}
+
+// Tests that removed handles get reused, and that invalid handles throw
+TEST_CASE(__FILE__"/Handles", "[DynamicAABBTree]")
+{
+    DynamicAABBTree tree;
+
+    const std::size_t a = tree.Insert(RandomBox(10));
+    tree.Insert(RandomBox(10));
+    tree.Remove(a);
+
+    REQUIRE_THROWS_AS(tree.Remove(a), std::out_of_range);
+    REQUIRE_THROWS_AS(tree.Move(a, RandomBox(10)), std::out_of_range);
+    REQUIRE_THROWS_AS(tree.Remove(12345), std::out_of_range);
+
+    REQUIRE(tree.Insert(RandomBox(10)) == a);
+    REQUIRE(tree.Size() == 2);
+
+    tree.Clear();
+    REQUIRE(tree.Size() == 0);
+    REQUIRE(tree.GetHeight() == 0);
+
+    return;
+}
@@ -0,0 +1,178 @@
+#include "Catch2.h"
+#include <Eule/Frustum.h>
+#include <Eule/Math.h>
+#include "TestingUtilities/HandyMacros.h"
+#include "TestingUtilities/Fixtures.h"
+#include <random>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+using CL = Frustum::CLASSIFICATION;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+}
+
+// Tests that the default frustum is the cube [-1, 1]^3
+TEST_CASE(__FILE__"/Default_Is_Unit_Cube", "[Frustum][Collider]")
+{
+    const Frustum frustum;
+
+    REQUIRE(frustum.Contains(Vector3d(0, 0, 0)));
+    REQUIRE(frustum.Contains(Vector3d(0.99, -0.99, 0.99)));
+    REQUIRE_FALSE(frustum.Contains(Vector3d(1.01, 0, 0)));
+    REQUIRE_FALSE(frustum.Contains(Vector3d(0, -1.01, 0)));
+    REQUIRE_FALSE(frustum.Contains(Vector3d(0, 0, 1.01)));
+
+    return;
+}
+
+// Tests that the extracted planes are normalized
+TEST_CASE(__FILE__"/Planes_Are_Normalized", "[Frustum]")
+{
+    const Frustum frustum(Perspective());
+
+    for (std::size_t i = 0; i < 6; i++)
+        REQUIRE(Math::Similar(frustum.GetPlaneNormal(i).Magnitude(), 1));
+
+    // The near plane sits at z = -1, facing towards -z
+    REQUIRE(frustum.GetPlaneNormal(Frustum::FRONT).Similar(Vector3d(0, 0, -1)));
+    REQUIRE(Math::Similar(frustum.GetPlaneOffset(Frustum::FRONT), -1));
+
+    return;
+}
+
+// Tests points against a perspective frustum
+TEST_CASE(__FILE__"/Perspective_Points", "[Frustum][Collider]")
+{
+    const Frustum frustum(Perspective());
+
+    REQUIRE(frustum.Contains(Vector3d(0, 0, -10)));
+    REQUIRE(frustum.Contains(Vector3d(9, 0, -10)));
+    REQUIRE(frustum.Contains(Vector3d(-9, 9, -10)));
+    REQUIRE(frustum.Contains(Vector3d(0, 0, -99)));
+
+    REQUIRE_FALSE(frustum.Contains(Vector3d(11, 0, -10)));
+    REQUIRE_FALSE(frustum.Contains(Vector3d(0, -11, -10)));
+    REQUIRE_FALSE(frustum.Contains(Vector3d(0, 0, 10)));
+    REQUIRE_FALSE(frustum.Contains(Vector3d(0, 0, -0.5)));
+    REQUIRE_FALSE(frustum.Contains(Vector3d(0, 0, -101)));
+
+    return;
+}
+
+// Tests that the corners are where the planes of a perspective frustum meet
+TEST_CASE(__FILE__"/Perspective_Corners", "[Frustum]")
+{
+    const Frustum frustum(Perspective());
+
+    // Near plane at z = -1, far plane at z = -100, 90 deg fov
+    REQUIRE(frustum.GetCorner(7).Similar(Vector3d(1, 1, -1)));
+    REQUIRE(frustum.GetCorner(4).Similar(Vector3d(-1, -1, -1)));
+    REQUIRE(frustum.GetCorner(2).Similar(Vector3d(100, -100, -100), 0.0001));
+    REQUIRE(frustum.GetCorner(1).Similar(Vector3d(-100, 100, -100), 0.0001));
+
+    // The support point in any direction is a corner
+    REQUIRE(frustum.SupportPoint(Vector3d(1, 1, -1)).Similar(Vector3d(100, 100, -100), 0.0001));
+    REQUIRE(frustum.SupportPoint(Vector3d(0, 0, 1)).z == Approx(-1));
+
+    return;
+}
+
+// Tests sphere classification against a perspective frustum
+TEST_CASE(__FILE__"/Classify_Sphere", "[Frustum]")
+{
+    const Frustum frustum(Perspective());
+
+    REQUIRE(frustum.ClassifySphere(Vector3d(0, 0, -10), 1) == CL::INSIDE);
+    REQUIRE(frustum.ClassifySphere(Vector3d(0, 0, -0.5), 1) == CL::INTERSECTING);
+    REQUIRE(frustum.ClassifySphere(Vector3d(10, 0, -10), 1) == CL::INTERSECTING);
+    REQUIRE(frustum.ClassifySphere(Vector3d(0, 0, 10), 1) == CL::OUTSIDE);
+    REQUIRE(frustum.ClassifySphere(Vector3d(0, 0, -150), 20) == CL::OUTSIDE);
+
+    return;
+}
+
+// Tests box classification against a perspective frustum
+TEST_CASE(__FILE__"/Classify_AABB", "[Frustum]")
+{
+    const Frustum frustum(Perspective());
+
+    REQUIRE(frustum.ClassifyAABB({ Vector3d(-1, -1, -11), Vector3d(1, 1, -9) }) == CL::INSIDE);
+    REQUIRE(frustum.ClassifyAABB({ Vector3d(-1, -1, -2), Vector3d(1, 1, 0) }) == CL::INTERSECTING);
+    REQUIRE(frustum.ClassifyAABB({ Vector3d(-100, -100, -50), Vector3d(100, 100, -40) }) == CL::INTERSECTING);
+    REQUIRE(frustum.ClassifyAABB({ Vector3d(-1, -1, 5), Vector3d(1, 1, 6) }) == CL::OUTSIDE);
+    REQUIRE(frustum.ClassifyAABB({ Vector3d(20, -1, -11), Vector3d(22, 1, -9) }) == CL::OUTSIDE);
+
+    return;
+}
+
+// Tests that the batched classifications equal the single ones, with and without temporal coherence
+TEST_CASE(__FILE__"/Batched_Equals_Single", "[Frustum]")
+{
+    Matrix4x4 view;
+    view.SetTranslationComponent(Vector3d(3, -2, -20));
+    const Frustum frustum(Perspective().Multiply4x4(view));
+
+    // Odd count, to exercise the tail
+    std::vector<Vector3d> centers;
+    std::vector<double> radii;
+    std::vector<AABB> boxes;
+    for (std::size_t i = 0; i < 1001; i++)
+    {
+        const Vector3d c(LARGE_RAND_DOUBLE * 0.03, LARGE_RAND_DOUBLE * 0.03, LARGE_RAND_DOUBLE * 0.03);
+        const Vector3d e(LARGE_RAND_POSITIVE_DOUBLE * 0.03, LARGE_RAND_POSITIVE_DOUBLE * 0.03, LARGE_RAND_POSITIVE_DOUBLE * 0.03);
+
+        centers.push_back(c);
+        radii.push_back(LARGE_RAND_POSITIVE_DOUBLE * 0.03);
+        boxes.push_back({ c - e, c + e });
+    }
+
+    std::vector<CL> sphereResults;
+    std::vector<CL> boxResults;
+    frustum.ClassifySpheres(centers, radii, sphereResults);
+    frustum.ClassifyAABBs(boxes, boxResults);
+
+    std::vector<std::uint8_t> sphereCache;
+    std::vector<std::uint8_t> boxCache;
+    std::vector<CL> coherentSphereResults;
+    std::vector<CL> coherentBoxResults;
+
+    // Run the coherent path for a few frames, with slightly moving objects
+    for (std::size_t frame = 0; frame < 3; frame++)
+    {
+        frustum.ClassifySpheres(centers, radii, coherentSphereResults, sphereCache);
+        frustum.ClassifyAABBs(boxes, coherentBoxResults, boxCache);
+
+        REQUIRE(sphereCache.size() == centers.size());
+        for (std::size_t i = 0; i < centers.size(); i++)
+        {
+            REQUIRE(frustum.ClassifySphere(centers[i], radii[i]) == coherentSphereResults[i]);
+            REQUIRE(frustum.ClassifyAABB(boxes[i]) == coherentBoxResults[i]);
+            REQUIRE(sphereCache[i] < 6);
+
+            if (frame == 0)
+            {
+                REQUIRE(sphereResults[i] == coherentSphereResults[i]);
+                REQUIRE(boxResults[i] == coherentBoxResults[i]);
+            }
+
+            centers[i] += Vector3d(0.5, 0, 0);
+            boxes[i].min += Vector3d(0.5, 0, 0);
+            boxes[i].max += Vector3d(0.5, 0, 0);
+        }
+    }
+
+    return;
+}
+
+// Tests that mismatching center and radius counts throw
+TEST_CASE(__FILE__"/Mismatching_Sizes_Throw", "[Frustum]")
+{
+    const Frustum frustum;
+    std::vector<CL> out;
+
+    REQUIRE_THROWS_AS(frustum.ClassifySpheres(std::vector<Vector3d>(3), std::vector<double>(2), out), std::invalid_argument);
+
+    return;
+}
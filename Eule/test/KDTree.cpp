@@ -0,0 +1,176 @@
+#include "Catch2.h"
+#include <Eule/KDTree.h>
+#include "TestingUtilities/Fixtures.h"
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+
+    // Will return the squared distances of the k nearest points, by brute force
+    std::vector<double> BruteForceDistances(const std::vector<Vector3d>& points, const Vector3d& query, std::size_t k)
+    {
+        std::vector<double> distances;
+        for (const Vector3d& p : points)
+            distances.push_back((p - query).SqrMagnitude());
+
+        std::sort(distances.begin(), distances.end());
+        distances.resize(std::min(k, distances.size()));
+
+        return distances;
+    }
+
+    std::vector<double> Distances(const std::vector<Vector3d>& points, const Vector3d& query, const std::vector<std::size_t>& found)
+    {
+        std::vector<double> distances;
+        for (std::size_t i : found)
+            distances.push_back((points[i] - query).SqrMagnitude());
+
+        return distances;
+    }
+}
+
+// Tests that nearest neighbours equal brute force. Compared by distance, since ties may be broken either way
+TEST_CASE(__FILE__"/Nearest", "[KDTree]")
+{
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 3000; i++)
+        points.push_back(RandomVector(rng, 100));
+
+    const KDTree tree(points);
+    REQUIRE(tree.Size() == points.size());
+
+    for (std::size_t i = 0; i < 500; i++)
+    {
+        const Vector3d query = RandomVector(rng, 120);
+        const std::size_t nearest = tree.Nearest(query);
+
+        REQUIRE((points[nearest] - query).SqrMagnitude() == BruteForceDistances(points, query, 1)[0]);
+    }
+
+    // Points of the set are their own nearest neighbour
+    for (std::size_t i = 0; i < 100; i++)
+        REQUIRE(points[tree.Nearest(points[i])] == points[i]);
+
+    return;
+}
+
+// Tests that k nearest neighbours equal brute force, nearest first
+TEST_CASE(__FILE__"/K_Nearest", "[KDTree]")
+{
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 2000; i++)
+        points.push_back(RandomVector(rng, 50));
+
+    const KDTree tree(points);
+
+    for (std::size_t i = 0; i < 200; i++)
+    {
+        const Vector3d query = RandomVector(rng, 60);
+        const std::size_t k = 1 + rng() % 40;
+
+        std::vector<std::size_t> found;
+        tree.KNearest(query, k, found);
+
+        REQUIRE(found.size() == k);
+        REQUIRE(Distances(points, query, found) == BruteForceDistances(points, query, k));
+    }
+
+    // Asking for more points than there are yields all of them
+    const KDTree small(std::vector<Vector3d>(points.begin(), points.begin() + 5));
+    std::vector<std::size_t> found;
+    small.KNearest(Vector3d(0, 0, 0), 10, found);
+    std::sort(found.begin(), found.end());
+    REQUIRE(found == std::vector<std::size_t>{ 0, 1, 2, 3, 4 });
+
+    return;
+}
+
+// Tests that radius searches equal brute force
+TEST_CASE(__FILE__"/Radius", "[KDTree]")
+{
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 3000; i++)
+        points.push_back(RandomVector(rng, 50));
+
+    // Duplicates and points sharing coordinates end up on both sides of splits
+    for (std::size_t i = 0; i < 200; i++)
+        points.push_back(Vector3d(points[i].x, points[i + 1].y, points[i].z));
+
+    const KDTree tree(points);
+
+    for (std::size_t i = 0; i < 200; i++)
+    {
+        const Vector3d center = RandomVector(rng, 60);
+        const double radius = (rng() % 2000) / 100.0;
+
+        std::vector<std::size_t> expected;
+        for (std::size_t j = 0; j < points.size(); j++)
+            if ((points[j] - center).SqrMagnitude() <= radius * radius)
+                expected.push_back(j);
+
+        std::vector<std::size_t> found;
+        tree.Radius(center, radius, found);
+        std::sort(found.begin(), found.end());
+
+        REQUIRE(found == expected);
+    }
+
+    return;
+}
+
+// Tests that building and querying on multiple threads gives the same results as on one
+TEST_CASE(__FILE__"/Parallel", "[KDTree]")
+{
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 100000; i++)
+        points.push_back(RandomVector(rng, 100));
+
+    std::vector<Vector3d> queries;
+    for (std::size_t i = 0; i < 2000; i++)
+        queries.push_back(RandomVector(rng, 100));
+
+    const KDTree single(points, 1);
+    const KDTree multi(points, 4);
+
+    std::vector<std::size_t> expected;
+    for (const Vector3d& q : queries)
+        single.KNearest(q, 8, expected);
+
+    std::vector<std::size_t> found;
+    multi.KNearest(queries, 8, found, 4);
+    REQUIRE(Distances(points, Vector3d(0, 0, 0), found).size() == expected.size());
+
+    for (std::size_t i = 0; i < queries.size(); i++)
+        for (std::size_t j = 0; j < 8; j++)
+            REQUIRE((points[found[i * 8 + j]] - queries[i]).SqrMagnitude() == (points[expected[i * 8 + j]] - queries[i]).SqrMagnitude());
+
+    std::vector<std::size_t> nearest;
+    multi.Nearest(queries, nearest, 0);
+    REQUIRE(nearest.size() == queries.size());
+
+    for (std::size_t i = 0; i < queries.size(); i++)
+        REQUIRE((points[nearest[i]] - queries[i]).SqrMagnitude() == (points[expected[i * 8]] - queries[i]).SqrMagnitude());
+
+    return;
+}
+
+// Tests that empty trees throw on nearest neighbour queries, and return nothing otherwise
+TEST_CASE(__FILE__"/Empty", "[KDTree]")
+{
+    const KDTree tree;
+
+    REQUIRE(tree.Size() == 0);
+    REQUIRE_THROWS_AS(tree.Nearest(Vector3d(0, 0, 0)), std::logic_error);
+
+    std::vector<std::size_t> found;
+    tree.KNearest(Vector3d(0, 0, 0), 3, found);
+    tree.Radius(Vector3d(0, 0, 0), 100, found);
+    REQUIRE(found.empty());
+
+    return;
+}
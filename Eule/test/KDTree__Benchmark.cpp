@@ -0,0 +1,92 @@
+#include "Catch2.h"
+#include <Eule/KDTree.h>
+#include "TestingUtilities/Fixtures.h"
+#include <random>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+
+/*
+    Benchmarks are hidden by default. Run them with:
+    ./Eule_tests "[benchmark]"
+*/
+
+namespace {
+    static std::mt19937 rng = std::mt19937(1337);
+}
+
+// Measures building a tree over a million points, on one thread and on all of them
+TEST_CASE(__FILE__"/Build", "[.][benchmark][KDTree]")
+{
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 1000000; i++)
+        points.push_back(RandomVector(rng, 1000));
+
+    BENCHMARK("Build, 1M points, 1 thread")
+    {
+        return KDTree(points, 1).Size();
+    };
+
+    BENCHMARK("Build, 1M points, all threads")
+    {
+        return KDTree(points, 0).Size();
+    };
+
+    return;
+}
+
+// Compares nearest neighbour queries against a brute force loop, and batched queries on all threads
+TEST_CASE(__FILE__"/Query", "[.][benchmark][KDTree]")
+{
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 1000000; i++)
+        points.push_back(RandomVector(rng, 1000));
+
+    std::vector<Vector3d> queries;
+    for (std::size_t i = 0; i < 10000; i++)
+        queries.push_back(RandomVector(rng, 1000));
+
+    const KDTree tree(points, 0);
+    std::vector<std::size_t> out;
+
+    BENCHMARK("Brute force nearest, 100 queries")
+    {
+        std::size_t sum = 0;
+        for (std::size_t q = 0; q < 100; q++)
+        {
+            std::size_t best = 0;
+            double bestDistance = (points[0] - queries[q]).SqrMagnitude();
+            for (std::size_t i = 1; i < points.size(); i++)
+            {
+                const double d = (points[i] - queries[q]).SqrMagnitude();
+                if (d < bestDistance)
+                {
+                    bestDistance = d;
+                    best = i;
+                }
+            }
+            sum += best;
+        }
+        return sum;
+    };
+
+    BENCHMARK("KDTree::Nearest(), 10k queries, 1 thread")
+    {
+        tree.Nearest(queries, out, 1);
+        return out.size();
+    };
+
+    BENCHMARK("KDTree::Nearest(), 10k queries, all threads")
+    {
+        tree.Nearest(queries, out, 0);
+        return out.size();
+    };
+
+    BENCHMARK("KDTree::KNearest(k = 16), 10k queries, all threads")
+    {
+        tree.KNearest(queries, 16, out, 0);
+        return out.size();
+    };
+
+    return;
+}
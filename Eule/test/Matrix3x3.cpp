@@ -0,0 +1,162 @@
+#include "Catch2.h"
+#include <Eule/Matrix3x3.h>
+#include <Eule/Quaternion.h>
+#include "TestingUtilities/Fixtures.h"
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+}
+
+// Tests that a new matrix is the identity, and that it is smaller than a Matrix4x4
+TEST_CASE(__FILE__"/Default_Is_Identity", "[Matrix3x3]")
+{
+    const Matrix3x3 identity;
+    REQUIRE(identity.ToMatrix4x4() == Matrix4x4());
+    REQUIRE(identity.Determinant() == 1);
+    REQUIRE(identity.Inverse() == identity);
+
+    REQUIRE(sizeof(Matrix3x3) == 9 * sizeof(double));
+    REQUIRE(sizeof(Matrix3x3) < sizeof(Matrix4x4));
+
+    return;
+}
+
+// Tests that converting to and from the 3x3 component of a Matrix4x4 loses nothing
+TEST_CASE(__FILE__"/Matrix4x4_Round_Trip", "[Matrix3x3]")
+{
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        const Matrix4x4 m = RandomMatrix(rng, 10);
+        const Matrix3x3 m3(m);
+
+        for (std::size_t y = 0; y < 3; y++)
+            for (std::size_t x = 0; x < 3; x++)
+                REQUIRE(m3[y][x] == m[y][x]);
+
+        REQUIRE(m3.ToMatrix4x4() == m);
+        REQUIRE(m3.Transpose().Transpose() == m3);
+        REQUIRE(m3.Transpose()[0][2] == m3[2][0]);
+    }
+
+    return;
+}
+
+// Tests that multiplying behaves like Matrix4x4::operator* on the 3x3 component
+TEST_CASE(__FILE__"/Multiply_Matches_Matrix4x4", "[Matrix3x3]")
+{
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const Matrix4x4 a = RandomMatrix(rng, 10);
+        const Matrix4x4 b = RandomMatrix(rng, 10);
+
+        REQUIRE((Matrix3x3(a) * Matrix3x3(b)).Similar(Matrix3x3(a * b), 1e-9));
+
+        Matrix3x3 c(a);
+        c *= Matrix3x3(b);
+        REQUIRE(c == Matrix3x3(a) * Matrix3x3(b));
+
+        // Transforming vectors
+        const Vector3d vec(RandomDouble(rng, 100), RandomDouble(rng, 100), RandomDouble(rng, 100));
+        REQUIRE(Matrix3x3(a).TransformVector(vec).Similar(vec * a, 1e-9));
+    }
+
+    return;
+}
+
+// Tests that determinant and inverse match those of Matrix4x4
+TEST_CASE(__FILE__"/Inverse_Matches_Matrix4x4", "[Matrix3x3]")
+{
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const Matrix4x4 m = RandomMatrix(rng, 10);
+        const Matrix3x3 m3(m);
+
+        REQUIRE(m3.Determinant() == Approx(m.Determinant(3)).margin(1e-9));
+
+        // Nearly singular matrices have huge inverses, which round too much for a fixed epsilon
+        if (std::abs(m3.Determinant()) < 1)
+            continue;
+
+        REQUIRE(m3.IsInversible());
+        REQUIRE(m3.Inverse().Similar(Matrix3x3(m.Inverse3x3()), 1e-9));
+        REQUIRE((m3 * m3.Inverse()).Similar(Matrix3x3(), 1e-9));
+    }
+
+    // Singular
+    Matrix3x3 flat;
+    flat[2][2] = 0;
+    REQUIRE_FALSE(flat.IsInversible());
+    REQUIRE_THROWS_AS(flat.Inverse(), std::runtime_error);
+
+    return;
+}
+
+// Tests that converting to and from quaternions yields the same rotation
+TEST_CASE(__FILE__"/Quaternion_Round_Trip", "[Matrix3x3]")
+{
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const Quaternion q(Vector3d(rng() % 360, rng() % 360, rng() % 360));
+        const Matrix3x3 m(q);
+
+        REQUIRE(m.Similar(Matrix3x3(q.ToRotationMatrix()), 1e-12));
+        REQUIRE(m.Determinant() == Approx(1));
+
+        // Both q and -q describe this rotation
+        const Vector4d expected = q.GetRawValues();
+        const Vector4d actual = m.ToQuaternion().GetRawValues();
+        REQUIRE((actual.Similar(expected, 1e-9) || actual.Similar(expected * -1, 1e-9)));
+
+        const Vector3d vec(RandomDouble(rng, 100), RandomDouble(rng, 100), RandomDouble(rng, 100));
+        REQUIRE(m.TransformVector(vec).Similar(vec * q.ToRotationMatrix(), 1e-9));
+    }
+
+    return;
+}
+
+// Tests that the batched operations match the single ones
+TEST_CASE(__FILE__"/Batched", "[Matrix3x3]")
+{
+    // Not a multiple of four, to cover the tail
+    std::vector<Matrix3x3> a;
+    std::vector<Matrix3x3> b;
+    while (a.size() < 103)
+    {
+        const Matrix3x3 m(RandomMatrix(rng, 10));
+        if (std::abs(m.Determinant()) < 1)
+            continue;
+
+        a.push_back(m);
+        b.push_back(Matrix3x3(RandomMatrix(rng, 10)));
+    }
+
+    std::vector<Matrix3x3> products;
+    Matrix3x3::Multiply(a, b, products);
+    REQUIRE(products.size() == a.size());
+
+    std::vector<Matrix3x3> inverses;
+    Matrix3x3::Inverse(a, inverses);
+    REQUIRE(inverses.size() == a.size());
+
+    for (std::size_t i = 0; i < a.size(); i++)
+    {
+        REQUIRE(products[i].Similar(a[i] * b[i], 1e-9));
+        REQUIRE(inverses[i].Similar(a[i].Inverse(), 1e-9));
+    }
+
+    // Sizes differ
+    b.pop_back();
+    REQUIRE_THROWS_AS(Matrix3x3::Multiply(a, b, products), std::invalid_argument);
+
+    // A singular matrix among them
+    a[5][1] = { 0, 0, 0 };
+    REQUIRE_THROWS_AS(Matrix3x3::Inverse(a, inverses), std::runtime_error);
+
+    return;
+}
@@ -0,0 +1,246 @@
+#include "Catch2.h"
+#include <Eule/MatrixDecomposition.h>
+#include "TestingUtilities/Fixtures.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+
+    Matrix4x4 RandomSymmetric(double scale)
+    {
+        Matrix4x4 m = RandomMatrix(rng, scale);
+        for (std::size_t y = 0; y < 3; y++)
+            for (std::size_t x = 0; x < y; x++)
+                m[y][x] = m[x][y];
+
+        return m;
+    }
+
+    // Computes a * diag(d) * b^T, on the 3x3 components
+    Matrix4x4 Compose(const Matrix4x4& a, const Vector3d& d, const Matrix4x4& b)
+    {
+        Matrix4x4 m;
+        for (std::size_t y = 0; y < 3; y++)
+            for (std::size_t x = 0; x < 3; x++)
+            {
+                m[y][x] = 0;
+                for (std::size_t k = 0; k < 3; k++)
+                    m[y][x] += a[y][k] * d[k] * b[x][k];
+            }
+
+        return m;
+    }
+
+    bool IsRotation(const Matrix4x4& m)
+    {
+        return Compose(m, Vector3d(1, 1, 1), m).Similar(Matrix4x4(), 1e-9) && (std::abs(m.Determinant(3) - 1) < 1e-9);
+    }
+
+    // Tests that a matrix is reconstructed from its decomposition, which has the promised properties
+    void CheckSVD(const Matrix4x4& m, const Matrix4x4& u, const Vector3d& sigma, const Matrix4x4& v)
+    {
+        REQUIRE(IsRotation(u));
+        REQUIRE(IsRotation(v));
+        REQUIRE(Compose(u, sigma, v).Similar(m, 1e-9));
+
+        REQUIRE(sigma.x >= 0);
+        REQUIRE(sigma.y >= 0);
+        REQUIRE(sigma.x >= sigma.y - 1e-9);
+        REQUIRE(sigma.y >= std::abs(sigma.z) - 1e-9);
+
+        if (std::abs(m.Determinant(3)) > 1e-6)
+            REQUIRE((sigma.z < 0) == (m.Determinant(3) < 0));
+
+        return;
+    }
+}
+
+// Tests that diagonal matrices decompose into their sorted diagonal
+TEST_CASE(__FILE__"/Eigen_Diagonal", "[MatrixDecomposition]")
+{
+    Matrix4x4 m;
+    m[0][0] = -2;
+    m[1][1] = 5;
+    m[2][2] = 1;
+
+    Vector3d eigenvalues;
+    Matrix4x4 eigenvectors;
+    MatrixDecomposition::SymmetricEigen(m, eigenvalues, eigenvectors);
+
+    REQUIRE(eigenvalues == Vector3d(5, 1, -2));
+    REQUIRE(IsRotation(eigenvectors));
+    REQUIRE(std::abs(eigenvectors[1][0]) == 1);
+    REQUIRE(std::abs(eigenvectors[2][1]) == 1);
+    REQUIRE(std::abs(eigenvectors[0][2]) == 1);
+
+    return;
+}
+
+// Tests that random symmetric matrices get reconstructed from their eigenvectors and eigenvalues
+TEST_CASE(__FILE__"/Eigen_Random", "[MatrixDecomposition]")
+{
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const Matrix4x4 m = RandomSymmetric(10);
+
+        Vector3d eigenvalues;
+        Matrix4x4 eigenvectors;
+        MatrixDecomposition::SymmetricEigen(m, eigenvalues, eigenvectors);
+
+        REQUIRE(IsRotation(eigenvectors));
+        REQUIRE(Compose(eigenvectors, eigenvalues, eigenvectors).Similar(m, 1e-9));
+        REQUIRE(eigenvalues.x >= eigenvalues.y);
+        REQUIRE(eigenvalues.y >= eigenvalues.z);
+
+        // Everything but the 3x3 component is that of the identity
+        REQUIRE(eigenvectors[3][3] == 1);
+        REQUIRE(eigenvectors[0][3] == 0);
+    }
+
+    return;
+}
+
+// Tests that repeated eigenvalues still yield orthogonal eigenvectors
+TEST_CASE(__FILE__"/Eigen_Repeated", "[MatrixDecomposition]")
+{
+    // A rotated diag(3, 3, 1)
+    Matrix4x4 rotation;
+    Vector3d unused;
+    MatrixDecomposition::SymmetricEigen(RandomSymmetric(1), unused, rotation);
+    const Matrix4x4 m = Compose(rotation, Vector3d(3, 3, 1), rotation);
+
+    Vector3d eigenvalues;
+    Matrix4x4 eigenvectors;
+    MatrixDecomposition::SymmetricEigen(m, eigenvalues, eigenvectors);
+
+    REQUIRE(eigenvalues.Similar(Vector3d(3, 3, 1), 1e-9));
+    REQUIRE(IsRotation(eigenvectors));
+    REQUIRE(Compose(eigenvectors, eigenvalues, eigenvectors).Similar(m, 1e-9));
+
+    return;
+}
+
+// Tests the singular value decompositions of random matrices
+TEST_CASE(__FILE__"/SVD_Random", "[MatrixDecomposition]")
+{
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const Matrix4x4 m = RandomMatrix(rng, 10);
+
+        Matrix4x4 u;
+        Vector3d sigma;
+        Matrix4x4 v;
+        MatrixDecomposition::SVD(m, u, sigma, v);
+
+        CheckSVD(m, u, sigma, v);
+    }
+
+    return;
+}
+
+// Tests singular value decompositions of rotations, reflections and rank-deficient matrices
+TEST_CASE(__FILE__"/SVD_Special", "[MatrixDecomposition]")
+{
+    Matrix4x4 rotation;
+    Vector3d unused;
+    MatrixDecomposition::SymmetricEigen(RandomSymmetric(1), unused, rotation);
+
+    Matrix4x4 u;
+    Vector3d sigma;
+    Matrix4x4 v;
+
+    // Rotation
+    MatrixDecomposition::SVD(rotation, u, sigma, v);
+    CheckSVD(rotation, u, sigma, v);
+    REQUIRE(sigma.Similar(Vector3d(1, 1, 1), 1e-9));
+
+    // Reflection
+    const Matrix4x4 reflection = Compose(rotation, Vector3d(1, 1, -1), Matrix4x4());
+    MatrixDecomposition::SVD(reflection, u, sigma, v);
+    CheckSVD(reflection, u, sigma, v);
+    REQUIRE(sigma.Similar(Vector3d(1, 1, -1), 1e-9));
+
+    // Rank one
+    const Matrix4x4 rankOne = Compose(rotation, Vector3d(4, 0, 0), Matrix4x4());
+    MatrixDecomposition::SVD(rankOne, u, sigma, v);
+    CheckSVD(rankOne, u, sigma, v);
+    REQUIRE(sigma.Similar(Vector3d(4, 0, 0), 1e-9));
+
+    // Zero
+    Matrix4x4 zero;
+    zero[0][0] = zero[1][1] = zero[2][2] = 0;
+    MatrixDecomposition::SVD(zero, u, sigma, v);
+    CheckSVD(zero, u, sigma, v);
+    REQUIRE(sigma == Vector3d(0, 0, 0));
+
+    return;
+}
+
+// Tests that polar decompositions yield a rotation and a symmetric stretch
+TEST_CASE(__FILE__"/Polar", "[MatrixDecomposition]")
+{
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const Matrix4x4 m = RandomMatrix(rng, 10);
+
+        Matrix4x4 rotation;
+        Matrix4x4 stretch;
+        MatrixDecomposition::Polar(m, rotation, stretch);
+
+        REQUIRE(IsRotation(rotation));
+        REQUIRE(stretch.Similar(stretch.Transpose3x3(), 1e-9));
+        REQUIRE(Compose(rotation, Vector3d(1, 1, 1), stretch.Transpose3x3()).Similar(m, 1e-9));
+    }
+
+    return;
+}
+
+// Tests that batches decompose like single matrices, for amounts not divisible by four
+TEST_CASE(__FILE__"/Batched", "[MatrixDecomposition]")
+{
+    std::vector<Matrix4x4> matrices;
+    std::vector<Matrix4x4> symmetric;
+    for (std::size_t i = 0; i < 10007; i++)
+    {
+        matrices.push_back(RandomMatrix(rng, 10));
+        symmetric.push_back(RandomSymmetric(10));
+    }
+
+    for (std::size_t threads : { 1, 3 })
+    {
+        std::vector<Vector3d> eigenvalues;
+        std::vector<Matrix4x4> eigenvectors;
+        MatrixDecomposition::SymmetricEigen(symmetric, eigenvalues, eigenvectors, threads);
+
+        std::vector<Matrix4x4> u;
+        std::vector<Vector3d> sigma;
+        std::vector<Matrix4x4> v;
+        MatrixDecomposition::SVD(matrices, u, sigma, v, threads);
+
+        REQUIRE(eigenvalues.size() == symmetric.size());
+        REQUIRE(sigma.size() == matrices.size());
+
+        for (std::size_t i = 0; i < matrices.size(); i++)
+        {
+            Vector3d expectedValues;
+            Matrix4x4 expectedVectors;
+            MatrixDecomposition::SymmetricEigen(symmetric[i], expectedValues, expectedVectors);
+            REQUIRE(eigenvalues[i].Similar(expectedValues, 1e-9));
+            REQUIRE(eigenvectors[i].Similar(expectedVectors, 1e-9));
+
+            Matrix4x4 expectedU;
+            Vector3d expectedSigma;
+            Matrix4x4 expectedV;
+            MatrixDecomposition::SVD(matrices[i], expectedU, expectedSigma, expectedV);
+            REQUIRE(sigma[i].Similar(expectedSigma, 1e-9));
+            REQUIRE(u[i].Similar(expectedU, 1e-9));
+            REQUIRE(v[i].Similar(expectedV, 1e-9));
+        }
+    }
+
+    return;
+}
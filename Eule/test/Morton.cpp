@@ -0,0 +1,187 @@
+#include "Catch2.h"
+#include <Eule/Morton.h>
+#include "TestingUtilities/Fixtures.h"
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+
+    // A random component within the range of 3d codes
+    int RandomComponent3()
+    {
+        return (int)(rng() % (1u << 21)) - (1 << 20);
+    }
+}
+
+// Tests that bits get interleaved x first, then y, then z
+TEST_CASE(__FILE__"/Interleaves_Bits", "[Morton]")
+{
+    // x = 0b101, y = 0b011, z = 0 -> bits 0 and 6 from x, bits 1 and 4 from y
+    const int bias3 = 1 << 20;
+    REQUIRE(Morton::Encode(Vector3i(5 - bias3, 3 - bias3, -bias3)) == 0b1010011);
+
+    // x = 0b10, y = 0b11 -> bits 2 from x, bits 1 and 3 from y
+    REQUIRE(Morton::Encode(Vector2i(2 ^ INT32_MIN, 3 ^ INT32_MIN)) == 0b1110);
+
+    return;
+}
+
+// Tests that decoding restores encoded cells, including negative ones and the extremes
+TEST_CASE(__FILE__"/Round_Trip", "[Morton]")
+{
+    for (std::size_t i = 0; i < 10000; i++)
+    {
+        const Vector3i cell3(RandomComponent3(), RandomComponent3(), RandomComponent3());
+        REQUIRE(Morton::Decode3(Morton::Encode(cell3)) == cell3);
+
+        const Vector2i cell2((int)rng(), (int)rng());
+        REQUIRE(Morton::Decode2(Morton::Encode(cell2)) == cell2);
+    }
+
+    const Vector3i min3(-(1 << 20), -(1 << 20), -(1 << 20));
+    const Vector3i max3((1 << 20) - 1, (1 << 20) - 1, (1 << 20) - 1);
+    REQUIRE(Morton::Decode3(Morton::Encode(min3)) == min3);
+    REQUIRE(Morton::Decode3(Morton::Encode(max3)) == max3);
+    REQUIRE(Morton::Encode(min3) == 0);
+    REQUIRE(Morton::Encode(max3) == (1ull << 63) - 1);
+
+    const Vector2i min2(INT32_MIN, INT32_MIN);
+    const Vector2i max2(INT32_MAX, INT32_MAX);
+    REQUIRE(Morton::Decode2(Morton::Encode(min2)) == min2);
+    REQUIRE(Morton::Decode2(Morton::Encode(max2)) == max2);
+
+    return;
+}
+
+// Tests that increasing any single component increases the code
+TEST_CASE(__FILE__"/Keeps_Order_Along_Axes", "[Morton]")
+{
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const Vector3i cell(RandomComponent3() / 2, RandomComponent3() / 2, RandomComponent3() / 2);
+        const int step = 1 + rng() % 1000;
+
+        REQUIRE(Morton::Encode(Vector3i(cell.x + step, cell.y, cell.z)) > Morton::Encode(cell));
+        REQUIRE(Morton::Encode(Vector3i(cell.x, cell.y + step, cell.z)) > Morton::Encode(cell));
+        REQUIRE(Morton::Encode(Vector3i(cell.x, cell.y, cell.z + step)) > Morton::Encode(cell));
+
+        const Vector2i cell2((int)rng() / 2, (int)rng() / 2);
+        REQUIRE(Morton::Encode(Vector2i(cell2.x + step, cell2.y)) > Morton::Encode(cell2));
+        REQUIRE(Morton::Encode(Vector2i(cell2.x, cell2.y + step)) > Morton::Encode(cell2));
+    }
+
+    return;
+}
+
+// Tests that points get quantized into the cell they lie in, and that batches equal single points
+TEST_CASE(__FILE__"/Quantized_Points", "[Morton]")
+{
+    const AABB bounds { Vector3d(-10, -20, 0), Vector3d(10, 20, 5) };
+    const Vector3d cellSize = (bounds.max - bounds.min) * (1.0 / (double)Morton::CELLS_3D);
+
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 1001; i++)
+        points.push_back(RandomVector(rng, 25));
+
+    // Corners and points outside
+    points.push_back(bounds.min);
+    points.push_back(bounds.max);
+    points.push_back(Vector3d(-100, 100, 2));
+
+    std::vector<std::uint64_t> codes;
+    Morton::Encode(points, bounds, codes);
+    REQUIRE(codes.size() == points.size());
+
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        REQUIRE(codes[i] == Morton::Encode(points[i], bounds));
+
+        // The decoded cell center is at most half a cell away from the (clamped) point
+        const Vector3d center = Morton::Decode(codes[i], bounds);
+        for (std::size_t axis = 0; axis < 3; axis++)
+        {
+            const double clamped = std::min(std::max(points[i][axis], bounds.min[axis]), bounds.max[axis]);
+            REQUIRE(std::abs(center[axis] - clamped) <= cellSize[axis] * 0.5 + 1e-9);
+        }
+    }
+
+    return;
+}
+
+// Tests that radix sorting orders codes, stably, and independently of the amount of threads
+TEST_CASE(__FILE__"/Radix_Sort", "[Morton]")
+{
+    std::vector<std::uint64_t> codes;
+    for (std::size_t i = 0; i < 300000; i++)
+        codes.push_back(((std::uint64_t)rng() << 32 | rng()) >> (rng() % 64));
+
+    // Plenty of duplicates, to test for stability
+    for (std::size_t i = 0; i < 50000; i++)
+        codes.push_back(codes[rng() % codes.size()]);
+
+    std::vector<std::uint64_t> expected = codes;
+    std::stable_sort(expected.begin(), expected.end());
+
+    const std::vector<std::uint64_t> original = codes;
+
+    std::vector<std::size_t> permutation;
+    Morton::Sort(codes, permutation, 1);
+    REQUIRE(codes == expected);
+
+    for (std::size_t i = 0; i < codes.size(); i++)
+    {
+        REQUIRE(original[permutation[i]] == codes[i]);
+
+        if ((i > 0) && (codes[i] == codes[i - 1]))
+            REQUIRE(permutation[i] > permutation[i - 1]);
+    }
+
+    std::vector<std::uint64_t> parallelCodes = original;
+    std::vector<std::size_t> parallelPermutation;
+    Morton::Sort(parallelCodes, parallelPermutation, 4);
+    REQUIRE(parallelCodes == codes);
+    REQUIRE(parallelPermutation == permutation);
+
+    return;
+}
+
+// Tests that sorting points moves their payload along with them
+TEST_CASE(__FILE__"/Sort_Points_With_Payload", "[Morton]")
+{
+    std::vector<Vector3d> points;
+    std::vector<std::size_t> payload;
+    for (std::size_t i = 0; i < 5000; i++)
+    {
+        points.push_back(RandomVector(rng, 100));
+        payload.push_back(i);
+    }
+
+    const std::vector<Vector3d> original = points;
+    Morton::Sort(points, payload, 2);
+
+    for (std::size_t i = 0; i < points.size(); i++)
+        REQUIRE(points[i] == original[payload[i]]);
+
+    // Codes within the points' own bounds are now ascending
+    AABB bounds { original[0], original[0] };
+    for (const Vector3d& p : original)
+        for (std::size_t axis = 0; axis < 3; axis++)
+        {
+            bounds.min[axis] = std::min(bounds.min[axis], p[axis]);
+            bounds.max[axis] = std::max(bounds.max[axis], p[axis]);
+        }
+
+    std::vector<std::uint64_t> codes;
+    Morton::Encode(points, bounds, codes);
+    REQUIRE(std::is_sorted(codes.begin(), codes.end()));
+
+    payload.pop_back();
+    REQUIRE_THROWS_AS(Morton::Sort(points, payload), std::invalid_argument);
+
+    return;
+}
@@ -0,0 +1,212 @@
+#include "Catch2.h"
+#include <Eule/OBB.h>
+#include <Eule/Overlap.h>
+#include <Eule/Quaternion.h>
+#include "TestingUtilities/Fixtures.h"
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+
+    OBB RandomBox(double scale)
+    {
+        const Vector3d halfSize = Vector3d(0.2, 0.2, 0.2) + Vector3d(rng() % 100, rng() % 100, rng() % 100) * (scale / 100.0);
+        return OBB(RandomVector(rng, 10), halfSize, RandomRotation(rng).ToRotationMatrix());
+    }
+
+    // Points inside a box, plus its corners
+    std::vector<Vector3d> SampleBox(const OBB& box, std::size_t count)
+    {
+        std::vector<Vector3d> points;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const Vector3d local = RandomVector(rng, 1);
+            points.push_back(box.GetCenter()
+                + box.GetAxis(0) * (local.x * box.GetHalfSize().x)
+                + box.GetAxis(1) * (local.y * box.GetHalfSize().y)
+                + box.GetAxis(2) * (local.z * box.GetHalfSize().z));
+        }
+
+        for (std::size_t i = 0; i < 8; i++)
+            points.push_back(box.GetCorner(i));
+
+        return points;
+    }
+}
+
+// Tests that invalid boxes throw
+TEST_CASE(__FILE__"/Invalid_Arguments", "[OBB]")
+{
+    REQUIRE_THROWS_AS(OBB(Vector3d(0, 0, 0), Vector3d(1, -1, 1)), std::invalid_argument);
+    REQUIRE_THROWS_AS(OBB().SetHalfSize(Vector3d(0, 0, -0.1)), std::invalid_argument);
+    REQUIRE_THROWS_AS(OBB::Fit(std::vector<Vector3d>()), std::invalid_argument);
+
+    return;
+}
+
+// Tests that boxes constructed from axis-aligned boxes span the same space
+TEST_CASE(__FILE__"/From_AABB", "[OBB]")
+{
+    const OBB box(AABB { Vector3d(-1, 2, 3), Vector3d(3, 4, 9) });
+
+    REQUIRE(box.GetCenter() == Vector3d(1, 3, 6));
+    REQUIRE(box.GetHalfSize() == Vector3d(2, 1, 3));
+    REQUIRE(box.GetVolume() == 48);
+    REQUIRE(box.GetCorner(TrapazoidalPrismCollider::FRONT | TrapazoidalPrismCollider::RIGHT) == Vector3d(3, 2, 9));
+
+    const AABB bounds = box.GetBounds();
+    REQUIRE(bounds.min == Vector3d(-1, 2, 3));
+    REQUIRE(bounds.max == Vector3d(3, 4, 9));
+
+    REQUIRE(box.Contains(Vector3d(2.9, 3.9, 8.9)));
+    REQUIRE_FALSE(box.Contains(Vector3d(3.1, 3, 6)));
+
+    return;
+}
+
+// Tests that boxes converted to prisms describe the same space, for right- and left-handed axes
+TEST_CASE(__FILE__"/To_Prism", "[OBB]")
+{
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        OBB box = RandomBox(3);
+
+        // Mirror every second box
+        if (i % 2)
+        {
+            Matrix4x4 rotation = box.GetRotation();
+            for (std::size_t y = 0; y < 3; y++)
+                rotation[y][2] = -rotation[y][2];
+            box.SetRotation(rotation);
+        }
+
+        const TrapazoidalPrismCollider prism = box.ToPrism();
+
+        const AABB bounds = box.GetBounds();
+        const AABB prismBounds = prism.GetBounds();
+        REQUIRE(bounds.min.Similar(prismBounds.min, 1e-9));
+        REQUIRE(bounds.max.Similar(prismBounds.max, 1e-9));
+
+        for (std::size_t j = 0; j < 1000; j++)
+        {
+            const Vector3d point = box.GetCenter() + RandomVector(rng, 6);
+
+            // Skip points right on the surface, which may round either way
+            if (std::abs(prism.SignedDistance(point)) < 1e-9)
+                continue;
+
+            REQUIRE(box.Contains(point) == prism.Contains(point));
+        }
+    }
+
+    return;
+}
+
+// Tests distances, closest points and support points against the equivalent prism
+TEST_CASE(__FILE__"/Distance_Queries", "[OBB]")
+{
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        const OBB box = RandomBox(3);
+        const TrapazoidalPrismCollider prism = box.ToPrism();
+
+        for (std::size_t j = 0; j < 100; j++)
+        {
+            const Vector3d point = box.GetCenter() + RandomVector(rng, 6);
+
+            REQUIRE(box.SignedDistance(point) == Approx(prism.SignedDistance(point)).margin(1e-9));
+            REQUIRE(box.ClosestPoint(point).Similar(prism.ClosestPoint(point), 1e-9));
+
+            const Vector3d direction = RandomVector(rng, 1);
+            REQUIRE(box.SupportPoint(direction).DotProduct(direction) == Approx(prism.SupportPoint(direction).DotProduct(direction)).margin(1e-9));
+        }
+    }
+
+    return;
+}
+
+// Tests that batched containment equals testing each point
+TEST_CASE(__FILE__"/Contains_Batched", "[OBB]")
+{
+    const OBB box = RandomBox(5);
+
+    std::vector<Vector3d> points;
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < 10003; i++)
+    {
+        points.push_back(box.GetCenter() + RandomVector(rng, 8));
+        if (box.Contains(points.back()))
+            expected.push_back(i);
+    }
+
+    std::vector<std::size_t> found;
+    box.Contains(points, found);
+
+    REQUIRE(!expected.empty());
+    REQUIRE(found == expected);
+
+    return;
+}
+
+// Tests overlaps of boxes against the separating axis test of prisms, one by one and batched
+TEST_CASE(__FILE__"/Intersects", "[OBB]")
+{
+    for (std::size_t i = 0; i < 20; i++)
+    {
+        const OBB box = RandomBox(4);
+        const TrapazoidalPrismCollider prism = box.ToPrism();
+
+        std::vector<OBB> others;
+        std::vector<std::size_t> expected;
+        for (std::size_t j = 0; j < 103; j++)
+        {
+            others.push_back(RandomBox(4));
+
+            const bool overlapping = Overlap::SAT(prism, others.back().ToPrism());
+            REQUIRE(box.Intersects(others.back()) == overlapping);
+            REQUIRE(others.back().Intersects(box) == overlapping);
+
+            if (overlapping)
+                expected.push_back(j);
+        }
+
+        std::vector<std::size_t> found;
+        box.Intersects(others, found);
+        REQUIRE(found == expected);
+    }
+
+    // Identical, and parallel touching boxes
+    const OBB box(Vector3d(0, 0, 0), Vector3d(1, 1, 1), RandomRotation(rng).ToRotationMatrix());
+    REQUIRE(box.Intersects(box));
+    REQUIRE(box.Intersects(OBB(box.GetAxis(0) * 2, Vector3d(1, 1, 1), box.GetRotation())));
+    REQUIRE_FALSE(box.Intersects(OBB(box.GetAxis(0) * 2.01, Vector3d(1, 1, 1), box.GetRotation())));
+
+    return;
+}
+
+// Tests that fitted boxes contain all points, and are about as small as the boxes the points were sampled in
+TEST_CASE(__FILE__"/Fit", "[OBB]")
+{
+    for (std::size_t i = 0; i < 20; i++)
+    {
+        // Every second box is square in one plane, where principal axes alone can't tell its orientation
+        const Vector3d halfSize = (i % 2) ? Vector3d(4, 4, 1) : Vector3d(5, 2, 0.5);
+        const OBB source(RandomVector(rng, 100), halfSize, RandomRotation(rng).ToRotationMatrix());
+        const std::vector<Vector3d> points = SampleBox(source, 20000);
+
+        const OBB fitted = OBB::Fit(points, 2);
+
+        for (const Vector3d& point : points)
+            REQUIRE(fitted.SignedDistance(point) <= 1e-9);
+
+        REQUIRE(fitted.GetVolume() >= source.GetVolume() * (1 - 1e-9));
+        REQUIRE(fitted.GetVolume() <= source.GetVolume() * 1.1);
+    }
+
+    return;
+}
@@ -0,0 +1,147 @@
+#include "Catch2.h"
+#include <Eule/OccupancyGrid.h>
+#include <Eule/Quaternion.h>
+#include "TestingUtilities/Fixtures.h"
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+using TPC = TrapazoidalPrismCollider;
+using STATE = OccupancyGrid::STATE;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+
+    // Creates a truncated pyramid, whose top face is smaller than its bottom face
+    TPC MakeTruncatedPyramid(const Vector3d& center, double size, const Quaternion& rotation)
+    {
+        TPC tpc;
+        for (std::size_t i = 0; i < 8; i++)
+        {
+            const double halfSize = (i & TPC::TOP) ? size * 0.4 : size;
+            const Vector3d corner(
+                (i & TPC::RIGHT) ? halfSize : -halfSize,
+                (i & TPC::TOP)   ? size : -size,
+                (i & TPC::FRONT) ? halfSize : -halfSize
+            );
+            tpc.SetVertex(i, (rotation * corner) + center);
+        }
+
+        return tpc;
+    }
+
+    std::vector<TPC> RandomPrisms(std::size_t count)
+    {
+        std::vector<TPC> prisms;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const Quaternion rotation = RandomRotation(rng);
+
+            if (i % 2)
+                prisms.push_back(MakeBox(RandomVector(rng, 10), Vector3d(1, 1, 1) + Vector3d(rng() % 4, rng() % 4, rng() % 4), rotation));
+            else
+                prisms.push_back(MakeTruncatedPyramid(RandomVector(rng, 10), 1 + rng() % 4, rotation));
+        }
+
+        return prisms;
+    }
+}
+
+// Tests that invalid grids throw
+TEST_CASE(__FILE__"/Invalid_Arguments", "[OccupancyGrid]")
+{
+    const AABB bounds { Vector3d(0, 0, 0), Vector3d(1, 1, 1) };
+
+    REQUIRE_THROWS_AS(OccupancyGrid(bounds, 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(OccupancyGrid(AABB { bounds.max, bounds.min }, 0.1), std::invalid_argument);
+
+    const OccupancyGrid grid(bounds, 0.25);
+    REQUIRE(grid.GetDimensions() == Vector3i(4, 4, 4));
+    REQUIRE_THROWS_AS(grid.GetState(Vector3i(4, 0, 0)), std::out_of_range);
+    REQUIRE_THROWS_AS(grid.GetState(Vector3i(0, -1, 0)), std::out_of_range);
+
+    return;
+}
+
+// Tests the states of a box aligned with the voxels. Voxels merely touching its faces count as boundary
+TEST_CASE(__FILE__"/Aligned_Box", "[OccupancyGrid]")
+{
+    OccupancyGrid grid(AABB { Vector3d(-2, -2, -2), Vector3d(6, 6, 6) }, 1);
+    grid.Add(MakeBox(Vector3d(2, 2, 2), Vector3d(2, 2, 2), Quaternion()));
+
+    REQUIRE(grid.GetDimensions() == Vector3i(8, 8, 8));
+
+    // Voxels are half-open, so the box [0, 4] touches voxels 2 to 6. Only 3 and 4 are entirely inside
+    REQUIRE(grid.Count(STATE::INSIDE) == 8);
+    REQUIRE(grid.Count(STATE::BOUNDARY) == 5 * 5 * 5 - 8);
+    REQUIRE(grid.Count(STATE::OUTSIDE) == 8 * 8 * 8 - 5 * 5 * 5);
+
+    REQUIRE(grid.GetState(Vector3i(3, 4, 3)) == STATE::INSIDE);
+    REQUIRE(grid.GetState(Vector3i(2, 3, 3)) == STATE::BOUNDARY);
+    REQUIRE(grid.GetState(Vector3i(6, 3, 3)) == STATE::BOUNDARY);
+    REQUIRE(grid.GetState(Vector3i(1, 3, 3)) == STATE::OUTSIDE);
+
+    return;
+}
+
+// Tests that the classification is conservative: inside voxels are fully inside, outside voxels fully outside
+TEST_CASE(__FILE__"/Conservative", "[OccupancyGrid]")
+{
+    const std::vector<TPC> prisms = RandomPrisms(6);
+
+    OccupancyGrid grid(AABB { Vector3d(-15, -15, -15), Vector3d(15, 15, 15) }, 0.5);
+    grid.Add(prisms);
+
+    REQUIRE(grid.Count(STATE::INSIDE) > 0);
+    REQUIRE(grid.Count(STATE::BOUNDARY) > 0);
+
+    for (std::size_t i = 0; i < 100000; i++)
+    {
+        const Vector3d point = RandomVector(rng, 14.9);
+        const STATE state = grid.GetState(grid.VoxelOf(point));
+
+        bool contained = false;
+        for (const TPC& tpc : prisms)
+            contained |= tpc.Contains(point);
+
+        if (state == STATE::INSIDE)
+            REQUIRE(contained);
+        else if (state == STATE::OUTSIDE)
+            REQUIRE_FALSE(contained);
+    }
+
+    return;
+}
+
+// Tests that containment equals testing all prisms exactly, inside the grid and outside of it
+TEST_CASE(__FILE__"/Contains", "[OccupancyGrid]")
+{
+    const std::vector<TPC> prisms = RandomPrisms(8);
+
+    // The grid covers only part of the prisms
+    OccupancyGrid grid(AABB { Vector3d(-8, -8, -8), Vector3d(8, 8, 8) }, 0.3);
+    grid.Add(prisms);
+
+    std::vector<Vector3d> points;
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < 50000; i++)
+    {
+        points.push_back(RandomVector(rng, 16));
+
+        bool contained = false;
+        for (const TPC& tpc : prisms)
+            contained |= tpc.Contains(points.back());
+
+        REQUIRE(grid.Contains(points.back()) == contained);
+
+        if (contained)
+            expected.push_back(i);
+    }
+
+    std::vector<std::size_t> found;
+    grid.Contains(points, found);
+    REQUIRE(found == expected);
+
+    return;
+}
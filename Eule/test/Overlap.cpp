@@ -0,0 +1,297 @@
+#include "Catch2.h"
+#include <Eule/Overlap.h>
+#include <Eule/Frustum.h>
+#include <Eule/Quaternion.h>
+#include <Eule/Math.h>
+#include "TestingUtilities/Fixtures.h"
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+using TPC = TrapazoidalPrismCollider;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+
+    Vector3d RandomHalfSize()
+    {
+        return Vector3d(0.2, 0.2, 0.2) + Vector3d(rng() % 1000, rng() % 1000, rng() % 1000) * 0.002;
+    }
+
+    //! A convex collider with a smooth surface
+    class SphereCollider : public Collider
+    {
+    public:
+        SphereCollider(const Vector3d& center, double radius) : center { center }, radius { radius }
+        {
+            return;
+        }
+
+        bool Contains(const Vector3d& point) const override
+        {
+            return (point - center).SqrMagnitude() <= radius * radius;
+        }
+
+        Vector3d SupportPoint(const Vector3d& direction) const override
+        {
+            return center + direction.Normalize() * radius;
+        }
+
+        Vector3d center;
+        double radius;
+    };
+
+    //! A collider that does not provide a support point
+    class PointlessCollider : public Collider
+    {
+    public:
+        bool Contains(const Vector3d&) const override
+        {
+            return false;
+        }
+    };
+}
+
+// Tests the separating axis test on axis-aligned boxes
+TEST_CASE(__FILE__"/SAT_Axis_Aligned", "[Overlap][TrapazoidalPrismCollider]")
+{
+    const TPC a = MakeBox(Vector3d(0, 0, 0), 1);
+
+    REQUIRE(Overlap::SAT(a, MakeBox(Vector3d(0, 0, 0), 1)));
+    REQUIRE(Overlap::SAT(a, MakeBox(Vector3d(0, 0, 0), 0.25)));
+    REQUIRE(Overlap::SAT(a, MakeBox(Vector3d(1.5, -1.5, 0.5), 1)));
+
+    // Touching counts
+    REQUIRE(Overlap::SAT(a, MakeBox(Vector3d(2, 0, 0), 1)));
+    REQUIRE(Overlap::SAT(a, MakeBox(Vector3d(2, 2, 2), 1)));
+
+    REQUIRE_FALSE(Overlap::SAT(a, MakeBox(Vector3d(2.01, 0, 0), 1)));
+    REQUIRE_FALSE(Overlap::SAT(a, MakeBox(Vector3d(0, -3, 0), 1)));
+    REQUIRE_FALSE(Overlap::SAT(a, MakeBox(Vector3d(1.5, 1.5, 2.5), 1)));
+
+    return;
+}
+
+// Tests two boxes crossing each other, without any vertex of one being inside the other
+TEST_CASE(__FILE__"/SAT_Crossing_Without_Contained_Vertices", "[Overlap][TrapazoidalPrismCollider]")
+{
+    const TPC a = MakeBox(Vector3d(0, 0, 0), Vector3d(5, 1, 1), Quaternion());
+    const TPC b = MakeBox(Vector3d(0, 0, 0), Vector3d(1, 5, 1), Quaternion());
+
+    for (std::size_t i = 0; i < 8; i++)
+    {
+        REQUIRE_FALSE(a.Contains(b.GetVertex(i)));
+        REQUIRE_FALSE(b.Contains(a.GetVertex(i)));
+    }
+
+    REQUIRE(Overlap::SAT(a, b));
+    REQUIRE(Overlap::GJK(a, b));
+
+    return;
+}
+
+// Tests that two rotated boxes, only separable by the cross product of two edges, are separated
+TEST_CASE(__FILE__"/SAT_Edge_Edge_Separation", "[Overlap][TrapazoidalPrismCollider]")
+{
+    // Two long bars crossing above each other: a along x, b along y, both rotated 45 deg around their long axis.
+    // Their closest features are two edges. Only the vertical axis (their cross product) separates them,
+    // because the bars' face normals are all tilted.
+    const TPC a = MakeBox(Vector3d(0, 0, 0), Vector3d(5, 1, 1), Quaternion(Vector3d(45, 0, 0)));
+    const TPC b = MakeBox(Vector3d(0, 0, 2 * sqrt(2.0) + 0.01), Vector3d(1, 5, 1), Quaternion(Vector3d(0, 45, 0)));
+
+    REQUIRE_FALSE(Overlap::SAT(a, b));
+    REQUIRE_FALSE(Overlap::GJK(a, b));
+
+    const TPC c = MakeBox(Vector3d(0, 0, 2 * sqrt(2.0) - 0.01), Vector3d(1, 5, 1), Quaternion(Vector3d(0, 45, 0)));
+    REQUIRE(Overlap::SAT(a, c));
+    REQUIRE(Overlap::GJK(a, c));
+
+    return;
+}
+
+// Tests that SAT and GJK agree on random pairs of rotated boxes
+TEST_CASE(__FILE__"/SAT_Equals_GJK", "[Overlap][TrapazoidalPrismCollider]")
+{
+    std::size_t overlapping = 0;
+
+    for (std::size_t i = 0; i < 2000; i++)
+    {
+        const Vector3d centerA = RandomVector(rng, 2);
+        const Vector3d centerB = RandomVector(rng, 2);
+        const Vector3d halfA = RandomHalfSize();
+        const Vector3d halfB = RandomHalfSize();
+        const Quaternion rotA = RandomRotation(rng);
+        const Quaternion rotB = RandomRotation(rng);
+
+        const TPC a = MakeBox(centerA, halfA, rotA);
+        const TPC b = MakeBox(centerB, halfB, rotB);
+
+        // Skip pairs that are too close to touching to tell
+        if (Overlap::SAT(MakeBox(centerA, halfA * 0.999, rotA), MakeBox(centerB, halfB * 0.999, rotB)) !=
+            Overlap::SAT(MakeBox(centerA, halfA * 1.001, rotA), MakeBox(centerB, halfB * 1.001, rotB)))
+            continue;
+
+        const bool sat = Overlap::SAT(a, b);
+        INFO("A: " << centerA << halfA << rotA << "  B: " << centerB << halfB << rotB);
+        REQUIRE(sat == Overlap::GJK(a, b));
+        REQUIRE(sat == Overlap::GJK(b, a));
+
+        if (sat)
+            overlapping++;
+    }
+
+    // Make sure both outcomes got tested
+    REQUIRE(overlapping > 100);
+    REQUIRE(overlapping < 1900);
+
+    return;
+}
+
+// Tests that batched SAT yields the same pairs as single tests
+TEST_CASE(__FILE__"/SAT_Batched_Equals_Single", "[Overlap][TrapazoidalPrismCollider]")
+{
+    std::vector<TPC> colliders;
+    for (std::size_t i = 0; i < 50; i++)
+        colliders.push_back(MakeBox(RandomVector(rng, 3), RandomHalfSize(), RandomRotation(rng)));
+
+    std::vector<std::pair<std::size_t, std::size_t>> pairs;
+    for (std::size_t i = 0; i < colliders.size(); i++)
+        for (std::size_t j = i + 1; j < colliders.size(); j++)
+            pairs.emplace_back(i, j);
+
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < pairs.size(); i++)
+        if (Overlap::SAT(colliders[pairs[i].first], colliders[pairs[i].second]))
+            expected.push_back(i);
+
+    std::vector<std::size_t> batched;
+    Overlap::SAT(colliders, pairs, batched);
+    REQUIRE(batched == expected);
+
+    // The same goes for batched GJK
+    std::vector<const Collider*> pointers;
+    for (const TPC& collider : colliders)
+        pointers.push_back(&collider);
+
+    std::vector<std::size_t> gjk;
+    Overlap::GJK(pointers, pairs, gjk);
+    REQUIRE(gjk.size() > 0);
+
+    return;
+}
+
+// Tests that pairs referencing nonexistent colliders throw
+TEST_CASE(__FILE__"/Batched_Invalid_Pair_Throws", "[Overlap]")
+{
+    const std::vector<TPC> colliders(2, MakeBox(Vector3d(0, 0, 0), 1));
+    const std::vector<std::pair<std::size_t, std::size_t>> pairs = { {0, 1}, {1, 2} };
+    std::vector<std::size_t> out;
+
+    REQUIRE_THROWS_AS(Overlap::SAT(colliders, pairs, out), std::out_of_range);
+    REQUIRE_THROWS_AS(Overlap::GJK({ &colliders[0], &colliders[1] }, pairs, out), std::out_of_range);
+
+    return;
+}
+
+// Tests GJK between different kinds of colliders
+TEST_CASE(__FILE__"/GJK_Mixed_Colliders", "[Overlap][Frustum]")
+{
+    const Frustum cube;
+    const TPC box = MakeBox(Vector3d(0, 0, 0), 1);
+
+    REQUIRE(Overlap::GJK(cube, MakeBox(Vector3d(1.5, 0, 0), 0.6)));
+    REQUIRE_FALSE(Overlap::GJK(cube, MakeBox(Vector3d(1.5, 0, 0), 0.4)));
+
+    REQUIRE(Overlap::GJK(box, SphereCollider(Vector3d(2.5, 0, 0), 1.6)));
+    REQUIRE_FALSE(Overlap::GJK(box, SphereCollider(Vector3d(2.5, 0, 0), 1.4)));
+
+    // Sphere next to a box's corner, where it is outside the bounds along all three axes
+    REQUIRE_FALSE(Overlap::GJK(box, SphereCollider(Vector3d(2, 2, 2), 1.7)));
+    REQUIRE(Overlap::GJK(box, SphereCollider(Vector3d(2, 2, 2), 1.8)));
+
+    return;
+}
+
+// Tests that colliders without a support point throw
+TEST_CASE(__FILE__"/GJK_Without_Support_Point_Throws", "[Overlap]")
+{
+    const PointlessCollider pointless;
+    const TPC box = MakeBox(Vector3d(0, 0, 0), 1);
+
+    REQUIRE_THROWS_AS(Overlap::GJK(box, pointless), std::logic_error);
+
+    return;
+}
+
+// Tests the penetration of axis-aligned boxes
+TEST_CASE(__FILE__"/EPA_Axis_Aligned", "[Overlap][TrapazoidalPrismCollider]")
+{
+    const TPC a = MakeBox(Vector3d(0, 0, 0), 1);
+
+    Vector3d normal;
+    double depth;
+
+    REQUIRE(Overlap::EPA(a, MakeBox(Vector3d(1.75, 0.5, 0.2), 1), normal, depth));
+    REQUIRE(normal.Similar(Vector3d(1, 0, 0)));
+    REQUIRE(Math::Similar(depth, 0.25));
+
+    REQUIRE(Overlap::EPA(a, MakeBox(Vector3d(0.3, -1.5, -0.2), 1), normal, depth));
+    REQUIRE(normal.Similar(Vector3d(0, -1, 0)));
+    REQUIRE(Math::Similar(depth, 0.5));
+
+    // Concentric, where GJK ends on a degenerate simplex
+    REQUIRE(Overlap::EPA(a, MakeBox(Vector3d(0, 0, 0), 1), normal, depth));
+    REQUIRE(Math::Similar(depth, 2));
+
+    REQUIRE_FALSE(Overlap::EPA(a, MakeBox(Vector3d(0, 3, 0), 1), normal, depth));
+
+    return;
+}
+
+// Tests that moving b by the penetration just separates random pairs
+TEST_CASE(__FILE__"/EPA_Resolves_Penetration", "[Overlap][TrapazoidalPrismCollider]")
+{
+    std::size_t tested = 0;
+
+    while (tested < 200)
+    {
+        const Vector3d halfB = RandomHalfSize();
+        const Vector3d centerB = RandomVector(rng, 1);
+        const Quaternion rotB = RandomRotation(rng);
+
+        const TPC a = MakeBox(RandomVector(rng, 1), RandomHalfSize(), RandomRotation(rng));
+        const TPC b = MakeBox(centerB, halfB, rotB);
+
+        Vector3d normal;
+        double depth;
+        if (!Overlap::EPA(a, b, normal, depth))
+            continue;
+
+        INFO("Normal: " << normal << "  Depth: " << depth);
+        REQUIRE(Math::Similar(normal.SqrMagnitude(), 1));
+
+        REQUIRE_FALSE(Overlap::SAT(a, MakeBox(centerB + normal * (depth + 0.001), halfB, rotB)));
+        if (depth > 0.001)
+            REQUIRE(Overlap::SAT(a, MakeBox(centerB + normal * (depth - 0.001), halfB, rotB)));
+
+        tested++;
+    }
+
+    return;
+}
+
+// Tests penetration against a smooth collider
+TEST_CASE(__FILE__"/EPA_Sphere", "[Overlap]")
+{
+    const TPC box = MakeBox(Vector3d(0, 0, 0), 1);
+
+    Vector3d normal;
+    double depth;
+
+    REQUIRE(Overlap::EPA(box, SphereCollider(Vector3d(2.5, 0.2, -0.3), 1.6), normal, depth));
+    REQUIRE(normal.Similar(Vector3d(1, 0, 0), 0.001));
+    REQUIRE(Math::Similar(depth, 0.1, 0.001));
+
+    return;
+}
@@ -0,0 +1,169 @@
+#include "Catch2.h"
+#include <Eule/PointStatistics.h>
+#include "TestingUtilities/Fixtures.h"
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+
+    // Points stretched along the axes, and sheared, so that the covariance has off-diagonal terms
+    std::vector<Vector3d> RandomCloud(std::size_t count, const Vector3d& offset)
+    {
+        std::vector<Vector3d> points;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const Vector3d p = RandomVector(rng, 1);
+            points.push_back(Vector3d(3 * p.x, p.y + p.x, 0.5 * p.z - p.y) + offset);
+        }
+
+        return points;
+    }
+
+    // Straightforward two-pass covariance, in long double
+    Matrix4x4 ReferenceCovariance(const std::vector<Vector3d>& points, const Vector3d& offset, Vector3d& centroid)
+    {
+        long double mean[3] = { 0, 0, 0 };
+        for (const Vector3d& p : points)
+            for (std::size_t i = 0; i < 3; i++)
+                mean[i] += (long double)p[i] - offset[i];
+
+        for (std::size_t i = 0; i < 3; i++)
+            mean[i] /= points.size();
+
+        long double sums[3][3] = {};
+        for (const Vector3d& p : points)
+            for (std::size_t y = 0; y < 3; y++)
+                for (std::size_t x = 0; x < 3; x++)
+                    sums[y][x] += ((long double)p[y] - offset[y] - mean[y]) * ((long double)p[x] - offset[x] - mean[x]);
+
+        Matrix4x4 covariance;
+        for (std::size_t y = 0; y < 3; y++)
+        {
+            centroid[y] = (double)(mean[y] + offset[y]);
+            for (std::size_t x = 0; x < 3; x++)
+                covariance[y][x] = (double)(sums[y][x] / points.size());
+        }
+
+        return covariance;
+    }
+}
+
+// Tests that reducing no points throws
+TEST_CASE(__FILE__"/Empty", "[PointStatistics]")
+{
+    const std::vector<Vector3d> points;
+
+    REQUIRE_THROWS_AS(PointStatistics::Bounds(points), std::invalid_argument);
+    REQUIRE_THROWS_AS(PointStatistics::Centroid(points), std::invalid_argument);
+    REQUIRE_THROWS_AS(PointStatistics::Covariance(points), std::invalid_argument);
+
+    return;
+}
+
+// Tests the statistics of the corners of a box, which are known
+TEST_CASE(__FILE__"/Box_Corners", "[PointStatistics]")
+{
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 8; i++)
+        points.push_back(Vector3d((i & 1) ? 3 : 1, (i & 2) ? 2 : -2, (i & 4) ? 10 : 9));
+
+    const AABB bounds = PointStatistics::Bounds(points);
+    REQUIRE(bounds.min == Vector3d(1, -2, 9));
+    REQUIRE(bounds.max == Vector3d(3, 2, 10));
+
+    REQUIRE(PointStatistics::Centroid(points) == Vector3d(2, 0, 9.5));
+
+    Vector3d centroid;
+    const Matrix4x4 covariance = PointStatistics::Covariance(points, centroid);
+    REQUIRE(centroid == Vector3d(2, 0, 9.5));
+
+    Matrix4x4 expected;
+    expected[0][0] = 1;
+    expected[1][1] = 4;
+    expected[2][2] = 0.25;
+    REQUIRE(covariance.Similar(expected));
+
+    return;
+}
+
+// Tests that the statistics match straightforward loops, for amounts of points not divisible by the block size
+TEST_CASE(__FILE__"/Matches_Reference", "[PointStatistics]")
+{
+    for (std::size_t count : { 1, 3, 5, 4097, 50001 })
+    {
+        const Vector3d offset = RandomVector(rng, 100);
+        const std::vector<Vector3d> points = RandomCloud(count, offset);
+
+        AABB expectedBounds { points[0], points[0] };
+        for (const Vector3d& p : points)
+            for (std::size_t i = 0; i < 3; i++)
+            {
+                expectedBounds.min[i] = std::min(expectedBounds.min[i], p[i]);
+                expectedBounds.max[i] = std::max(expectedBounds.max[i], p[i]);
+            }
+
+        const AABB bounds = PointStatistics::Bounds(points);
+        REQUIRE(bounds.min == expectedBounds.min);
+        REQUIRE(bounds.max == expectedBounds.max);
+
+        Vector3d expectedCentroid;
+        const Matrix4x4 expectedCovariance = ReferenceCovariance(points, offset, expectedCentroid);
+
+        REQUIRE(PointStatistics::Centroid(points).Similar(expectedCentroid, 1e-9));
+
+        Vector3d centroid;
+        const Matrix4x4 covariance = PointStatistics::Covariance(points, centroid);
+        REQUIRE(centroid.Similar(expectedCentroid, 1e-9));
+        REQUIRE(covariance.Similar(expectedCovariance, 1e-9));
+        REQUIRE(covariance[3][3] == 1);
+    }
+
+    return;
+}
+
+// Tests that the covariance stays precise for points far away from the origin
+TEST_CASE(__FILE__"/Large_Offset", "[PointStatistics]")
+{
+    const Vector3d offset(1e8, -3e8, 5e7);
+    const std::vector<Vector3d> points = RandomCloud(100000, offset);
+
+    Vector3d expectedCentroid;
+    const Matrix4x4 expectedCovariance = ReferenceCovariance(points, offset, expectedCentroid);
+
+    const Matrix4x4 covariance = PointStatistics::Covariance(points, 4);
+
+    // Squared coordinates are around 1e16 here, so naively summing them would lose all digits of a covariance around 1
+    REQUIRE(covariance.Similar(expectedCovariance, 1e-6));
+
+    return;
+}
+
+// Tests that results are bit-identical, no matter how many threads compute them
+TEST_CASE(__FILE__"/Deterministic_Across_Threads", "[PointStatistics]")
+{
+    const std::vector<Vector3d> points = RandomCloud(300007, RandomVector(rng, 1000));
+
+    const AABB bounds = PointStatistics::Bounds(points, 1);
+    Vector3d covarianceCentroid;
+    const Matrix4x4 covariance = PointStatistics::Covariance(points, covarianceCentroid, 1);
+    const Vector3d centroid = PointStatistics::Centroid(points, 1);
+
+    for (std::size_t threads : { 2, 3, 4, 0 })
+    {
+        const AABB otherBounds = PointStatistics::Bounds(points, threads);
+        REQUIRE(otherBounds.min == bounds.min);
+        REQUIRE(otherBounds.max == bounds.max);
+
+        REQUIRE(PointStatistics::Centroid(points, threads) == centroid);
+
+        Vector3d otherCentroid;
+        REQUIRE(PointStatistics::Covariance(points, otherCentroid, threads) == covariance);
+        REQUIRE(otherCentroid == covarianceCentroid);
+    }
+
+    return;
+}
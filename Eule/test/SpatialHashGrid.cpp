@@ -0,0 +1,216 @@
+#include "Catch2.h"
+#include <Eule/SpatialHashGrid.h>
+#include "TestingUtilities/Fixtures.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+
+    double SqrDistanceToBox(const Vector3d& point, const AABB& box)
+    {
+        double sqrDistance = 0;
+        for (std::size_t i = 0; i < 3; i++)
+        {
+            const double d = std::max(std::max(box.min[i] - point[i], point[i] - box.max[i]), 0.0);
+            sqrDistance += d * d;
+        }
+
+        return sqrDistance;
+    }
+}
+
+// Tests that invalid cell sizes throw
+TEST_CASE(__FILE__"/Invalid_Cell_Size", "[SpatialHashGrid]")
+{
+    REQUIRE_THROWS_AS(SpatialHashGrid(0), std::invalid_argument);
+    REQUIRE_THROWS_AS(SpatialHashGrid(-1), std::invalid_argument);
+    REQUIRE_THROWS_AS(SpatialHashGrid(NAN), std::invalid_argument);
+
+    return;
+}
+
+// Tests that points get assigned to the cell they lie in, rounding towards negative infinity
+TEST_CASE(__FILE__"/Cell_Of", "[SpatialHashGrid]")
+{
+    const SpatialHashGrid grid(2);
+
+    REQUIRE(grid.CellOf(Vector3d(0, 0, 0)) == Vector3i(0, 0, 0));
+    REQUIRE(grid.CellOf(Vector3d(1.99, 2, 4.5)) == Vector3i(0, 1, 2));
+    REQUIRE(grid.CellOf(Vector3d(-0.01, -2, -2.01)) == Vector3i(-1, -1, -2));
+
+    return;
+}
+
+// Tests that points and boxes outside of the grid's range, or covering too many cells, throw
+TEST_CASE(__FILE__"/Out_Of_Range", "[SpatialHashGrid]")
+{
+    SpatialHashGrid grid(1);
+
+    REQUIRE_THROWS_AS(grid.Insert(Vector3d(NAN, 0, 0), 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(grid.Insert(Vector3d(0, INFINITY, 0), 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(grid.Insert(Vector3d(0, 0, 1e300), 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(grid.Insert(AABB { Vector3d(0, 0, 0), Vector3d(INFINITY, 1, 1) }, 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(grid.Insert(AABB { Vector3d(-1000, -1000, -1000), Vector3d(1000, 1000, 1000) }, 0), std::invalid_argument);
+    REQUIRE(grid.Size() == 0);
+
+    // The outermost cells of the range still work
+    const double edge = SpatialHashGrid::MAX_CELL_COORDINATE;
+    grid.Insert(Vector3d(edge + 0.5, -edge, 0), 1);
+    grid.Insert(AABB { Vector3d(-1, -1, -1), Vector3d(1, 1, 1) }, 2);
+
+    // Queries reaching beyond the range get clamped to it
+    std::vector<std::size_t> found;
+    grid.QueryCells(Vector3i(INT_MIN, INT_MIN, INT_MIN), Vector3i(INT_MAX, INT_MAX, INT_MAX), found);
+    REQUIRE(Sorted(found) == std::vector<std::size_t>{ 1, 2 });
+
+    found.clear();
+    grid.QueryCells(Vector3i(INT_MAX - 1, INT_MIN, 0), Vector3i(INT_MAX, INT_MIN + 1, 0), found);
+    REQUIRE(found.empty());
+
+    found.clear();
+    grid.QueryRadius(Vector3d(0, 0, 0), INFINITY, found);
+    REQUIRE(Sorted(found) == std::vector<std::size_t>{ 1, 2 });
+
+    REQUIRE_THROWS_AS(grid.QueryRadius(Vector3d(0, 0, 0), NAN, found), std::invalid_argument);
+
+    return;
+}
+
+// Tests that radius queries over bulk inserted points equal brute force
+TEST_CASE(__FILE__"/Radius_Query_Points", "[SpatialHashGrid]")
+{
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 5000; i++)
+        points.push_back(RandomVector(rng, 50));
+
+    SpatialHashGrid grid(3);
+    grid.Insert(points, 100);
+
+    REQUIRE(grid.Size() == points.size());
+    REQUIRE(grid.CellCount() > 1000);
+
+    for (std::size_t i = 0; i < 200; i++)
+    {
+        const Vector3d center = RandomVector(rng, 55);
+        const double radius = (rng() % 1000) / 100.0;
+
+        std::vector<std::size_t> expected;
+        for (std::size_t j = 0; j < points.size(); j++)
+            if ((points[j] - center).SqrMagnitude() <= radius * radius)
+                expected.push_back(100 + j);
+
+        std::vector<std::size_t> found;
+        grid.QueryRadius(center, radius, found);
+
+        REQUIRE(Sorted(found) == expected);
+    }
+
+    return;
+}
+
+// Tests that cell range queries return exactly the points within the cells, no matter the size of the range
+TEST_CASE(__FILE__"/Cell_Query_Points", "[SpatialHashGrid]")
+{
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 2000; i++)
+        points.push_back(RandomVector(rng, 20));
+
+    SpatialHashGrid grid(1.5);
+    for (std::size_t i = 0; i < points.size(); i++)
+        grid.Insert(points[i], i);
+
+    for (std::size_t i = 0; i < 200; i++)
+    {
+        // Alternate between small ranges (looked up cell by cell) and huge ones (answered by scanning the table)
+        const int extent = (i % 2) ? 2 : 100;
+        const Vector3i minCell = grid.CellOf(RandomVector(rng, 20));
+        const Vector3i maxCell(minCell.x + rng() % extent, minCell.y + rng() % extent, minCell.z + rng() % extent);
+
+        std::vector<std::size_t> expected;
+        for (std::size_t j = 0; j < points.size(); j++)
+        {
+            const Vector3i cell = grid.CellOf(points[j]);
+            if ((minCell.x <= cell.x) && (cell.x <= maxCell.x) &&
+                (minCell.y <= cell.y) && (cell.y <= maxCell.y) &&
+                (minCell.z <= cell.z) && (cell.z <= maxCell.z))
+                expected.push_back(j);
+        }
+
+        std::vector<std::size_t> found;
+        grid.QueryCells(minCell, maxCell, found);
+
+        REQUIRE(Sorted(found) == expected);
+    }
+
+    return;
+}
+
+// Tests that boxes spanning many cells get found by radius queries exactly once
+TEST_CASE(__FILE__"/Radius_Query_Boxes", "[SpatialHashGrid]")
+{
+    std::vector<AABB> boxes;
+    for (std::size_t i = 0; i < 500; i++)
+    {
+        const Vector3d center = RandomVector(rng, 30);
+        const Vector3d halfSize = Vector3d(rng() % 100, rng() % 100, rng() % 100) * 0.05;
+        boxes.push_back(AABB { center - halfSize, center + halfSize });
+    }
+
+    SpatialHashGrid grid(2);
+    for (std::size_t i = 0; i < boxes.size(); i++)
+        grid.Insert(boxes[i], i);
+
+    REQUIRE(grid.Size() == boxes.size());
+
+    for (std::size_t i = 0; i < 200; i++)
+    {
+        const Vector3d center = RandomVector(rng, 35);
+        const double radius = (rng() % 1000) / 100.0;
+
+        std::vector<std::size_t> expected;
+        for (std::size_t j = 0; j < boxes.size(); j++)
+            if (SqrDistanceToBox(center, boxes[j]) <= radius * radius)
+                expected.push_back(j);
+
+        std::vector<std::size_t> found;
+        grid.QueryRadius(center, radius, found);
+
+        REQUIRE(Sorted(found) == expected);
+    }
+
+    return;
+}
+
+// Tests that clearing removes all items
+TEST_CASE(__FILE__"/Clear", "[SpatialHashGrid]")
+{
+    SpatialHashGrid grid(1);
+    grid.Insert(Vector3d(0.5, 0.5, 0.5), 7);
+    grid.Insert(AABB { Vector3d(-3, -3, -3), Vector3d(3, 3, 3) }, 8);
+
+    std::vector<std::size_t> found;
+    grid.QueryRadius(Vector3d(0, 0, 0), 1, found);
+    REQUIRE(Sorted(found) == std::vector<std::size_t>{ 7, 8 });
+
+    grid.Clear();
+    REQUIRE(grid.Size() == 0);
+    REQUIRE(grid.CellCount() == 0);
+
+    found.clear();
+    grid.QueryRadius(Vector3d(0, 0, 0), 1, found);
+    REQUIRE(found.empty());
+
+    // Still usable
+    grid.Insert(Vector3d(0, 0, 0), 9);
+    grid.QueryRadius(Vector3d(0, 0, 0), 1, found);
+    REQUIRE(found == std::vector<std::size_t>{ 9 });
+
+    return;
+}
@@ -0,0 +1,188 @@
+#include "Catch2.h"
+#include <Eule/SweepAndPrune.h>
+#include <Eule/Overlap.h>
+#include <Eule/Quaternion.h>
+#include "TestingUtilities/Fixtures.h"
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+using TPC = TrapazoidalPrismCollider;
+using Pairs = std::vector<std::pair<std::size_t, std::size_t>>;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+
+    TPC RandomBox(double scale)
+    {
+        return MakeBox(
+            RandomVector(rng, scale),
+            Vector3d(0.5, 0.5, 0.5) + Vector3d(rng() % 100, rng() % 100, rng() % 100) * 0.02,
+            RandomRotation(rng)
+        );
+    }
+
+    // Will return all pairs of alive handles whose bounds overlap
+    Pairs BruteForcePairs(const std::vector<TPC>& colliders, const std::vector<std::size_t>& handles, const std::vector<bool>& alive)
+    {
+        Pairs pairs;
+        for (std::size_t i = 0; i < colliders.size(); i++)
+            for (std::size_t j = 0; j < colliders.size(); j++)
+                if (alive[i] && alive[j] && (handles[i] < handles[j]) && Overlaps(colliders[i].GetBounds(), colliders[j].GetBounds()))
+                    pairs.emplace_back(handles[i], handles[j]);
+
+        std::sort(pairs.begin(), pairs.end());
+        return pairs;
+    }
+
+    Matrix4x4 Translation(const Vector3d& offset)
+    {
+        Matrix4x4 m;
+        m.SetTranslationComponent(offset);
+        return m;
+    }
+}
+
+// Tests that the bounds of a collider are taken from its vertices
+TEST_CASE(__FILE__"/Bounds_From_Vertices", "[SweepAndPrune]")
+{
+    const TPC tpc = RandomBox(10);
+
+    SweepAndPrune sap;
+    const std::size_t handle = sap.Add(tpc);
+
+    REQUIRE(sap.Size() == 1);
+    REQUIRE(sap.GetBounds(handle).min.Similar(tpc.GetBounds().min));
+    REQUIRE(sap.GetBounds(handle).max.Similar(tpc.GetBounds().max));
+
+    return;
+}
+
+// Tests that overlapping pairs equal brute force, while colliders move between updates
+TEST_CASE(__FILE__"/Pairs_Equal_Brute_Force", "[SweepAndPrune]")
+{
+    std::vector<TPC> colliders;
+    for (std::size_t i = 0; i < 400; i++)
+        colliders.push_back(RandomBox(30));
+
+    SweepAndPrune sap;
+    std::vector<std::size_t> handles;
+    for (const TPC& tpc : colliders)
+        handles.push_back(sap.Add(tpc));
+
+    const std::vector<bool> alive(colliders.size(), true);
+
+    for (std::size_t step = 0; step < 10; step++)
+    {
+        Pairs pairs;
+        sap.FindOverlappingPairs(pairs);
+
+        REQUIRE(Sorted(pairs) == BruteForcePairs(colliders, handles, alive));
+
+        for (TPC& tpc : colliders)
+            tpc.TransformBy(Translation(RandomVector(rng, 0.5)));
+
+        sap.Update();
+    }
+
+    return;
+}
+
+// Tests that updating after small moves needs few swaps, compared to re-sorting from scratch
+TEST_CASE(__FILE__"/Update_Exploits_Coherence", "[SweepAndPrune]")
+{
+    std::vector<TPC> colliders;
+    for (std::size_t i = 0; i < 1000; i++)
+        colliders.push_back(RandomBox(100));
+
+    SweepAndPrune sap;
+    for (const TPC& tpc : colliders)
+        sap.Add(tpc);
+
+    // Nothing moved
+    REQUIRE(sap.Update() == 0);
+
+    for (TPC& tpc : colliders)
+        tpc.TransformBy(Translation(RandomVector(rng, 0.1)));
+
+    // 2000 endpoints in random order would need about a million swaps
+    const std::size_t swaps = sap.Update();
+    INFO("Swaps: " << swaps);
+    REQUIRE(swaps < 4000);
+
+    return;
+}
+
+// Tests that the narrowphase equals SAT on all pairs, no matter the amount of threads
+TEST_CASE(__FILE__"/Colliding_Pairs", "[SweepAndPrune][Overlap]")
+{
+    std::vector<TPC> colliders;
+    for (std::size_t i = 0; i < 600; i++)
+        colliders.push_back(RandomBox(15));
+
+    SweepAndPrune sap;
+    for (const TPC& tpc : colliders)
+        sap.Add(tpc);
+
+    Pairs expected;
+    for (std::size_t i = 0; i < colliders.size(); i++)
+        for (std::size_t j = i + 1; j < colliders.size(); j++)
+            if (Overlap::SAT(colliders[i], colliders[j]))
+                expected.emplace_back(i, j);
+
+    Pairs single;
+    sap.FindCollidingPairs(single);
+    REQUIRE(single.size() > 0);
+    REQUIRE(Sorted(single) == expected);
+
+    Pairs four;
+    sap.FindCollidingPairs(four, 4);
+    REQUIRE(four == single);
+
+    Pairs hardware;
+    sap.FindCollidingPairs(hardware, 0);
+    REQUIRE(hardware == single);
+
+    return;
+}
+
+// Tests that removed colliders vanish from all pairs, and their handles get reused
+TEST_CASE(__FILE__"/Remove", "[SweepAndPrune]")
+{
+    std::vector<TPC> colliders;
+    for (std::size_t i = 0; i < 200; i++)
+        colliders.push_back(RandomBox(10));
+
+    SweepAndPrune sap;
+    std::vector<std::size_t> handles;
+    for (const TPC& tpc : colliders)
+        handles.push_back(sap.Add(tpc));
+
+    std::vector<bool> alive(colliders.size(), true);
+    for (std::size_t i = 0; i < colliders.size(); i += 3)
+    {
+        sap.Remove(handles[i]);
+        alive[i] = false;
+    }
+
+    REQUIRE_THROWS_AS(sap.Remove(handles[0]), std::out_of_range);
+    REQUIRE_THROWS_AS(sap.GetBounds(handles[0]), std::out_of_range);
+    REQUIRE_THROWS_AS(sap.Remove(12345), std::out_of_range);
+
+    Pairs pairs;
+    sap.FindOverlappingPairs(pairs);
+    REQUIRE(Sorted(pairs) == BruteForcePairs(colliders, handles, alive));
+
+    // Re-adding reuses a freed handle
+    const std::size_t handle = sap.Add(colliders[0]);
+    REQUIRE(!alive[std::find(handles.begin(), handles.end(), handle) - handles.begin()]);
+    REQUIRE(sap.Size() == 134);
+
+    sap.Clear();
+    REQUIRE(sap.Size() == 0);
+    REQUIRE(sap.Add(colliders[0]) == 0);
+
+    return;
+}
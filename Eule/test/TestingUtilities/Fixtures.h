@@ -0,0 +1,133 @@
+#pragma once
+#include <Eule/AABB.h>
+#include <Eule/Matrix4x4.h>
+#include <Eule/Quaternion.h>
+#include <Eule/TrapazoidalPrismCollider.h>
+#include <Eule/Vector3.h>
+#include <algorithm>
+#include <cstddef>
+#include <random>
+
+/* Helpers shared between test files.
+* Each test file keeps its own rng, so they take it as their first parameter. */
+
+//! Will return a random value in [-scale, scale]
+inline double RandomDouble(std::mt19937& rng, double scale)
+{
+    return (((double)(rng() % 20001) - 10000.0) / 10000.0) * scale;
+}
+
+//! Will return a random vector in the cube [-scale, scale]^3
+inline Leonetienne::Eule::Vector3d RandomVector(std::mt19937& rng, double scale)
+{
+    return Leonetienne::Eule::Vector3d(RandomDouble(rng, 1), RandomDouble(rng, 1), RandomDouble(rng, 1)) * scale;
+}
+
+//! Will return a rotation by random euler angles
+inline Leonetienne::Eule::Quaternion RandomRotation(std::mt19937& rng)
+{
+    return Leonetienne::Eule::Quaternion(Leonetienne::Eule::Vector3d(rng() % 360, rng() % 360, rng() % 360));
+}
+
+//! Will return a matrix with a random 3x3 part in [-scale, scale], and no translation
+inline Leonetienne::Eule::Matrix4x4 RandomMatrix(std::mt19937& rng, double scale)
+{
+    Leonetienne::Eule::Matrix4x4 m;
+    for (std::size_t y = 0; y < 3; y++)
+        for (std::size_t x = 0; x < 3; x++)
+            m[y][x] = RandomDouble(rng, scale);
+
+    return m;
+}
+
+//! Will return a matrix with a random 3x3 part and translation in [-scale, scale]
+inline Leonetienne::Eule::Matrix4x4 RandomAffineMatrix(std::mt19937& rng, double scale)
+{
+    Leonetienne::Eule::Matrix4x4 m = RandomMatrix(rng, scale);
+    m.SetTranslationComponent(RandomVector(rng, scale));
+
+    return m;
+}
+
+//! Will return a box, rotated around its center
+inline Leonetienne::Eule::TrapazoidalPrismCollider MakeBox(
+    const Leonetienne::Eule::Vector3d& center,
+    const Leonetienne::Eule::Vector3d& halfSize,
+    const Leonetienne::Eule::Quaternion& rotation = Leonetienne::Eule::Quaternion()
+)
+{
+    using TPC = Leonetienne::Eule::TrapazoidalPrismCollider;
+
+    TPC tpc;
+    for (std::size_t i = 0; i < 8; i++)
+    {
+        const Leonetienne::Eule::Vector3d corner(
+            (i & TPC::RIGHT) ? halfSize.x : -halfSize.x,
+            (i & TPC::TOP)   ? halfSize.y : -halfSize.y,
+            (i & TPC::FRONT) ? halfSize.z : -halfSize.z
+        );
+        tpc.SetVertex(i, (rotation * corner) + center);
+    }
+
+    return tpc;
+}
+
+//! Will return a cube, rotated around its center
+inline Leonetienne::Eule::TrapazoidalPrismCollider MakeBox(
+    const Leonetienne::Eule::Vector3d& center,
+    double halfSize,
+    const Leonetienne::Eule::Quaternion& rotation = Leonetienne::Eule::Quaternion()
+)
+{
+    return MakeBox(center, Leonetienne::Eule::Vector3d(halfSize, halfSize, halfSize), rotation);
+}
+
+//! Will return a box with exactly the corners of `box`
+inline Leonetienne::Eule::TrapazoidalPrismCollider MakeBox(const Leonetienne::Eule::AABB& box)
+{
+    using TPC = Leonetienne::Eule::TrapazoidalPrismCollider;
+
+    TPC tpc;
+    for (std::size_t i = 0; i < 8; i++)
+        tpc.SetVertex(i, Leonetienne::Eule::Vector3d(
+            (i & TPC::RIGHT) ? box.max.x : box.min.x,
+            (i & TPC::TOP)   ? box.max.y : box.min.y,
+            (i & TPC::FRONT) ? box.max.z : box.min.z
+        ));
+
+    return tpc;
+}
+
+//! Brute force reference for box-box overlap. Touching counts as overlapping
+inline bool Overlaps(const Leonetienne::Eule::AABB& a, const Leonetienne::Eule::AABB& b)
+{
+    return
+        (a.min.x <= b.max.x) && (b.min.x <= a.max.x) &&
+        (a.min.y <= b.max.y) && (b.min.y <= a.max.y) &&
+        (a.min.z <= b.max.z) && (b.min.z <= a.max.z);
+}
+
+//! Will return a sorted copy, to compare results that come in no particular order
+template <typename T>
+T Sorted(T container)
+{
+    std::sort(container.begin(), container.end());
+    return container;
+}
+
+//! A perspective projection looking down -z, with the near plane at 1 and the far plane at 100
+inline Leonetienne::Eule::Matrix4x4 Perspective()
+{
+    constexpr double n = 1;
+    constexpr double f = 100;
+
+    Leonetienne::Eule::Matrix4x4 m;
+    m[0][0] = 1;
+    m[1][1] = 1;
+    m[2][2] = (f + n) / (n - f);
+    m[2][3] = (2 * f * n) / (n - f);
+    m[3][2] = -1;
+    m[3][3] = 0;
+
+    return m;
+}
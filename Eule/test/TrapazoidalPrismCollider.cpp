@@ -1,6 +1,10 @@
 #include "Catch2.h"
 #include <Eule/TrapazoidalPrismCollider.h>
 #include <Eule/Quaternion.h>
+#include <Eule/Math.h>
+#include "TestingUtilities/Fixtures.h"
+#include <limits>
+#include <vector>
 #include <random>
 #include <array>
 
@@ -162,3 +166,516 @@ TEST_CASE(__FILE__"/Points_Outside", "[TrapazoidalPrismCollider][Collider]")
 
     return;
 }
+
+// Tests that a ray hits an axis-aligned box at the expected position, face and normal
+TEST_CASE(__FILE__"/Raycast_Hits_Face", "[TrapazoidalPrismCollider][Collider][Raycast]")
+{
+    const TPC tpc = MakeBox(Vector3d(0, 0, 0), 10, Quaternion());
+
+    RaycastHit hit;
+    REQUIRE(tpc.Raycast(Vector3d(-50, 1, 2), Vector3d(1, 0, 0), 1000, hit));
+    REQUIRE(Math::Similar(hit.t, 40));
+    REQUIRE(hit.point.Similar(Vector3d(-10, 1, 2)));
+    REQUIRE(hit.normal.Similar(Vector3d(-1, 0, 0)));
+    REQUIRE(hit.face == (std::size_t)TPC::FACE_NORMALS::LEFT);
+
+    REQUIRE(tpc.Raycast(Vector3d(3, 100, -2), Vector3d(0, -2, 0), 1000, hit));
+    REQUIRE(Math::Similar(hit.t, 45));
+    REQUIRE(hit.point.Similar(Vector3d(3, 10, -2)));
+    REQUIRE(hit.normal.Similar(Vector3d(0, 1, 0)));
+    REQUIRE(hit.face == (std::size_t)TPC::FACE_NORMALS::TOP);
+
+    REQUIRE(tpc.Raycast(Vector3d(0, 0, 30), Vector3d(0, 0, -1), 1000, hit));
+    REQUIRE(hit.normal.Similar(Vector3d(0, 0, 1)));
+    REQUIRE(hit.face == (std::size_t)TPC::FACE_NORMALS::FRONT);
+
+    return;
+}
+
+// Tests that rays pointing away, passing by, or being too short miss
+TEST_CASE(__FILE__"/Raycast_Misses", "[TrapazoidalPrismCollider][Collider][Raycast]")
+{
+    const TPC tpc = MakeBox(Vector3d(0, 0, 0), 10, Quaternion());
+
+    RaycastHit hit;
+    REQUIRE_FALSE(tpc.Raycast(Vector3d(-50, 0, 0), Vector3d(-1, 0, 0), 1000, hit));
+    REQUIRE_FALSE(tpc.Raycast(Vector3d(-50, 11, 0), Vector3d(1, 0, 0), 1000, hit));
+    REQUIRE_FALSE(tpc.Raycast(Vector3d(-50, 0, 0), Vector3d(1, 0, 0), 39, hit));
+    REQUIRE_FALSE(tpc.Raycast(Vector3d(-50, 0, 0), Vector3d(1, 1, 0), 1000, hit));
+
+    return;
+}
+
+// Tests that a ray starting inside hits at t = 0
+TEST_CASE(__FILE__"/Raycast_From_Inside", "[TrapazoidalPrismCollider][Collider][Raycast]")
+{
+    const TPC tpc = MakeBox(Vector3d(0, 0, 0), 10, Quaternion());
+
+    RaycastHit hit;
+    REQUIRE(tpc.Raycast(Vector3d(1, 2, 3), Vector3d(0, 1, 0), 1000, hit));
+    REQUIRE(hit.t == 0);
+    REQUIRE(hit.point.Similar(Vector3d(1, 2, 3)));
+
+    return;
+}
+
+// Tests that linecasts only hit within the segment
+TEST_CASE(__FILE__"/Linecast", "[TrapazoidalPrismCollider][Collider][Raycast]")
+{
+    const TPC tpc = MakeBox(Vector3d(0, 0, 0), 10, Quaternion());
+
+    RaycastHit hit;
+    REQUIRE(tpc.Linecast(Vector3d(-30, 0, 0), Vector3d(30, 0, 0), hit));
+    REQUIRE(Math::Similar(hit.t, 1.0 / 3.0));
+    REQUIRE(hit.point.Similar(Vector3d(-10, 0, 0)));
+
+    REQUIRE_FALSE(tpc.Linecast(Vector3d(-30, 0, 0), Vector3d(-11, 0, 0), hit));
+
+    return;
+}
+
+// Tests that the hit points of random rays against rotated boxes lie on their surface
+TEST_CASE(__FILE__"/Raycast_Hit_On_Surface", "[TrapazoidalPrismCollider][Collider][Raycast]")
+{
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const TPC tpc = MakeBox(RandomVector(rng, 5), 10, RandomRotation(rng));
+        const Vector3d origin = RandomVector(rng, 50);
+        const Vector3d direction = (RandomVector(rng, 10) - origin).Normalize();
+
+        RaycastHit hit;
+        if (tpc.Raycast(origin, direction, 1000, hit))
+        {
+            // Find where the ray exits again, by casting it backwards
+            RaycastHit exit;
+            REQUIRE(tpc.Raycast(origin + direction * 1000, -direction, 1000, exit));
+            const double exitT = 1000 - exit.t;
+            REQUIRE(exitT >= hit.t - 0.0001);
+
+            // Slightly behind the hit point is inside (unless the ray only grazes an edge), slightly before is outside
+            if (exitT - hit.t > 0.01)
+                REQUIRE(tpc.Contains(hit.point + direction * 0.001));
+            if (hit.t > 0)
+                REQUIRE_FALSE(tpc.Contains(hit.point - direction * 0.001));
+
+            // The normal points against the ray
+            REQUIRE(hit.normal.DotProduct(direction) <= 0);
+        }
+    }
+
+    return;
+}
+
+// Tests that casting many rays against one collider equals casting them one by one
+TEST_CASE(__FILE__"/Raycast_Batched_Rays", "[TrapazoidalPrismCollider][Collider][Raycast]")
+{
+    const TPC tpc = MakeBox(Vector3d(1, 2, 3), 10, Quaternion(Vector3d(10, 20, 30)));
+
+    std::vector<Vector3d> origins;
+    std::vector<Vector3d> directions;
+    for (std::size_t i = 0; i < 1003; i++)
+    {
+        origins.push_back(RandomVector(rng, 40));
+        directions.push_back(RandomVector(rng, 1) - origins.back() * 0.02);
+    }
+
+    // Some rays parallel to the axes, including ones starting inside
+    origins.push_back(Vector3d(0, 0, 0));
+    directions.push_back(Vector3d(1, 0, 0));
+    origins.push_back(Vector3d(-50, 0, 0));
+    directions.push_back(Vector3d(0, 1, 0));
+
+    std::vector<RaycastHit> hits;
+    tpc.Raycast(origins, directions, 100, hits);
+    REQUIRE(hits.size() == origins.size());
+
+    std::size_t numHits = 0;
+    for (std::size_t i = 0; i < origins.size(); i++)
+    {
+        RaycastHit single;
+        if (tpc.Raycast(origins[i], directions[i], 100, single))
+        {
+            numHits++;
+            REQUIRE(Math::Similar(single.t, hits[i].t));
+            REQUIRE(single.face == hits[i].face);
+            REQUIRE(single.point.Similar(hits[i].point));
+        }
+        else
+            REQUIRE(hits[i].t == std::numeric_limits<double>::infinity());
+    }
+
+    // Make sure both cases have been exercised
+    REQUIRE(numHits > 0);
+    REQUIRE(numHits < origins.size());
+
+    return;
+}
+
+// Tests that casting a ray against many colliders equals casting it against them one by one
+TEST_CASE(__FILE__"/Raycast_Batched_Colliders", "[TrapazoidalPrismCollider][Collider][Raycast]")
+{
+    std::vector<TPC> colliders;
+    for (std::size_t i = 0; i < 503; i++)
+        colliders.push_back(MakeBox(RandomVector(rng, 100), 5, RandomRotation(rng)));
+
+    const Vector3d origin(-150, 1, 2);
+    const Vector3d direction(1, 0.01, -0.02);
+
+    std::vector<RaycastHit> hits;
+    TPC::Raycast(colliders, origin, direction, 1000, hits);
+    REQUIRE(hits.size() == colliders.size());
+
+    for (std::size_t i = 0; i < colliders.size(); i++)
+    {
+        RaycastHit single;
+        if (colliders[i].Raycast(origin, direction, 1000, single))
+        {
+            REQUIRE(Math::Similar(single.t, hits[i].t));
+            REQUIRE(single.face == hits[i].face);
+            REQUIRE(single.normal.Similar(hits[i].normal));
+        }
+        else
+            REQUIRE(hits[i].t == std::numeric_limits<double>::infinity());
+    }
+
+    return;
+}
+
+namespace {
+    // Creates a truncated pyramid with a given center. Its top face is smaller than its bottom face
+    TPC MakeTruncatedPyramid(const Vector3d& center, const Quaternion& rotation)
+    {
+        TPC tpc;
+        for (std::size_t i = 0; i < 8; i++)
+        {
+            const double halfSize = (i & TPC::TOP) ? 4 : 10;
+            const Vector3d corner(
+                (i & TPC::RIGHT) ? halfSize : -halfSize,
+                (i & TPC::TOP)   ? 10 : -10,
+                (i & TPC::FRONT) ? halfSize : -halfSize
+            );
+            tpc.SetVertex(i, (rotation * corner) + center);
+        }
+
+        return tpc;
+    }
+}
+
+// Tests signed distances to an axis-aligned box
+TEST_CASE(__FILE__"/SignedDistance_Box", "[TrapazoidalPrismCollider][Collider][SignedDistance]")
+{
+    const TPC tpc = MakeBox(Vector3d(0, 0, 0), 10, Quaternion());
+
+    REQUIRE(Math::Similar(tpc.SignedDistance(Vector3d(0, 0, 0)), -10));
+    REQUIRE(Math::Similar(tpc.SignedDistance(Vector3d(5, -2, 1)), -5));
+    REQUIRE(Math::Similar(tpc.SignedDistance(Vector3d(10, 0, 0)), 0));
+    REQUIRE(Math::Similar(tpc.SignedDistance(Vector3d(15, 0, 0)), 5));
+    REQUIRE(Math::Similar(tpc.SignedDistance(Vector3d(0, -13, 0)), 3));
+    REQUIRE(Math::Similar(tpc.SignedDistance(Vector3d(15, 15, 0)), sqrt(50.0)));
+    REQUIRE(Math::Similar(tpc.SignedDistance(Vector3d(13, 14, -12)), sqrt(9.0 + 16.0 + 4.0)));
+
+    REQUIRE(tpc.ClosestPoint(Vector3d(15, 3, -2)).Similar(Vector3d(10, 3, -2)));
+    REQUIRE(tpc.ClosestPoint(Vector3d(13, 14, -12)).Similar(Vector3d(10, 10, -10)));
+    REQUIRE(tpc.ClosestPoint(Vector3d(1, 2, 3)).Similar(Vector3d(1, 2, 3)));
+
+    return;
+}
+
+// Tests signed distances to rotated boxes, against the analytic distance in the box's local space
+TEST_CASE(__FILE__"/SignedDistance_Rotated_Box", "[TrapazoidalPrismCollider][Collider][SignedDistance]")
+{
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        const Vector3d center = RandomVector(rng, 20);
+        const Quaternion rotation = RandomRotation(rng);
+        const TPC tpc = MakeBox(center, 5, rotation);
+
+        for (std::size_t j = 0; j < 100; j++)
+        {
+            const Vector3d point = center + RandomVector(rng, 12);
+
+            // Distance to an axis-aligned box of half-size 5, in local space
+            const Vector3d local = rotation.Inverse() * (point - center);
+            const Vector3d q(std::abs(local.x) - 5, std::abs(local.y) - 5, std::abs(local.z) - 5);
+            const Vector3d outside(std::max(q.x, 0.0), std::max(q.y, 0.0), std::max(q.z, 0.0));
+            const double expected = outside.Magnitude() + std::min(std::max(q.x, std::max(q.y, q.z)), 0.0);
+
+            INFO("Point: " << point << "  Expected: " << expected);
+            REQUIRE(Math::Similar(tpc.SignedDistance(point), expected, 0.0001));
+        }
+    }
+
+    return;
+}
+
+// Tests that closest points lie on the surface, and that no other surface point is closer
+TEST_CASE(__FILE__"/ClosestPoint_Truncated_Pyramid", "[TrapazoidalPrismCollider][Collider][SignedDistance]")
+{
+    const TPC tpc = MakeTruncatedPyramid(RandomVector(rng, 20), RandomRotation(rng));
+
+    // Sample the surface, by interpolating across each face
+    static const std::array<std::array<std::size_t, 4>, 6> faces = {{
+        { 0, 1, 5, 4 }, { 2, 3, 7, 6 }, { 4, 5, 7, 6 }, { 0, 1, 3, 2 }, { 1, 5, 7, 3 }, { 0, 4, 6, 2 }
+    }};
+
+    std::vector<Vector3d> surface;
+    for (const std::array<std::size_t, 4>& face : faces)
+        for (std::size_t u = 0; u <= 20; u++)
+            for (std::size_t v = 0; v <= 20; v++)
+            {
+                const double s = u / 20.0;
+                const double t = v / 20.0;
+                surface.push_back(
+                    tpc.GetVertex(face[0]) * ((1 - s) * (1 - t)) +
+                    tpc.GetVertex(face[1]) * ((1 - s) * t) +
+                    tpc.GetVertex(face[2]) * (s * t) +
+                    tpc.GetVertex(face[3]) * (s * (1 - t))
+                );
+            }
+
+    for (std::size_t i = 0; i < 200; i++)
+    {
+        const Vector3d point = tpc.GetVertex(0) + RandomVector(rng, 40);
+        const double distance = tpc.SignedDistance(point);
+        const Vector3d closest = tpc.ClosestPoint(point);
+
+        INFO("Point: " << point << "  Closest: " << closest << "  Distance: " << distance);
+
+        if (distance > 0)
+        {
+            REQUIRE_FALSE(tpc.Contains(point));
+            REQUIRE(Math::Similar((closest - point).Magnitude(), distance, 0.0001));
+            REQUIRE(Math::Similar(tpc.SignedDistance(closest), 0, 0.0001));
+        }
+        else
+        {
+            REQUIRE(closest == point);
+        }
+
+        // No sampled surface point may be closer
+        for (const Vector3d& s : surface)
+            REQUIRE((s - point).Magnitude() >= std::abs(distance) - 0.0001);
+    }
+
+    return;
+}
+
+// Tests that batched signed distances equal single ones
+TEST_CASE(__FILE__"/SignedDistance_Batched", "[TrapazoidalPrismCollider][Collider][SignedDistance]")
+{
+    const TPC tpc = MakeTruncatedPyramid(Vector3d(0, 0, 0), RandomRotation(rng));
+
+    // Odd count, to exercise the tail
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 1001; i++)
+        points.push_back(RandomVector(rng, 25));
+
+    std::vector<double> distances;
+    tpc.SignedDistance(points, distances);
+    REQUIRE(distances.size() == points.size());
+
+    std::size_t numInside = 0;
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        REQUIRE(Math::Similar(distances[i], tpc.SignedDistance(points[i]), 0.000001));
+        if (std::abs(distances[i]) > 0.0001)
+            REQUIRE((distances[i] < 0) == tpc.Contains(points[i]));
+
+        if (distances[i] <= 0)
+            numInside++;
+    }
+
+    // Make sure both cases have been exercised
+    REQUIRE(numInside > 0);
+    REQUIRE(numInside < points.size());
+
+    return;
+}
+
+namespace {
+    // Creates a random rotation, non-uniform scale and translation
+    Matrix4x4 RandomTransform()
+    {
+        Matrix4x4 transform = RandomRotation(rng).ToRotationMatrix();
+        const Vector3d scale(0.5 + (rng() % 100) * 0.02, 0.5 + (rng() % 100) * 0.02, 0.5 + (rng() % 100) * 0.02);
+
+        for (std::size_t row = 0; row < 3; row++)
+            for (std::size_t column = 0; column < 3; column++)
+                transform[row][column] *= scale[column];
+
+        transform.SetTranslationComponent(RandomVector(rng, 50));
+
+        return transform;
+    }
+
+    // Tests that two colliders have the same vertices and face normals (up to their length)
+    void RequireSamePrism(const TPC& a, const TPC& b)
+    {
+        for (std::size_t i = 0; i < 8; i++)
+            REQUIRE(a.GetVertex(i).Similar(b.GetVertex(i), 0.0001));
+
+        for (std::size_t i = 0; i < 6; i++)
+        {
+            const Vector3d& na = a.GetFaceNormal((TPC::FACE_NORMALS)i);
+            const Vector3d& nb = b.GetFaceNormal((TPC::FACE_NORMALS)i);
+
+            INFO("Face " << i << ": " << na << " vs " << nb);
+            REQUIRE(na.Similar(nb, 0.0001 * nb.Magnitude()));
+        }
+
+        return;
+    }
+}
+
+// Tests that setting all vertices at once equals setting them one by one
+TEST_CASE(__FILE__"/Set_Vertices", "[TrapazoidalPrismCollider][Collider]")
+{
+    const TPC single = MakeBox(RandomVector(rng, 10), 5, RandomRotation(rng));
+
+    std::array<Vector3d, 8> vertices;
+    for (std::size_t i = 0; i < 8; i++)
+        vertices[i] = single.GetVertex(i);
+
+    TPC bulk;
+    bulk.SetVertices(vertices);
+
+    RequireSamePrism(bulk, single);
+
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const Vector3d point = RandomVector(rng, 20);
+        REQUIRE(bulk.Contains(point) == single.Contains(point));
+    }
+
+    return;
+}
+
+// Tests that moving single vertices updates the normals of all faces they lie on
+TEST_CASE(__FILE__"/Set_Vertex_Updates_Its_Faces", "[TrapazoidalPrismCollider][Collider]")
+{
+    for (std::size_t i = 0; i < 8; i++)
+    {
+        TPC single = MakeBox(RandomVector(rng, 10), 5, RandomRotation(rng));
+        single.SetVertex(i, single.GetVertex(i) + RandomVector(rng, 2));
+
+        std::array<Vector3d, 8> vertices;
+        for (std::size_t j = 0; j < 8; j++)
+            vertices[j] = single.GetVertex(j);
+
+        TPC bulk;
+        bulk.SetVertices(vertices);
+
+        for (std::size_t j = 0; j < 6; j++)
+            REQUIRE(single.GetFaceNormal((TPC::FACE_NORMALS)j) == bulk.GetFaceNormal((TPC::FACE_NORMALS)j));
+    }
+
+    return;
+}
+
+// Tests that transforming a collider equals building it from transformed vertices
+TEST_CASE(__FILE__"/Transform_By_Matrix", "[TrapazoidalPrismCollider][Collider]")
+{
+    for (std::size_t i = 0; i < 200; i++)
+    {
+        TPC tpc = MakeBox(RandomVector(rng, 10), 5, RandomRotation(rng));
+        Matrix4x4 transform = RandomTransform();
+
+        // Mirror every other transformation
+        if (i % 2)
+            for (std::size_t row = 0; row < 3; row++)
+                transform[row][0] *= -1;
+
+        std::array<Vector3d, 8> vertices;
+        for (std::size_t v = 0; v < 8; v++)
+            vertices[v] = tpc.GetVertex(v) * transform;
+
+        TPC expected;
+        expected.SetVertices(vertices);
+
+        tpc.TransformBy(transform);
+        RequireSamePrism(tpc, expected);
+    }
+
+    return;
+}
+
+// Tests that transforming a collider right after moving single vertices yields the correct normals
+TEST_CASE(__FILE__"/Transform_By_Matrix_After_SetVertex", "[TrapazoidalPrismCollider][Collider]")
+{
+    TPC tpc = MakeBox(Vector3d(0, 0, 0), 5, Quaternion());
+    tpc.SetVertex(TPC::FRONT | TPC::RIGHT | TPC::TOP, Vector3d(7, 7, 7));
+    tpc.SetVertex(TPC::FRONT | TPC::RIGHT | TPC::BOTTOM, Vector3d(7, -7, 7));
+
+    const Matrix4x4 transform = RandomTransform();
+
+    std::array<Vector3d, 8> vertices;
+    for (std::size_t v = 0; v < 8; v++)
+        vertices[v] = tpc.GetVertex(v) * transform;
+
+    TPC expected;
+    expected.SetVertices(vertices);
+
+    tpc.TransformBy(transform);
+    RequireSamePrism(tpc, expected);
+
+    return;
+}
+
+// Tests that transforming many colliders at once equals transforming them one by one
+TEST_CASE(__FILE__"/Transform_By_Matrix_Batched", "[TrapazoidalPrismCollider][Collider]")
+{
+    std::vector<TPC> colliders;
+    std::vector<Matrix4x4> transforms;
+    for (std::size_t i = 0; i < 50; i++)
+    {
+        colliders.push_back(MakeBox(RandomVector(rng, 100), 5, RandomRotation(rng)));
+        transforms.push_back(RandomTransform());
+    }
+
+    // One transform for all
+    std::vector<TPC> shared = colliders;
+    TPC::TransformBy(shared, transforms[0]);
+
+    // One transform each
+    std::vector<TPC> individual = colliders;
+    TPC::TransformBy(individual, transforms);
+
+    for (std::size_t i = 0; i < colliders.size(); i++)
+    {
+        TPC a = colliders[i];
+        a.TransformBy(transforms[0]);
+        RequireSamePrism(shared[i], a);
+
+        TPC b = colliders[i];
+        b.TransformBy(transforms[i]);
+        RequireSamePrism(individual[i], b);
+    }
+
+    transforms.pop_back();
+    REQUIRE_THROWS_AS(TPC::TransformBy(colliders, transforms), std::invalid_argument);
+
+    return;
+}
+
+// Tests that the bounds enclose all vertices, and touch the extreme ones
+TEST_CASE(__FILE__"/Get_Bounds", "[TrapazoidalPrismCollider][Collider]")
+{
+    const TPC tpc = MakeTruncatedPyramid(RandomVector(rng, 20), RandomRotation(rng));
+    const AABB bounds = tpc.GetBounds();
+
+    for (std::size_t axis = 0; axis < 3; axis++)
+    {
+        double min = std::numeric_limits<double>::infinity();
+        double max = -std::numeric_limits<double>::infinity();
+        for (std::size_t i = 0; i < 8; i++)
+        {
+            min = std::min(min, tpc.GetVertex(i)[axis]);
+            max = std::max(max, tpc.GetVertex(i)[axis]);
+        }
+
+        REQUIRE(bounds.min[axis] == min);
+        REQUIRE(bounds.max[axis] == max);
+    }
+
+    return;
+}
@@ -0,0 +1,192 @@
+#include "Catch2.h"
+#include <Eule/TriangleMesh.h>
+#include <Eule/ConvexHull.h>
+#include <Eule/DynamicAABBTree.h>
+#include "TestingUtilities/Fixtures.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+
+    // A soup of small, randomly placed triangles
+    TriangleMesh RandomSoup(std::size_t count)
+    {
+        std::vector<Vector3d> vertices;
+        std::vector<std::array<std::size_t, 3>> triangles;
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const Vector3d center = RandomVector(rng, 10);
+            for (std::size_t j = 0; j < 3; j++)
+                vertices.push_back(center + RandomVector(rng, 2));
+
+            triangles.push_back({ i * 3, i * 3 + 1, i * 3 + 2 });
+        }
+
+        return TriangleMesh(vertices, triangles);
+    }
+
+    // The cube [-1, 1]^3, triangulated
+    TriangleMesh Cube()
+    {
+        std::vector<Vector3d> corners;
+        for (std::size_t i = 0; i < 8; i++)
+            corners.push_back(Vector3d((i & 2) ? 1 : -1, (i & 1) ? 1 : -1, (i & 4) ? 1 : -1));
+
+        const ConvexHull hull(corners);
+        return TriangleMesh(hull.GetVertices(), hull.GetTriangles());
+    }
+}
+
+// Tests that triangles referencing vertices that don't exist get rejected
+TEST_CASE(__FILE__"/Invalid_Indices", "[TriangleMesh]")
+{
+    const std::vector<Vector3d> vertices = { Vector3d(0, 0, 0), Vector3d(1, 0, 0), Vector3d(0, 1, 0) };
+
+    REQUIRE_THROWS_AS(TriangleMesh(vertices, { { 0, 1, 3 } }), std::out_of_range);
+    REQUIRE_NOTHROW(TriangleMesh(vertices, { { 0, 1, 2 } }));
+
+    // An empty mesh has no bounds, and gets hit by nothing
+    const TriangleMesh empty;
+    RaycastHit hit;
+    REQUIRE_THROWS_AS(empty.GetBounds(), std::logic_error);
+    REQUIRE_FALSE(empty.Raycast(Vector3d(0, 0, 0), Vector3d(1, 0, 0), INFINITY, hit));
+
+    return;
+}
+
+// Tests that batched face normals match single ones, and are perpendicular to their triangles
+TEST_CASE(__FILE__"/Face_Normals", "[TriangleMesh]")
+{
+    // Not a multiple of the block width, to cover the tail
+    const TriangleMesh mesh = RandomSoup(103);
+
+    std::vector<Vector3d> normals;
+    mesh.GetFaceNormals(normals);
+    REQUIRE(normals.size() == 103);
+
+    for (std::size_t i = 0; i < mesh.GetTriangleCount(); i++)
+    {
+        const Vector3d single = mesh.GetFaceNormal(i);
+        REQUIRE(normals[i].x == Approx(single.x).margin(1e-12));
+        REQUIRE(normals[i].y == Approx(single.y).margin(1e-12));
+        REQUIRE(normals[i].z == Approx(single.z).margin(1e-12));
+        REQUIRE(single.DotProduct(single) == Approx(1));
+
+        const std::array<std::size_t, 3>& triangle = mesh.GetTriangle(i);
+        const Vector3d a = mesh.GetVertex(triangle[0]);
+        const Vector3d b = mesh.GetVertex(triangle[1]);
+        const Vector3d c = mesh.GetVertex(triangle[2]);
+        REQUIRE(single.DotProduct(b - a) == Approx(0).margin(1e-9));
+        REQUIRE(single.DotProduct(c - a) == Approx(0).margin(1e-9));
+
+        // Counter-clockwise seen from the front
+        REQUIRE(single.DotProduct((b - a).CrossProduct(c - a)) > 0);
+    }
+
+    return;
+}
+
+// Tests rays against a cube, from outside and inside
+TEST_CASE(__FILE__"/Raycast_Cube", "[TriangleMesh]")
+{
+    const TriangleMesh cube = Cube();
+    REQUIRE(cube.GetTriangleCount() == 12);
+
+    const AABB bounds = cube.GetBounds();
+    REQUIRE(bounds.min == Vector3d(-1, -1, -1));
+    REQUIRE(bounds.max == Vector3d(1, 1, 1));
+
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const Vector3d offset = RandomVector(rng, 0.99);
+        RaycastHit hit;
+
+        // From above, straight down
+        REQUIRE(cube.Raycast(Vector3d(offset.x, 5, offset.z), Vector3d(0, -1, 0), INFINITY, hit));
+        REQUIRE(hit.t == Approx(4));
+        REQUIRE(hit.point.y == Approx(1));
+        REQUIRE(hit.normal.y == Approx(1));
+        REQUIRE(cube.GetTriangleBounds(hit.face).min.y == 1);
+
+        // Too short
+        REQUIRE_FALSE(cube.Raycast(Vector3d(offset.x, 5, offset.z), Vector3d(0, -1, 0), 3.99, hit));
+
+        // Pointing away
+        REQUIRE_FALSE(cube.Raycast(Vector3d(offset.x, 5, offset.z), Vector3d(0, 1, 0), INFINITY, hit));
+
+        // Passing by
+        REQUIRE_FALSE(cube.Raycast(Vector3d(1.01, 5, offset.z), Vector3d(0, -1, 0), INFINITY, hit));
+
+        // From inside, hitting the back side of a face
+        REQUIRE(cube.Raycast(offset, Vector3d(2, 0, 0), INFINITY, hit));
+        REQUIRE(hit.t == Approx((1 - offset.x) / 2));
+        REQUIRE(hit.normal.x == Approx(1));
+    }
+
+    return;
+}
+
+// Tests that raycasting only the triangles whose boxes a bounding volume hierarchy reports finds the same hits as testing all of them
+TEST_CASE(__FILE__"/Raycast_Candidates", "[TriangleMesh]")
+{
+    const TriangleMesh mesh = RandomSoup(501);
+
+    DynamicAABBTree tree(0);
+    std::vector<std::size_t> triangleOfHandle;
+    for (std::size_t i = 0; i < mesh.GetTriangleCount(); i++)
+    {
+        const std::size_t handle = tree.Insert(mesh.GetTriangleBounds(i));
+        triangleOfHandle.resize(std::max(triangleOfHandle.size(), handle + 1));
+        triangleOfHandle[handle] = i;
+    }
+
+    std::size_t hits = 0;
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const Vector3d origin = RandomVector(rng, 15);
+        const Vector3d direction = RandomVector(rng, 1);
+        const double maxT = (i % 2) ? INFINITY : 15;
+
+        std::vector<std::size_t> candidates;
+        tree.Raycast(origin, direction, maxT, candidates);
+        for (std::size_t& candidate : candidates)
+            candidate = triangleOfHandle[candidate];
+
+        RaycastHit all;
+        RaycastHit some;
+        const bool hitAll = mesh.Raycast(origin, direction, maxT, all);
+        REQUIRE(mesh.Raycast(origin, direction, maxT, candidates, some) == hitAll);
+
+        if (!hitAll)
+            continue;
+
+        hits++;
+        // Whole blocks and leftover triangles may round differently
+        REQUIRE(some.t == Approx(all.t));
+        REQUIRE(some.face == all.face);
+        REQUIRE(all.t <= maxT);
+
+        // The hit lies on the plane of the triangle it reports
+        const Vector3d a = mesh.GetVertex(mesh.GetTriangle(all.face)[0]);
+        REQUIRE(all.normal.DotProduct(all.point - a) == Approx(0).margin(1e-9));
+
+        // Nothing listed gets hit before it
+        for (std::size_t j = 0; j < mesh.GetTriangleCount(); j++)
+        {
+            RaycastHit single;
+            if (mesh.Raycast(origin, direction, maxT, { j }, single))
+                REQUIRE(single.t >= all.t - 1e-9);
+        }
+    }
+
+    REQUIRE(hits > 0);
+
+    return;
+}
@@ -2,8 +2,11 @@
 #include <Eule/Vector2.h>
 #include <Eule/Math.h>
 #include "TestingUtilities/HandyMacros.h"
+#include <algorithm>
 #include <random>
 #include <sstream>
+#include <unordered_set>
+#include <vector>
 
 using namespace Leonetienne::Eule;
 
@@ -891,3 +894,30 @@ TEST_CASE(__FILE__"/Move_Operator", "[Vector][Vector2]")
 
     return;
 }
+
+// Tests that integer vectors can be hashed, and that neighbouring cells spread over the low bits of the hash
+TEST_CASE(__FILE__"/Hash", "[Vector][Vector2]")
+{
+    const std::hash<Vector2i> hash;
+
+    // Equal vectors hash equally
+    REQUIRE(hash(Vector2i(3, -7)) == hash(Vector2i(3, -7)));
+
+    // Swapped components don't collide
+    REQUIRE(hash(Vector2i(1, 2)) != hash(Vector2i(2, 1)));
+
+    // A block of 64^2 neighbouring cells, binned by the lowest 12 bits of their hashes
+    std::vector<std::size_t> buckets(4096, 0);
+    std::unordered_set<Vector2i> set;
+    for (int x = -32; x < 32; x++)
+        for (int y = -32; y < 32; y++)
+        {
+            buckets[hash(Vector2i(x, y)) & 4095]++;
+            set.insert(Vector2i(x, y));
+        }
+
+    REQUIRE(set.size() == 4096);
+    REQUIRE(*std::max_element(buckets.begin(), buckets.end()) <= 10);
+
+    return;
+}
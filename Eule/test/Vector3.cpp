@@ -2,7 +2,10 @@
 #include <Eule/Vector3.h>
 #include <Eule/Math.h>
 #include "TestingUtilities/HandyMacros.h"
+#include <algorithm>
 #include <random>
+#include <unordered_set>
+#include <vector>
 
 using namespace Leonetienne::Eule;
 
@@ -252,6 +255,21 @@ TEST_CASE(__FILE__"/DotProduct_Oracle", "[Vector][Vector3]")
     return;
 }
 
+// Tests that the dot product stays in double precision. Intrinsics used to compute it with floats
+TEST_CASE(__FILE__"/DotProduct_Double_Precision", "[Vector][Vector3]")
+{
+    // 2^24 + 1 is the first integer a float can't represent
+    REQUIRE(Vector3d(16777217, 0, 0).DotProduct(Vector3d(1, 1, 1)) == 16777217.0);
+
+    // Differences far below float precision must not get lost
+    const Vector3d a(1 + 1e-12, 0.1, -0.3);
+    const Vector3d b(1, 0.7, 0.5);
+    REQUIRE(Math::Similar(a.DotProduct(b), 0.92 + 1e-12, 1e-14));
+    REQUIRE(Vector3d(1 + 1e-12, 0, 0).DotProduct(Vector3d(1, 0, 0)) > 1.0);
+
+    return;
+}
+
 // Quick and dirty check if the useless int-method is working
 TEST_CASE(__FILE__"/DotProduct_Dirty_Int", "[Vector][Vector3]")
 {
@@ -1473,3 +1491,31 @@ TEST_CASE(__FILE__"/Move_Operator", "[Vector][Vector3]")
 
     return;
 }
+
+// Tests that integer vectors can be hashed, and that neighbouring cells spread over the low bits of the hash
+TEST_CASE(__FILE__"/Hash", "[Vector][Vector3]")
+{
+    const std::hash<Vector3i> hash;
+
+    // Equal vectors hash equally
+    REQUIRE(hash(Vector3i(3, -7, 12)) == hash(Vector3i(3, -7, 12)));
+
+    // Permuted components don't collide
+    REQUIRE(hash(Vector3i(1, 2, 3)) != hash(Vector3i(3, 2, 1)));
+
+    // A block of 16^3 neighbouring cells, binned by the lowest 12 bits of their hashes
+    std::vector<std::size_t> buckets(4096, 0);
+    std::unordered_set<Vector3i> set;
+    for (int x = -8; x < 8; x++)
+        for (int y = -8; y < 8; y++)
+            for (int z = -8; z < 8; z++)
+            {
+                buckets[hash(Vector3i(x, y, z)) & 4095]++;
+                set.insert(Vector3i(x, y, z));
+            }
+
+    REQUIRE(set.size() == 4096);
+    REQUIRE(*std::max_element(buckets.begin(), buckets.end()) <= 10);
+
+    return;
+}
@@ -0,0 +1,156 @@
+#include "Catch2.h"
+#include <Eule/VertexWelder.h>
+#include "TestingUtilities/Fixtures.h"
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+
+    // Welds by comparing each point against all welded vertices, in O(n^2)
+    void BruteForceWeld(const std::vector<Vector3d>& points, double epsilon, std::vector<std::size_t>& remap, std::vector<Vector3d>& welded)
+    {
+        remap.resize(points.size());
+        welded.clear();
+
+        for (std::size_t i = 0; i < points.size(); i++)
+        {
+            std::size_t j = 0;
+            while ((j < welded.size()) && (!welded[j].Similar(points[i], epsilon)))
+                j++;
+
+            if (j == welded.size())
+                welded.push_back(points[i]);
+
+            remap[i] = j;
+        }
+
+        return;
+    }
+}
+
+// Tests that invalid epsilons get rejected, and that nothing welds to nothing
+TEST_CASE(__FILE__"/Invalid_And_Empty", "[VertexWelder]")
+{
+    std::vector<std::size_t> remap;
+    std::vector<Vector3d> welded = { Vector3d(1, 2, 3) };
+
+    REQUIRE_THROWS_AS(VertexWelder::Weld({ Vector3d(0, 0, 0) }, 0, remap, welded), std::invalid_argument);
+    REQUIRE_THROWS_AS(VertexWelder::Weld({ Vector3d(0, 0, 0) }, -1, remap, welded), std::invalid_argument);
+
+    VertexWelder::Weld({}, 0.1, remap, welded);
+    REQUIRE(remap.empty());
+    REQUIRE(welded.empty());
+
+    return;
+}
+
+// Tests that exact duplicates, in random order, get welded into one vertex each
+TEST_CASE(__FILE__"/Exact_Duplicates", "[VertexWelder]")
+{
+    std::vector<Vector3d> unique;
+    for (std::size_t i = 0; i < 1000; i++)
+        unique.push_back(Vector3d((double)(i % 10), (double)(i / 10 % 10), (double)(i / 100)));
+
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 6; i++)
+        points.insert(points.end(), unique.begin(), unique.end());
+    std::shuffle(points.begin(), points.end(), rng);
+
+    std::vector<std::size_t> remap;
+    std::vector<Vector3d> welded;
+    VertexWelder::Weld(points, 1e-6, remap, welded);
+
+    REQUIRE(welded.size() == unique.size());
+    REQUIRE(remap.size() == points.size());
+
+    for (std::size_t i = 0; i < points.size(); i++)
+        REQUIRE(welded[remap[i]] == points[i]);
+
+    // Welded vertices come in the order of their first point
+    std::size_t next = 0;
+    for (std::size_t i = 0; i < points.size(); i++)
+        if (remap[i] == next)
+            next++;
+        else
+            REQUIRE(remap[i] < next);
+
+    return;
+}
+
+// Tests that slightly jittered copies get welded, even across cell boundaries
+TEST_CASE(__FILE__"/Jittered_Copies", "[VertexWelder]")
+{
+    std::vector<Vector3d> unique;
+    for (std::size_t i = 0; i < 500; i++)
+        unique.push_back(RandomVector(rng, 100));
+
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 4; i++)
+        for (const Vector3d& p : unique)
+            points.push_back(p + RandomVector(rng, 0.01));
+
+    std::vector<std::size_t> remap;
+    std::vector<Vector3d> welded;
+    VertexWelder::Weld(points, 0.05, remap, welded);
+
+    REQUIRE(welded.size() == unique.size());
+
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        REQUIRE(remap[i] == i % unique.size());
+        REQUIRE(welded[remap[i]].Similar(points[i], 0.05));
+    }
+
+    return;
+}
+
+// Tests that welding dense clusters, where similar points chain into each other, matches comparing all pairs
+TEST_CASE(__FILE__"/Matches_Brute_Force", "[VertexWelder]")
+{
+    for (const double epsilon : { 0.01, 0.05, 0.2 })
+    {
+        std::vector<Vector3d> points;
+        for (std::size_t i = 0; i < 3000; i++)
+            points.push_back(RandomVector(rng, 1));
+
+        std::vector<std::size_t> remap;
+        std::vector<Vector3d> welded;
+        VertexWelder::Weld(points, epsilon, remap, welded);
+
+        std::vector<std::size_t> expectedRemap;
+        std::vector<Vector3d> expectedWelded;
+        BruteForceWeld(points, epsilon, expectedRemap, expectedWelded);
+
+        REQUIRE(remap == expectedRemap);
+        REQUIRE(welded == expectedWelded);
+    }
+
+    return;
+}
+
+// Tests that the result does not depend on the amount of threads
+TEST_CASE(__FILE__"/Deterministic_Across_Threads", "[VertexWelder]")
+{
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < VertexWelder::MIN_POINTS_PER_THREAD * 4 + 123; i++)
+        points.push_back(RandomVector(rng, 20));
+
+    std::vector<std::size_t> remap1;
+    std::vector<Vector3d> welded1;
+    VertexWelder::Weld(points, 0.05, remap1, welded1, 1);
+
+    std::vector<std::size_t> remap4;
+    std::vector<Vector3d> welded4;
+    VertexWelder::Weld(points, 0.05, remap4, welded4, 4);
+
+    REQUIRE(welded1.size() < points.size());
+    REQUIRE(remap1 == remap4);
+    REQUIRE(welded1 == welded4);
+
+    return;
+}
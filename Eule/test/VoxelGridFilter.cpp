@@ -0,0 +1,117 @@
+#include "Catch2.h"
+#include <Eule/VoxelGridFilter.h>
+#include "TestingUtilities/Fixtures.h"
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+}
+
+// Tests that voxels round towards negative infinity
+TEST_CASE(__FILE__"/Voxel_Of", "[VoxelGridFilter]")
+{
+    REQUIRE(VoxelGridFilter::VoxelOf(Vector3d(0.5, 1.5, 2.5), 1) == Vector3i(0, 1, 2));
+    REQUIRE(VoxelGridFilter::VoxelOf(Vector3d(-0.5, -1, -1.01), 1) == Vector3i(-1, -1, -2));
+    REQUIRE(VoxelGridFilter::VoxelOf(Vector3d(-0.5, 3, 0), 2) == Vector3i(-1, 1, 0));
+
+    return;
+}
+
+// Tests that each occupied voxel yields the centroid of its points, ordered by voxel
+TEST_CASE(__FILE__"/Centroids_Equal_Reference", "[VoxelGridFilter]")
+{
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 20000; i++)
+        points.push_back(RandomVector(rng, 10));
+
+    const double voxelSize = 0.75;
+
+    // std::map orders by x, then y, then z, just like the filter
+    std::map<std::tuple<int, int, int>, std::pair<Vector3d, std::size_t>> reference;
+    for (const Vector3d& p : points)
+    {
+        const Vector3i v = VoxelGridFilter::VoxelOf(p, voxelSize);
+        std::pair<Vector3d, std::size_t>& entry = reference[std::make_tuple(v.x, v.y, v.z)];
+        entry.first += p;
+        entry.second++;
+    }
+
+    std::vector<Vector3d> centroids;
+    std::vector<Vector3i> voxels;
+    VoxelGridFilter::Downsample(points, voxelSize, centroids, voxels);
+
+    REQUIRE(centroids.size() == reference.size());
+    REQUIRE(voxels.size() == reference.size());
+
+    std::size_t i = 0;
+    for (const auto& [key, entry] : reference)
+    {
+        REQUIRE(voxels[i] == Vector3i(std::get<0>(key), std::get<1>(key), std::get<2>(key)));
+        REQUIRE(centroids[i].Similar(entry.first / (double)entry.second));
+
+        // Centroids stay within their voxel
+        REQUIRE(VoxelGridFilter::VoxelOf(centroids[i], voxelSize) == voxels[i]);
+        i++;
+    }
+
+    return;
+}
+
+// Tests that duplicates collapse into one point
+TEST_CASE(__FILE__"/Deduplicates", "[VoxelGridFilter]")
+{
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 1000; i++)
+        points.push_back(Vector3d(1.25, -3.5, 7));
+
+    std::vector<Vector3d> centroids;
+    VoxelGridFilter::Downsample(points, 0.1, centroids);
+
+    REQUIRE(centroids.size() == 1);
+    REQUIRE(centroids[0].Similar(Vector3d(1.25, -3.5, 7)));
+
+    return;
+}
+
+// Tests that the result does not depend on the amount of threads, up to rounding
+TEST_CASE(__FILE__"/Parallel", "[VoxelGridFilter]")
+{
+    std::vector<Vector3d> points;
+    for (std::size_t i = 0; i < 400000; i++)
+        points.push_back(RandomVector(rng, 50));
+
+    std::vector<Vector3d> singleCentroids;
+    std::vector<Vector3i> singleVoxels;
+    VoxelGridFilter::Downsample(points, 2, singleCentroids, singleVoxels, 1);
+
+    std::vector<Vector3d> multiCentroids;
+    std::vector<Vector3i> multiVoxels;
+    VoxelGridFilter::Downsample(points, 2, multiCentroids, multiVoxels, 4);
+
+    REQUIRE(multiVoxels == singleVoxels);
+    REQUIRE(multiCentroids.size() == singleCentroids.size());
+    for (std::size_t i = 0; i < singleCentroids.size(); i++)
+        REQUIRE(multiCentroids[i].Similar(singleCentroids[i]));
+
+    return;
+}
+
+// Tests that invalid voxel sizes throw, and empty clouds stay empty
+TEST_CASE(__FILE__"/Edge_Cases", "[VoxelGridFilter]")
+{
+    std::vector<Vector3d> centroids = { Vector3d(1, 2, 3) };
+
+    REQUIRE_THROWS_AS(VoxelGridFilter::Downsample(centroids, 0, centroids), std::invalid_argument);
+    REQUIRE_THROWS_AS(VoxelGridFilter::Downsample(centroids, -1, centroids), std::invalid_argument);
+
+    VoxelGridFilter::Downsample(std::vector<Vector3d>(), 1, centroids);
+    REQUIRE(centroids.empty());
+
+    return;
+}
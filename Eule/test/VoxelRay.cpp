@@ -0,0 +1,209 @@
+#include "Catch2.h"
+#include <Eule/VoxelRay.h>
+#include "TestingUtilities/Fixtures.h"
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Leonetienne::Eule;
+
+namespace {
+    static std::mt19937 rng = std::mt19937((std::random_device())());
+
+    Vector3i VoxelOf(const Vector3d& point, double voxelSize, const Vector3d& gridOrigin)
+    {
+        return Vector3i(
+            (int)std::floor((point.x - gridOrigin.x) / voxelSize),
+            (int)std::floor((point.y - gridOrigin.y) / voxelSize),
+            (int)std::floor((point.z - gridOrigin.z) / voxelSize)
+        );
+    }
+
+    // Every fifth voxel, scattered pseudo-randomly
+    bool IsOccupied(const Vector3i& voxel)
+    {
+        return std::hash<Vector3i>()(voxel) % 5 == 0;
+    }
+}
+
+// Tests that invalid rays throw
+TEST_CASE(__FILE__"/Invalid_Arguments", "[VoxelRay]")
+{
+    REQUIRE_THROWS_AS(VoxelRay(Vector3d(0, 0, 0), Vector3d(0, 0, 0), 1), std::invalid_argument);
+    REQUIRE_THROWS_AS(VoxelRay(Vector3d(0, 0, 0), Vector3d(1, 0, 0), 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(VoxelRay(Vector3d(0, 0, 0), Vector3d(1, 0, 0), -1), std::invalid_argument);
+
+    std::vector<RaycastHit> hits;
+    std::vector<Vector3i> voxels;
+    REQUIRE_THROWS_AS(
+        VoxelRay::FindFirstOccupied(std::vector<Vector3d>(2), std::vector<Vector3d>(1, Vector3d(1, 0, 0)), 1, 1, Vector3d::zero, IsOccupied, hits, voxels),
+        std::invalid_argument
+    );
+
+    // A ray hitting nothing would never stop
+    const std::vector<Vector3d> origins(1);
+    const std::vector<Vector3d> directions(1, Vector3d(1, 0, 0));
+    REQUIRE_THROWS_AS(
+        VoxelRay::FindFirstOccupied(origins, directions, std::numeric_limits<double>::infinity(), 1, Vector3d::zero, IsOccupied, hits, voxels),
+        std::invalid_argument
+    );
+    REQUIRE_THROWS_AS(
+        VoxelRay::FindFirstOccupied(origins, directions, std::numeric_limits<double>::quiet_NaN(), 1, Vector3d::zero, IsOccupied, hits, voxels),
+        std::invalid_argument
+    );
+
+    return;
+}
+
+// Tests walking along an axis, in both directions
+TEST_CASE(__FILE__"/Axis_Parallel", "[VoxelRay]")
+{
+    // Positive x
+    {
+        VoxelRay ray(Vector3d(0.5, 0.5, 0.5), Vector3d(1, 0, 0), 1);
+        REQUIRE(ray.GetVoxel() == Vector3i(0, 0, 0));
+        REQUIRE(ray.GetEntryT() == 0);
+        REQUIRE(ray.GetExitT() == Approx(0.5));
+        REQUIRE(ray.GetEntryAxis() == VoxelRay::NO_AXIS);
+
+        for (int i = 1; i < 10; i++)
+        {
+            ray.Step();
+            REQUIRE(ray.GetVoxel() == Vector3i(i, 0, 0));
+            REQUIRE(ray.GetEntryT() == Approx(i - 0.5));
+            REQUIRE(ray.GetEntryAxis() == 0);
+        }
+    }
+
+    // Negative z, with a shifted grid and a direction that is not normalized
+    {
+        VoxelRay ray(Vector3d(1.3, 2.3, 0.5), Vector3d(0, 0, -4), 0.5, Vector3d(0.1, 0.1, 0.1));
+        REQUIRE(ray.GetVoxel() == Vector3i(2, 4, 0));
+
+        for (int i = 1; i < 10; i++)
+        {
+            ray.Step();
+            REQUIRE(ray.GetVoxel() == Vector3i(2, 4, -i));
+            REQUIRE(ray.GetEntryT() == Approx((0.4 + (i - 1) * 0.5) / 4));
+            REQUIRE(ray.GetEntryAxis() == 2);
+        }
+    }
+
+    return;
+}
+
+// Tests that random rays visit a face-connected sequence of voxels, each of which contains the ray between its entry and exit
+TEST_CASE(__FILE__"/Visits_Voxels_Along_Ray", "[VoxelRay]")
+{
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const Vector3d origin = RandomVector(rng, 20);
+        const Vector3d direction = RandomVector(rng, 3);
+        const double voxelSize = 0.1 + (rng() % 100) / 50.0;
+        const Vector3d gridOrigin = RandomVector(rng, 5);
+
+        if (direction == Vector3d::zero)
+            continue;
+
+        VoxelRay ray(origin, direction, voxelSize, gridOrigin);
+        REQUIRE(ray.GetVoxel() == VoxelOf(origin, voxelSize, gridOrigin));
+
+        for (std::size_t j = 0; j < 100; j++)
+        {
+            // Where the ray barely clips a voxel, its middle may round into a neighbour, so allow for some slack
+            const double middle = (ray.GetEntryT() + ray.GetExitT()) * 0.5;
+            const Vector3d point = origin + direction * middle;
+            for (std::size_t k = 0; k < 3; k++)
+            {
+                const double local = (point[k] - gridOrigin[k]) / voxelSize - ray.GetVoxel()[k];
+                REQUIRE(local >= -1e-6);
+                REQUIRE(local <= 1 + 1e-6);
+            }
+
+            const Vector3i previous = ray.GetVoxel();
+            const double previousExit = ray.GetExitT();
+            ray.Step();
+
+            const Vector3i difference = ray.GetVoxel() - previous;
+            REQUIRE(std::abs(difference.x) + std::abs(difference.y) + std::abs(difference.z) == 1);
+            REQUIRE(difference[ray.GetEntryAxis()] != 0);
+            REQUIRE(ray.GetEntryT() == previousExit);
+            REQUIRE(ray.GetExitT() >= ray.GetEntryT());
+        }
+    }
+
+    return;
+}
+
+// Tests that walking many rays at once finds the same voxels as walking each on its own
+TEST_CASE(__FILE__"/Find_First_Occupied", "[VoxelRay]")
+{
+    const double voxelSize = 0.7;
+    const Vector3d gridOrigin(0.3, -0.2, 0.1);
+    const double maxT = 5;
+
+    std::vector<Vector3d> origins;
+    std::vector<Vector3d> directions;
+    for (std::size_t i = 0; i < 2000; i++)
+    {
+        origins.push_back(RandomVector(rng, 20));
+        directions.push_back(RandomVector(rng, 2));
+
+        // Some axis-parallel rays
+        if (i % 10 == 0)
+            directions.back() = Vector3d(0, (i % 20) ? 1.5 : -1.5, 0);
+
+        if (directions.back() == Vector3d::zero)
+            directions.back() = Vector3d(1, 0, 0);
+    }
+
+    std::vector<RaycastHit> hits;
+    std::vector<Vector3i> voxels;
+    VoxelRay::FindFirstOccupied(origins, directions, maxT, voxelSize, gridOrigin, IsOccupied, hits, voxels);
+
+    REQUIRE(hits.size() == origins.size());
+    REQUIRE(voxels.size() == origins.size());
+
+    std::size_t hitCount = 0;
+    for (std::size_t i = 0; i < origins.size(); i++)
+    {
+        VoxelRay ray(origins[i], directions[i], voxelSize, gridOrigin);
+        while ((ray.GetEntryT() <= maxT) && (!IsOccupied(ray.GetVoxel())))
+            ray.Step();
+
+        if (ray.GetEntryT() > maxT)
+        {
+            REQUIRE(hits[i].t == std::numeric_limits<double>::infinity());
+            continue;
+        }
+
+        hitCount++;
+        REQUIRE(voxels[i] == ray.GetVoxel());
+        REQUIRE(hits[i].t == ray.GetEntryT());
+        REQUIRE(hits[i].face == ray.GetEntryAxis());
+
+        if (hits[i].face == VoxelRay::NO_AXIS)
+        {
+            REQUIRE(hits[i].t == 0);
+            REQUIRE(hits[i].normal == Vector3d::zero);
+        }
+        else
+        {
+            // The normal points against the ray
+            const std::size_t axis = hits[i].face;
+            REQUIRE(std::abs(hits[i].normal[axis]) == 1);
+            REQUIRE(hits[i].normal[axis] * directions[i][axis] < 0);
+
+            // The hit point lies on the voxel's face
+            const double face = gridOrigin[axis] + (voxels[i][axis] + (hits[i].normal[axis] > 0 ? 1 : 0)) * voxelSize;
+            REQUIRE(hits[i].point[axis] == Approx(face).margin(1e-9));
+        }
+    }
+
+    // Most rays should have found something
+    REQUIRE(hitCount > origins.size() / 2);
+
+    return;
+}